@@ -341,6 +341,10 @@ SOURCE=.\Source\Common\System\Upgrade.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Source\Common\System\WorkerThreadPool.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Source\Common\System\Xfer.cpp
 # End Source File
 # Begin Source File
@@ -675,6 +679,10 @@ SOURCE=.\Source\Common\Recorder.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Source\Common\ReplaySimulation.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Source\Common\SkirmishBattleHonors.cpp
 # End Source File
 # Begin Source File
@@ -2706,6 +2714,10 @@ SOURCE=.\Source\GameNetwork\FrameMetrics.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Source\GameNetwork\LoopbackNetwork.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Source\GameNetwork\NAT.cpp
 # End Source File
 # Begin Source File
@@ -2742,6 +2754,10 @@ SOURCE=.\Source\GameNetwork\NetworkUtil.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Source\GameNetwork\RelayServer.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Source\GameNetwork\Transport.cpp
 # End Source File
 # Begin Source File
@@ -3120,6 +3136,10 @@ SOURCE=.\Include\Common\NameKeyGenerator.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\Include\Common\NameKeyRegistry.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Include\GameLogic\ObjectScriptStatusBits.h
 # End Source File
 # Begin Source File
@@ -3196,6 +3216,10 @@ SOURCE=.\Include\Common\Recorder.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\Include\Common\ReplaySimulation.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Include\Common\Registry.h
 # End Source File
 # Begin Source File
@@ -3328,6 +3352,10 @@ SOURCE=.\Include\Common\WellKnownKeys.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\Include\Common\WorkerThreadPool.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Include\Common\Xfer.h
 # End Source File
 # Begin Source File
@@ -5128,6 +5156,10 @@ SOURCE=.\Include\GameNetwork\LANPlayer.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\Include\GameNetwork\LoopbackNetwork.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Include\GameNetwork\NAT.h
 # End Source File
 # Begin Source File
@@ -5168,6 +5200,10 @@ SOURCE=.\Include\GameNetwork\RankPointValue.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\Include\GameNetwork\RelayServer.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\Include\GameNetwork\Transport.h
 # End Source File
 # Begin Source File
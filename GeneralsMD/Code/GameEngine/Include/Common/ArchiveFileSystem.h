@@ -90,31 +90,14 @@ class ArchiveFile;
 	* openFile() member searches all Archive files for the specified sub file.
 	*/
 //===============================
-class ArchivedDirectoryInfo;
 class DetailedArchivedDirectoryInfo;
 class ArchivedFileInfo;
+class ArchivedFileIndexEntry;
 
 typedef std::map<AsciiString, DetailedArchivedDirectoryInfo> DetailedArchivedDirectoryInfoMap;
-typedef std::map<AsciiString, ArchivedDirectoryInfo> ArchivedDirectoryInfoMap;
 typedef std::map<AsciiString, ArchivedFileInfo> ArchivedFileInfoMap;
 typedef std::map<AsciiString, ArchiveFile *> ArchiveFileMap;
-typedef std::map<AsciiString, AsciiString> ArchivedFileLocationMap; // first string is the file name, second one is the archive filename.
-
-class ArchivedDirectoryInfo 
-{
-public:
-	AsciiString								m_directoryName;
-	ArchivedDirectoryInfoMap	m_directories;
-	ArchivedFileLocationMap		m_files;
-
-	void clear()
-	{
-		m_directoryName.clear();
-		m_directories.clear();
-		m_files.clear();
-	}
-
-};
+typedef std::vector<ArchivedFileIndexEntry> ArchivedFileIndex;
 
 class DetailedArchivedDirectoryInfo 
 {
@@ -153,6 +136,23 @@ class ArchivedFileInfo
 	}
 };
 
+/**
+	* One slot of ArchiveFileSystem's open-addressed path index.  m_path is the
+	* lower-cased, '\\'-separated path as produced by normalizeArchivePath; an
+	* empty m_path marks a free slot.
+	*/
+class ArchivedFileIndexEntry
+{
+public:
+	UnsignedInt		m_hash;									///< hash of m_path
+	AsciiString		m_path;									///< normalized path of the file
+	AsciiString		m_archiveFilename;			///< name the providing archive was mounted under
+	ArchiveFile		*m_archiveFile;					///< the archive that currently provides this path
+
+	ArchivedFileIndexEntry() : m_hash(0), m_archiveFile(NULL)
+	{
+	}
+};
 
 class ArchiveFileSystem : public SubsystemInterface
 {
@@ -185,10 +185,16 @@ class ArchiveFileSystem : public SubsystemInterface
 	void loadMods( void );
 
 protected:
-	virtual void					loadIntoDirectoryTree(const ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite = FALSE );	///< load the archive file's header information and apply it to the global archive directory tree.
+	virtual void					loadIntoDirectoryTree(ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite = FALSE );	///< load the archive file's header information and apply it to the global path index.
+
+	const ArchivedFileIndexEntry *findIndexEntry( const Char *filename ) const;		///< look up a path in the index; NULL if no archive has it
+	void					addIndexEntry( const Char *path, ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite );	///< add a path, replacing an existing entry only if overwrite
+	void					removeArchiveFromIndex( const ArchiveFile *archiveFile );	///< drop every path provided by archiveFile (before it is deleted)
+	void					resizeIndex( Int capacity );																///< rehash the index into capacity slots (a power of two)
 
 	ArchiveFileMap m_archiveFileMap;
-	ArchivedDirectoryInfo m_rootDirectory;
+	ArchivedFileIndex m_fileIndex;				///< open-addressed (linear probe) table of every archived path
+	Int								m_fileIndexCount;		///< number of used slots in m_fileIndex
 };
 
 
@@ -101,6 +101,7 @@
 	extern Int lastCRCDebugIndex;
 	
 	extern Bool g_verifyClientCRC;
+	extern Bool g_verifyIncrementalCRC;
 	extern Bool g_clientDeepCRC;
 
 	extern Bool g_crcModuleDataFromClient;
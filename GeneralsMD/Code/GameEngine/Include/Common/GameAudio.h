@@ -382,6 +382,82 @@ class AudioManager : public SubsystemInterface
 		Bool m_disallowSpeech			: 1;
 };
 
+//-------------------------------------------------------------------------------------------------
+/** Audio manager with no device behind it, for -headless runs.  Events are still validated and
+	* their info looked up like any other manager, but nothing is ever opened or played, and file
+	* lengths come back as 0 the same way they do from a manager whose device is off. */
+//-------------------------------------------------------------------------------------------------
+class AudioManagerDummy : public AudioManager
+{
+	public:
+#if defined(_DEBUG) || defined(_INTERNAL)
+		virtual void audioDebugDisplay(DebugDisplayInterface *dd, void *userData, FILE *fp = NULL ) { }
+#endif
+
+		// requests are never played, so just throw them away every frame
+		virtual void update() { AudioManager::update(); removeAllAudioRequests(); }
+
+		virtual void stopAudio( AudioAffect which ) { }
+		virtual void pauseAudio( AudioAffect which ) { }
+		virtual void resumeAudio( AudioAffect which ) { }
+		virtual void pauseAmbient( Bool shouldPause ) { }
+		virtual void killAudioEventImmediately( AudioHandle audioEvent ) { }
+
+		virtual void nextMusicTrack( void ) { }
+		virtual void prevMusicTrack( void ) { }
+		virtual Bool isMusicPlaying( void ) const { return FALSE; }
+		virtual Bool hasMusicTrackCompleted( const AsciiString& trackName, Int numberOfTimes ) const { return FALSE; }
+		virtual AsciiString getMusicTrackName( void ) const { return AsciiString::TheEmptyString; }
+
+		virtual void openDevice( void ) { }
+		virtual void closeDevice( void ) { }
+		virtual void *getDevice( void ) { return NULL; }
+
+		virtual void notifyOfAudioCompletion( UnsignedInt audioCompleted, UnsignedInt flags ) { }
+
+		virtual UnsignedInt getProviderCount( void ) const { return 0; }
+		virtual AsciiString getProviderName( UnsignedInt providerNum ) const { return AsciiString::TheEmptyString; }
+		virtual UnsignedInt getProviderIndex( AsciiString providerName ) const { return 0; }
+		virtual void selectProvider( UnsignedInt providerNdx ) { }
+		virtual void unselectProvider( void ) { }
+		virtual UnsignedInt getSelectedProvider( void ) const { return 0; }
+		virtual void setSpeakerType( UnsignedInt speakerType ) { }
+		virtual UnsignedInt getSpeakerType( void ) { return 0; }
+
+		virtual UnsignedInt getNum2DSamples( void ) const { return 0; }
+		virtual UnsignedInt getNum3DSamples( void ) const { return 0; }
+		virtual UnsignedInt getNumStreams( void ) const { return 0; }
+
+		virtual Bool doesViolateLimit( AudioEventRTS *event ) const { return FALSE; }
+		virtual Bool isPlayingLowerPriority( AudioEventRTS *event ) const { return FALSE; }
+		virtual Bool isPlayingAlready( AudioEventRTS *event ) const { return FALSE; }
+		virtual Bool isObjectPlayingVoice( UnsignedInt objID ) const { return FALSE; }
+
+		virtual void adjustVolumeOfPlayingAudio(AsciiString eventName, Real newVolume) { }
+		virtual void removePlayingAudio( AsciiString eventName ) { }
+		virtual void removeAllDisabledAudio() { }
+
+		virtual Bool has3DSensitiveStreamsPlaying( void ) const { return FALSE; }
+
+ 		virtual void *getHandleForBink( void ) { return NULL; }
+ 		virtual void releaseHandleForBink( void ) { }
+
+		virtual void friend_forcePlayAudioEventRTS(const AudioEventRTS* eventToPlay) { }
+
+		virtual void setPreferredProvider(AsciiString providerNdx) { }
+		virtual void setPreferredSpeaker(AsciiString speakerType) { }
+
+		virtual Real getFileLengthMS( AsciiString strToLoad ) const { return 0.0f; }
+
+		virtual void closeAnySamplesUsingFile( const void *fileToClose ) { }
+
+		// there is nothing to play the music with, so never ask for the CD
+		virtual Bool isMusicAlreadyLoaded(void) const { return TRUE; }
+
+	protected:
+		virtual void setDeviceListenerPosition( void ) { }
+};
+
 extern AudioManager *TheAudio;
 
 #endif // __COMMON_GAMEAUDIO_H_
@@ -123,7 +123,7 @@ extern GameEngine *TheGameEngine;
 /// This function creates a new game engine instance, and is device specific
 extern GameEngine *CreateGameEngine( void );
 
-/// The entry point for the game system
-extern void GameMain( int argc, char *argv[] );
+/// The entry point for the game system, returns the process exit code
+extern Int GameMain( int argc, char *argv[] );
 
 #endif // _GAME_ENGINE_H_
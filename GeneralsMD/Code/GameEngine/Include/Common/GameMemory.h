@@ -70,6 +70,12 @@
 	#define MEMORYPOOL_DEBUG
 #endif
 
+// per-thread free block caches. the debug bookkeeping assumes every alloc/free goes thru the
+// pool lock, so these are only used in non-debug builds.
+#if !defined(MEMORYPOOL_DEBUG) && !defined(DISABLE_MEMORYPOOL_MAGAZINES)
+	#define MEMORYPOOL_MAGAZINES
+#endif
+
 // SYSTEM INCLUDES ////////////////////////////////////////////////////////////
 
 #include <new.h>
@@ -223,6 +229,7 @@ class MemoryPool;
 class MemoryPoolFactory;
 class DynamicMemoryAllocator;
 class BlockCheckpointInfo;
+struct PoolMagazine;
 
 // TYPE DEFINES ///////////////////////////////////////////////////////////////
 
@@ -306,6 +313,10 @@ class MemoryPool
 	MemoryPoolBlob		*m_firstBlob;								///< head of linked list: first blob for this pool.
 	MemoryPoolBlob		*m_lastBlob;								///< tail of linked list: last blob for this pool. (needed for efficiency)
 	MemoryPoolBlob		*m_firstBlobWithFreeBlocks;	///< first blob in this pool that has at least one unallocated block.
+#ifdef MEMORYPOOL_MAGAZINES
+	Int								m_magazineIndex;						///< this pool's slot in each thread's magazine table (-1 == no magazines)
+	Int								m_magazineGeneration;				///< bumped on reset; magazines from an older generation are stale
+#endif
 
 private:
 	/// create a new blob with the given number of blocks.
@@ -314,6 +325,27 @@ class MemoryPool
 	/// destroy a blob.
 	Int freeBlob(MemoryPoolBlob *blob);
 
+	/// take a free block out of the blobs, growing the pool if allowed. caller must hold the pool lock.
+	MemoryPoolSingleBlock* takeBlockFromBlobs(Bool allowGrow DECLARE_LITERALSTRING_ARG2);
+
+	/// put a block back in its blob. caller must hold the pool lock.
+	void returnBlockToBlob(MemoryPoolSingleBlock *block);
+
+	/// bookkeeping for a block going to (or coming back from) a caller.
+	void noteBlockAllocated();
+	void noteBlockFreed();
+
+#ifdef MEMORYPOOL_MAGAZINES
+	/// return the calling thread's magazine for this pool, or null if the thread doesn't use them.
+	PoolMagazine* getThreadMagazine();
+
+	/// move a batch of free blocks from the blobs into the magazine. throws if none are available.
+	void refillMagazine(PoolMagazine *mag);
+
+	/// mark every thread's magazine for this pool stale (the blocks are about to go away).
+	void discardMagazines(Bool destroying);
+#endif
+
 public:
 
 	// 'public' funcs that are really only for use by MemoryPoolFactory
@@ -329,6 +361,12 @@ class MemoryPool
 	#ifdef MEMORYPOOL_CHECKPOINTING
 		void debugResetCheckpoints();												///< throw away all checkpoint information for this pool.
 	#endif
+	#ifdef MEMORYPOOL_MAGAZINES
+		/// return all but 'keep' of the magazine's blocks to their blobs.
+		void drainMagazine(PoolMagazine *mag, Int keep);
+		/// return all of a magazine's blocks, unless the pool was reset since they were taken.
+		void releaseMagazine(PoolMagazine *mag);
+	#endif
 
 public:
 
@@ -839,6 +877,17 @@ extern Bool isMemoryManagerOfficiallyInited();
 */
 extern void shutdownMemoryManager();
 
+/**
+	Give the calling thread its own small cache ("magazine") of free blocks for each pool, so
+	that most of its allocations and frees never touch the memory pool lock; blocks move 
+	between the magazines and the pools in batches. initMemoryManager() does this for the
+	main thread. Any other thread that calls it must call shutdownThreadMemoryCache() before
+	it exits, or the blocks it's holding stay out of circulation until their pool is reset.
+	(These do nothing in builds without MEMORYPOOL_MAGAZINES.)
+*/
+extern void initThreadMemoryCache();
+extern void shutdownThreadMemoryCache();
+
 extern MemoryPoolFactory *TheMemoryPoolFactory;
 extern DynamicMemoryAllocator *TheDynamicMemoryAllocator;
 
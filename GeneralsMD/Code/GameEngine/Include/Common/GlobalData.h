@@ -259,6 +259,10 @@ class GlobalData : public SubsystemInterface
 	Bool m_showTerrainNormals;
 
 	UnsignedInt m_noDraw;					///< Used to disable drawing, to profile game logic code.
+	Bool m_headless;							///< No drawing, audio, video or frame limiting at all; the logic runs as fast as it can.
+	AsciiString m_simulateReplay;	///< If set, play back this replay headless and exit instead of running the shell.
+	Int m_logicWorkerThreads;			///< Helper threads for phase-parallel update gathers (0 == gather on the main thread)
+	Bool m_scriptConditionPolling;	///< Evaluate every script's conditions each pass, instead of reusing false results whose inputs haven't changed
 	AIDebugOptions m_debugAI;			///< Used to display AI debug information
 	Bool m_debugSupplyCenterPlacement; ///< Dumps to log everywhere it thinks about placing a supply center
 	Bool m_debugAIObstacles;			///< Used to display AI obstacle debug information
@@ -455,6 +459,9 @@ class GlobalData : public SubsystemInterface
 	UnsignedInt m_networkDisconnectTime;			      	///< The number of milliseconds between when the game gets stuck on a frame for a network stall and when the disconnect dialog comes up.
 	UnsignedInt m_networkPlayerTimeoutTime;		      	///< The number of milliseconds between when a player's last keep alive command was recieved and when they are considered disconnected from the game.
 	UnsignedInt	m_networkDisconnectScreenNotifyTime;  ///< The number of milliseconds between when the disconnect screen comes up and when the other players are notified that we are on the disconnect screen.
+	UnsignedInt	m_networkRelayIP;									///< If set, every remote connection is addressed to the relay server at this address (host order).
+	UnsignedShort m_networkRelayPort;								///< The relay server's port.
+	Bool				m_networkCompactGameCommands;					///< When hosting, ask every player to send game commands with the compact packet encoding.
 	
 	Real				m_keyboardCameraRotateSpeed;    ///< How fast the camera rotates when rotated via keyboard controls.
   Int					m_playStats;									///< Int whether we want to log play stats or not, if <= 0 then we don't log
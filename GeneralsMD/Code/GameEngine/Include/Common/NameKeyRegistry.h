@@ -0,0 +1,86 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// NameKeyRegistry.h //////////////////////////////////////////////////////////
+// A hashed index from NameKeyType to template pointers, for the stores that
+// look their templates up by name.  The index doesn't own anything; the store
+// still keeps (and deletes) its templates however it always did.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef _NAME_KEY_REGISTRY_H_
+#define _NAME_KEY_REGISTRY_H_
+
+#include "Common/NameKeyGenerator.h"
+#include "Common/STLTypedefs.h"
+
+//-------------------------------------------------------------------------------------------------
+template <class T> class NameKeyRegistry
+{
+
+public:
+
+	typedef std::hash_map< NameKeyType, T *, rts::hash<NameKeyType>, rts::equal_to<NameKeyType> > RegistryMap;
+	typedef typename RegistryMap::iterator iterator;
+	typedef typename RegistryMap::const_iterator const_iterator;
+
+	/// return the item registered under 'key', or NULL
+	T *find( NameKeyType key ) const
+	{
+		const_iterator it = m_map.find( key );
+		return it != m_map.end() ? (*it).second : NULL;
+	}
+
+	/// register 'item' under 'key', replacing whatever was registered there before
+	void add( NameKeyType key, T *item ) { m_map[ key ] = item; }
+
+	/// unregister 'key', but only if it still refers to 'item'
+	void remove( NameKeyType key, const T *item )
+	{
+		iterator it = m_map.find( key );
+		if( it != m_map.end() && (*it).second == item )
+			m_map.erase( it );
+	}
+
+	void erase( iterator it ) { m_map.erase( it ); }
+	void clear( void ) { m_map.clear(); }
+	Int size( void ) const { return m_map.size(); }
+
+	iterator begin( void ) { return m_map.begin(); }
+	iterator end( void ) { return m_map.end(); }
+	const_iterator begin( void ) const { return m_map.begin(); }
+	const_iterator end( void ) const { return m_map.end(); }
+
+private:
+
+	RegistryMap m_map;
+
+};
+
+#endif // _NAME_KEY_REGISTRY_H_
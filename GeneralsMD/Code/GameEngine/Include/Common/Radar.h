@@ -300,6 +300,20 @@ class Radar : public Snapshot,
 
 };
 
+//-------------------------------------------------------------------------------------------------
+/** Radar with nothing to draw into, for -headless runs.  Objects and events are still tracked. */
+//-------------------------------------------------------------------------------------------------
+class RadarDummy : public Radar
+{
+
+public:
+
+	virtual void draw( Int pixelX, Int pixelY, Int width, Int height ) { }
+	virtual void clearShroud() { }
+	virtual void setShroudLevel( Int x, Int y, CellShroudStatus setting ) { }
+
+};
+
 // EXTERNALS //////////////////////////////////////////////////////////////////////////////////////
 extern Radar *TheRadar;  ///< the radar singleton extern
 
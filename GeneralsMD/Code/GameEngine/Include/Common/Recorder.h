@@ -88,6 +88,8 @@ class RecorderClass : public SubsystemInterface {
 
 public:
 	void handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool fromPlayback);
+	Bool sawCRCMismatch( void );											///< has the current playback gone out of sync with its recorded CRCs?
+	UnsignedInt getPlaybackCRCDigest( UnsignedInt *numCRCs, UnsignedInt *lastCRC );	///< digest of the (frame, CRC) pairs checked during playback
 protected:
 	CRCInfo *m_crcInfo;
 public:
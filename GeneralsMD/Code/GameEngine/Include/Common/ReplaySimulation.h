@@ -0,0 +1,59 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ReplaySimulation.h /////////////////////////////////////////////////////////
+// Runs a recorded replay through the game logic as fast as possible with no
+// rendering, audio or frame limiting, and reports the CRC stream and timings.
+// Used for determinism checks and logic profiling.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef _REPLAY_SIMULATION_H_
+#define _REPLAY_SIMULATION_H_
+
+#include "Lib/BaseType.h"
+
+class AsciiString;
+
+//-------------------------------------------------------------------------------------------------
+/** Drives TheGameEngine through a replay without entering the normal main loop.  The engine
+	* must already be initialized with TheGlobalData->m_headless set so that the client skips
+	* all drawing. */
+//-------------------------------------------------------------------------------------------------
+class ReplaySimulation
+{
+public:
+
+	/// Play back 'filename' (relative to the replay directory) to the end.  Returns 0 on success,
+	/// 1 if the replay could not be played or went out of sync with its recorded CRCs.
+	static Int simulateReplay( const AsciiString& filename );
+
+};
+
+#endif // _REPLAY_SIMULATION_H_
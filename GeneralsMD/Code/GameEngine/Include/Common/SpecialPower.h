@@ -46,6 +46,7 @@
 // USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
 #include "Common/AudioEventRTS.h"
 #include "Common/GameMemory.h"
+#include "Common/NameKeyRegistry.h"
 #include "Common/SubsystemInterface.h"
 #include "Lib/BaseType.h"
 #include "Common/BitFlags.h"
@@ -194,6 +195,7 @@ class SpecialPowerStore : public SubsystemInterface
 
 	typedef std::vector<SpecialPowerTemplate *> SpecialPowerTemplatePtrVector;
 	SpecialPowerTemplatePtrVector m_specialPowerTemplates;			///< the special power templates
+	NameKeyRegistry<SpecialPowerTemplate> m_specialPowerIndex;	///< m_specialPowerTemplates by name key
 
 	UnsignedInt m_nextSpecialPowerID;
 
@@ -319,7 +319,7 @@ class Team : public MemoryPoolObject,
 	/** 
 		Set the team as active.  A team is considered created when set active.
 	*/
-	void setActive(void) {if (!m_active) { m_created = true;m_active = true;}}
+	void setActive(void);
 
 	/** 
 		Is this team active?
@@ -709,6 +709,9 @@ class TeamFactory : public SubsystemInterface,
 	/// return the TeamPrototype with the given name. if none exists, return null.
 	TeamPrototype *findTeamPrototype(const AsciiString& name);
 
+	/// return the TeamPrototype whose name has the given key. if none exists, return null.
+	TeamPrototype *findTeamPrototypeByNameKey(NameKeyType nameKey);
+
 	/// return TeamPrototype with matching ID.  if none exists NULL is returned
 	TeamPrototype *findTeamPrototypeByID( TeamPrototypeID id );
 
@@ -420,6 +420,9 @@ class ThingTemplate : public Overridable
 	{
 		return TEST_KINDOFMASK_ANY(m_kindof, anyKindOf);
 	}
+
+	/// the whole kindof mask, for callers that keep their own copy.
+	inline const KindOfMaskType& getKindOfMask() const { return m_kindof; }
 	
 	/// set the display name
 	const UnicodeString& getDisplayName() const { return m_displayName; }  ///< return display name
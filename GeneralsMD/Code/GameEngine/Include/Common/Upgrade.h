@@ -45,6 +45,7 @@
 // USER INCLUDES //////////////////////////////////////////////////////////////////////////////////
 #include "Common/AudioEventRTS.h"
 #include "Common/INI.h"
+#include "Common/NameKeyRegistry.h"
 #include "Common/Snapshot.h"
 
 // FORWARD REFERENCES /////////////////////////////////////////////////////////////////////////////
@@ -268,6 +269,7 @@ class UpgradeCenter : public SubsystemInterface
 	void unlinkUpgrade( UpgradeTemplate *upgrade );		///< remove upgrade from list
 
 	UpgradeTemplate *m_upgradeList;										///< list of all upgrades we can have
+	NameKeyRegistry<UpgradeTemplate> m_upgradeIndex;	///< the linked upgrades by name key
 	Int m_nextTemplateMaskBit;												///< Each instantiated UpgradeTemplate will be given a Int64 bit as an identifier
 	Bool buttonImagesCached;
 
@@ -0,0 +1,96 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// WorkerThreadPool.h /////////////////////////////////////////////////////////
+// A small fixed pool of worker threads that run batches of independent jobs.
+// The calling thread takes part in each batch and run() doesn't return until
+// every job in it has finished.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef _WORKER_THREAD_POOL_H_
+#define _WORKER_THREAD_POOL_H_
+
+#include "Lib/BaseType.h"
+
+//-------------------------------------------------------------------------------------------------
+class WorkerThreadPool
+{
+
+public:
+
+	enum
+	{
+		MAX_WORKER_THREADS = 7,
+		MAX_THREAD_SLOTS = MAX_WORKER_THREADS + 1		///< slot 0 is whichever thread isn't a worker
+	};
+
+	typedef void (*JobProc)( void *userData, Int jobIndex );
+
+	WorkerThreadPool( Int numThreads );
+	~WorkerThreadPool();
+
+	Int getNumThreads( void ) const { return m_numThreads; }
+
+	/// Call proc(userData, i) for every i in [0, numJobs), spread across the workers and the calling
+	/// thread, and return once they have all finished.  Jobs must not depend on each other.
+	void run( JobProc proc, void *userData, Int numJobs );
+
+	/// 0 on any thread that isn't one of our workers, 1..MAX_WORKER_THREADS on a worker.
+	/// Lets shared code keep per-thread scratch state.
+	static Int getThreadSlot( void );
+
+private:
+
+	static unsigned __stdcall threadProc( void *param );
+	void runJobs( void );
+
+	struct WorkerInfo
+	{
+		WorkerThreadPool *m_pool;
+		Int m_slot;
+		void *m_thread;			///< HANDLE
+		void *m_startEvent;	///< HANDLE, auto reset
+	};
+
+	WorkerInfo m_workers[ MAX_WORKER_THREADS ];
+	Int m_numThreads;
+	void *m_doneEvent;		///< HANDLE, auto reset, set by the last worker to finish a batch
+	Bool m_quitting;
+
+	// the current batch
+	JobProc m_proc;
+	void *m_userData;
+	Int m_numJobs;
+	volatile long m_nextJob;
+	volatile long m_workersBusy;
+
+};
+
+#endif // _WORKER_THREAD_POOL_H_
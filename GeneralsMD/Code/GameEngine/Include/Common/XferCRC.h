@@ -70,6 +70,11 @@ class XferCRC : public Xfer
 	// Xfer CRC methods
 	virtual UnsignedInt getCRC( void );										///< get computed CRC in network byte order
 
+	// incremental CRC support, lets a snapshot replay the words it fed us last time instead of xfering again
+	void beginCapture( UnsignedInt *buffer, Int maxWords );		///< also record every word added to the CRC into 'buffer'
+	Int endCapture( void );																		///< stop recording, returns words recorded or -1 if 'buffer' overflowed
+	void addCapturedCRC( const UnsignedInt *words, Int count );	///< add words recorded by an earlier capture
+
 protected:
 
 	virtual void xferImplementation( void *data, Int dataSize );
@@ -78,6 +83,10 @@ class XferCRC : public Xfer
 
 	UnsignedInt m_crc;
 
+	UnsignedInt *m_captureBuffer;									///< if not NULL, words added to the CRC are recorded here too
+	Int m_captureMax;
+	Int m_captureCount;
+
 };
 
 #endif // __XFERDISKWRITE_H_
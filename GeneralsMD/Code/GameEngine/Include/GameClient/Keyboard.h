@@ -174,6 +174,22 @@ class Keyboard : public SubsystemInterface
 
 };  // end Keyboard
 
+//=============================================================================
+/** Keyboard that never has a key down, for -headless runs */
+//=============================================================================
+class KeyboardDummy : public Keyboard
+{
+
+public:
+
+	virtual Bool getCapsState( void ) { return FALSE; }
+
+protected:
+
+	virtual void getKey( KeyboardIO *key ) { key->sequence = 0; key->key = KEY_NONE; }
+
+};  // end KeyboardDummy
+
 // INLINING ///////////////////////////////////////////////////////////////////
 
 // EXTERNALS //////////////////////////////////////////////////////////////////
@@ -381,6 +381,25 @@ class Mouse : public SubsystemInterface
 
 };  // end class Mouse
 
+//=============================================================================
+/** Mouse that never moves or clicks, for -headless runs */
+//=============================================================================
+class MouseDummy : public Mouse
+{
+
+public:
+
+	virtual void initCursorResources( void ) { }
+	virtual void setCursor( MouseCursor cursor ) { }
+	virtual void capture( void ) { }
+	virtual void releaseCapture( void ) { }
+
+protected:
+
+	virtual UnsignedByte getMouseEvent( MouseIO *result, Bool flush ) { return MOUSE_NONE; }
+
+};  // end class MouseDummy
+
 // INLINING ///////////////////////////////////////////////////////////////////
 
 // EXTERNALS //////////////////////////////////////////////////////////////////
@@ -71,6 +71,18 @@ enum ParticleSystemID
 	INVALID_PARTICLE_SYSTEM_ID = 0
 };
 
+namespace rts
+{
+	template<> struct hash<ParticleSystemID>
+	{
+		size_t operator()(ParticleSystemID id) const
+		{ 
+			std::hash<UnsignedInt> tmp;
+			return tmp((UnsignedInt)id);
+		}
+	};
+}
+
 #define MAX_VOLUME_PARTICLE_DEPTH ( 16 )
 #define DEFAULT_VOLUME_PARTICLE_DEPTH ( 0 )//The Default is not to do the volume thing!
 #define OPTIMUM_VOLUME_PARTICLE_DEPTH ( 6 )
@@ -180,15 +192,14 @@ class Particle : public MemoryPoolObject,
 
 	Particle( ParticleSystem *system, const ParticleInfo *data );
 
-	inline Bool update( void );												///< update this particle's behavior - return false if dead
-	void doWindMotion( void );									///< do wind motion (if present) from particle system
+	inline Bool update( void );												///< finish this frame's update after the system integrated motion - return false if dead
 
 	void applyForce( const Coord3D *force );		///< add the given acceleration
 
-	inline const Coord3D *getPosition( void ) { return &m_pos; }
-	inline Real getSize( void ) { return m_size; }
+	inline const Coord3D *getPosition( void );
+	inline Real getSize( void );
 	inline Real getAngle( void ) { return m_angleZ; }
-	inline Real getAlpha( void ) { return m_alpha; }
+	inline Real getAlpha( void );
 	inline const RGBColor *getColor( void ) { return &m_color; }
 	inline void setColor( RGBColor *color ) { m_color = *color; }
 
@@ -215,6 +226,9 @@ class Particle : public MemoryPoolObject,
 	void computeAlphaRate( void );							///< compute alpha rate to get to next key
 	void computeColorRate( void );							///< compute color change to get to next key
 
+	void copyStateToInfo( void );								///< copy our slot in the system arrays into the ParticleInfo fields
+	void copyInfoToState( void );								///< copy the ParticleInfo fields into our slot in the system arrays
+
 public:
 	Particle *				m_systemNext;
 	Particle *				m_systemPrev;
@@ -225,15 +239,15 @@ class Particle : public MemoryPoolObject,
 	ParticleSystem *	m_system;										///< the particle system this particle belongs to
 	UnsignedInt				m_personality;							    ///< each new particle assigned a number one higher than the previous
 
-	// most of the particle data is derived from ParticleInfo
+	// most of the particle data is derived from ParticleInfo.  The fields the per-frame integrator
+	// touches (position, velocity, acceleration, size, alpha) live in the owning system's arrays
+	// instead, at index m_slot; the ParticleInfo copies are only used for creation and xfer.
+	Int								m_slot;															///< index of this particle in the system's state arrays
 
-	Coord3D						m_accel;														///< current acceleration
 	Coord3D						m_lastPos;													///< previous position
 	UnsignedInt				m_lifetimeLeft;									///< lifetime remaining, if zero -> destroy
 	UnsignedInt				m_createTimestamp;							///< frame this particle was created
 
-	Real							m_alpha;																///< current alpha of this particle
-	Real							m_alphaRate;														///< current rate of alpha change
 	Int								m_alphaTargetKey;												///< next index into key array
 
 	RGBColor					m_color;														///< current color of this particle
@@ -626,6 +640,7 @@ class ParticleSystem : public MemoryPoolObject,
 	// @todo Const this jkmcd
 	Particle *getFirstParticle( void ) { return m_systemParticlesHead; }
 
+	/// add the particle to our list and give it a slot in the state arrays
 	void addParticle( Particle *particleToAdd );
 	/// when a particle dies, it calls this method - ONLY FOR USE BY PARTICLE
 	void removeParticle( Particle *p );
@@ -661,7 +676,12 @@ class ParticleSystem : public MemoryPoolObject,
 	const Coord3D *computeParticleVelocity( const Coord3D *pos );	///< compute a velocity vector based on emission properties
 	const Coord3D *computePointOnUnitSphere( void );	///< compute a random point on a unit sphere
 
+	void integrateParticles( void );						///< advance motion, wind, size and alpha of all particles, one stage at a time
+	void doWindMotion( void );									///< integrate the wind (if present) into all particle positions
+
 protected:
+	friend class Particle;
+
 	Particle *				m_systemParticlesHead;
 	Particle *				m_systemParticlesTail;
 
@@ -710,12 +730,35 @@ class ParticleSystem : public MemoryPoolObject,
 	Bool							m_isSaveable;													///< true if this system should be saved/loaded
   Bool              m_skipParentXfrm;                     ///< true if this system is already in world space.
 
+	//
+	// Per-particle state touched every frame, kept as parallel arrays so each integration stage
+	// is a single pass over contiguous memory.  Particle::m_slot indexes these; when a particle
+	// dies the last slot is moved into its place, so the arrays are always densely packed.  Render
+	// order and removal order still come from the particle lists above.
+	//
+	std::vector<Particle *>	m_particleSlots;							///< the particle owning each slot
+	std::vector<Coord3D>		m_particlePos;								///< current position
+	std::vector<Coord3D>		m_particleVel;								///< current velocity
+	std::vector<Coord3D>		m_particleAccel;							///< acceleration accumulated this frame
+	std::vector<Real>				m_particleVelDamping;					///< velocity is multiplied by this every frame
+	std::vector<Real>				m_particleSize;								///< current size
+	std::vector<Real>				m_particleSizeRate;						///< current rate of size change
+	std::vector<Real>				m_particleSizeRateDamping;		///< size rate is multiplied by this every frame
+	std::vector<Real>				m_particleAlpha;							///< current alpha
+	std::vector<Real>				m_particleAlphaRate;					///< current rate of alpha change
+	std::vector<Real>				m_particleWindRandomness;			///< multiplier for wind randomness
+
 
 	// the actual particle system data is inherited from ParticleSystemInfo
 
 };
 
 
+//--------------------------------------------------------------------------------------------------------------
+inline const Coord3D *Particle::getPosition( void ) { return &m_system->m_particlePos[ m_slot ]; }
+inline Real Particle::getSize( void ) { return m_system->m_particleSize[ m_slot ]; }
+inline Real Particle::getAlpha( void ) { return m_system->m_particleAlpha[ m_slot ]; }
+
 //--------------------------------------------------------------------------------------------------------------
 /**
  * The particle system manager, responsible for maintaining all ParticleSystems
@@ -728,6 +771,7 @@ class ParticleSystemManager : public SubsystemInterface,
 
 	typedef std::list<ParticleSystem*> ParticleSystemList;
 	typedef std::list<ParticleSystem*>::iterator ParticleSystemListIt;
+	typedef std::hash_map<ParticleSystemID, ParticleSystem *, rts::hash<ParticleSystemID>, rts::equal_to<ParticleSystemID> > ParticleSystemIDMap;
 	typedef std::hash_map<AsciiString, ParticleSystemTemplate *, rts::hash<AsciiString>, rts::equal_to<AsciiString> > TemplateMap;
 
 	ParticleSystemManager( void );
@@ -806,6 +850,9 @@ class ParticleSystemManager : public SubsystemInterface,
 	ParticleSystemID m_uniqueSystemID;					///< unique system ID to assign to each system created
 
 	ParticleSystemList m_allParticleSystemList;
+	ParticleSystemIDMap m_systemIDMap;					///< every system in m_allParticleSystemList, keyed by its ID
+
+	void rebuildSystemIDMap( void );						///< re-key m_systemIDMap from the IDs the systems currently have
 
 	UnsignedInt m_particleCount;
 	UnsignedInt m_fieldParticleCount; ///< this does not need to be xfered, since it is evaluated every frame
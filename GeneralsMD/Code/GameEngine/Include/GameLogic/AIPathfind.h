@@ -228,8 +228,17 @@ class PathfindCellInfo
 	static PathfindCellInfo *s_infoArray;
 	static PathfindCellInfo *s_firstFree;							///< 
 
+	static PathfindCellInfo **s_openHeap;							///< Binary min-heap of cells on the A* "open" list.
+	static Int s_openHeapCount;												///< Number of cells in s_openHeap.
+	static UnsignedInt s_openSequence;								///< Insertion counter, breaks cost ties in insertion order.
 
-	PathfindCellInfo *m_nextOpen, *m_prevOpen;						///< for A* "open" list, shared by closed list
+	static Bool openHeapLess(const PathfindCellInfo *a, const PathfindCellInfo *b);
+	static void openHeapSiftUp(Int ndx);
+	static void openHeapSiftDown(Int ndx);
+
+	PathfindCellInfo *m_nextOpen, *m_prevOpen;						///< for A* "closed" list
+	Int m_heapIndex;																		///< Index in s_openHeap while on the "open" list, else -1.
+	UnsignedInt m_openSequence;													///< Value of s_openSequence when put on the "open" list.
 
 	PathfindCellInfo *m_pathParent;												///< "parent" cell from pathfinder
 	PathfindCell *m_cell;															///< Cell this info belongs to currently.
@@ -310,10 +319,10 @@ class PathfindCell
 
 	UnsignedInt costSoFar( PathfindCell *parent );
 
-	/// put self on "open" list in ascending cost order, return new list
+	/// put self on "open" heap, return the lowest cost cell on the heap
 	PathfindCell *putOnSortedOpenList( PathfindCell *list );		
 
-	/// remove self from "open" list
+	/// remove self from "open" heap, return the lowest cost cell on the heap
 	PathfindCell *removeFromOpenList( PathfindCell *list );		
 
 	/// put self on "closed" list, return new list
@@ -325,9 +334,14 @@ class PathfindCell
 	/// remove all cells from closed list.
 	static Int releaseClosedList( PathfindCell *list );	
 
-	/// remove all cells from closed list.
+	/// remove all cells from open list.
 	static Int releaseOpenList( PathfindCell *list );	
 
+	/// Number of cells on the open heap, and access to them in heap (not cost) order.
+	static Int getOpenListCount(void);
+	static PathfindCell *getOpenListCell(Int ndx);
+
+	/// Next cell on the closed list.
 	inline PathfindCell *getNextOpen(void) {return m_info->m_nextOpen?m_info->m_nextOpen->m_cell:NULL;}
 
 	inline UnsignedShort getXIndex(void) const {return m_info->m_pos.x;}
@@ -498,6 +512,23 @@ class ZoneBlock
 };
 typedef ZoneBlock *ZoneBlockP;
 
+/**
+ * Identifies a hierarchical search for the corridor cache.  Cached searches run between fixed
+ * cells picked from the start and goal block zones, so while the zones are unchanged two 
+ * searches with the same key find the same block corridor.
+ */
+struct HierarchicalCorridorKey
+{
+	ICoord2D									m_startBlock;			///< Zone block containing the start cell.
+	ICoord2D									m_goalBlock;			///< Zone block containing the goal cell.
+	zoneStorageType						m_startZone;			///< Block zone of the start cell.
+	zoneStorageType						m_goalZone;				///< Block zone of the goal cell.
+	LocomotorSurfaceTypeMask	m_surfaces;				///< Surfaces the searching locomotor can use.
+	Bool											m_crusher;
+	Bool											m_isHuman;				///< Human searches are limited to the logical extent.
+	Bool											m_closestOK;			///< Search accepts the closest reachable block.
+};
+
 /**
  * This class manages the zones in the map.  A zone is an area in the map that
  * is one contiguous type of terrain (clear, cliff, water, building).  If 
@@ -543,10 +574,16 @@ class PathfindZoneManager
 	void setBridge(Int cellX, Int cellY, Bool bridge);
 	Bool interactsWithBridge(Int cellX, Int cellY) const; 
 
+	Bool applyCachedCorridor(const HierarchicalCorridorKey &key, Bool &found, Int &cellCount);	///< If a search is cached for key, marks its corridor passable and returns true.
+	void cacheCorridor(const HierarchicalCorridorKey &key, Bool found, Int cellCount);	///< Caches the currently passable blocks (the path, before the start is widened) as the corridor for key.
+	void invalidateCorridors(void);		///< Discards all cached corridors.  Called whenever zones change.
+
 private:
 	void allocateZones(void);
 	void freeZones(void);
 	void freeBlocks(void);
+	void allocateCorridors(void);
+	void freeCorridors(void);
 
 private:
 	ZoneBlock			*m_blockOfZoneBlocks;			///< Zone blocks - Info for hierarchical pathfinding at a "blocky" level.
@@ -562,6 +599,16 @@ class PathfindZoneManager
 	zoneStorageType *m_terrainZones;
 	zoneStorageType *m_crusherZones;
 	zoneStorageType *m_hierarchicalZones;
+
+	// Hierarchical corridor cache.  Replaced round robin, so it behaves the same on every machine.
+	enum {CORRIDOR_CACHE_SIZE = 32};
+	HierarchicalCorridorKey m_corridorKeys[CORRIDOR_CACHE_SIZE];
+	Bool					m_corridorFound[CORRIDOR_CACHE_SIZE];	///< False if the search found no path.
+	Int						m_corridorCells[CORRIDOR_CACHE_SIZE];	///< Pathfind cells the search examined.
+	UnsignedByte	*m_corridorBits;					///< CORRIDOR_CACHE_SIZE passable bit arrays of m_corridorBytes each.
+	Int						m_corridorBytes;					///< Bytes per corridor, 1 bit per zone block.
+	Int						m_numCorridors;						///< Number of valid cached corridors.
+	Int						m_nextCorridor;						///< Next cache slot to replace.
 };
 
 /** 
@@ -746,6 +793,9 @@ class Pathfinder : PathfindServicesInterface, public Snapshot
 	Path *findHierarchicalPath( Bool isHuman, const LocomotorSet& locomotorSet, const Coord3D *from, const Coord3D *to, Bool crusher);	
 	Path *findClosestHierarchicalPath( Bool isHuman, const LocomotorSet& locomotorSet, const Coord3D *from, const Coord3D *to, Bool crusher);	
 	Path *internal_findHierarchicalPath( Bool isHuman, const LocomotorSurfaceTypeMask locomotorSurface, const Coord3D *from, const Coord3D *to, Bool crusher, Bool closestOK);	
+	Bool markHierarchicalCorridor( Bool isHuman, const LocomotorSurfaceTypeMask locomotorSurface, const Coord3D *from, const Coord3D *to, Bool crusher, Bool closestOK);	///< Marks the zone blocks the low level search may expand.  Returns false if it had to mark all blocks.
+	void markBlocksAroundStart( const Coord3D *pos );	///< Marks the zone blocks next to the start of a path passable.
+	Bool findCorridorCell( const ICoord2D &block, zoneStorageType zone, const LocomotorSurfaceTypeMask locomotorSurface, Bool crusher, Coord3D *pos );	///< Finds the first ground cell in block with the given block zone.
 	void processHierarchicalCell( const ICoord2D &scanCell, const ICoord2D &deltaPathfindCell,
 																PathfindCell *parentCell, 
 																PathfindCell *goalCell, zoneStorageType parentZone, 
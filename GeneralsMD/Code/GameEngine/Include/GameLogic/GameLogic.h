@@ -76,6 +76,7 @@ class WindowLayout;
 class TerrainLogic;
 class GhostObjectManager;
 class CommandButton;
+class WorkerThreadPool;
 enum BuildableStatus;
 
 
@@ -283,6 +284,7 @@ class GameLogic : public SubsystemInterface, public Snapshot
 	Int rebalanceChildSleepyUpdate(Int i);
 	void remakeSleepyUpdate();
 	void validateSleepyUpdate() const;
+	void gatherPhaseParallelUpdates(UnsignedInt now, SleepyUpdatePhase phase);
 
 private:
 
@@ -346,6 +348,10 @@ class GameLogic : public SubsystemInterface, public Snapshot
 
 	UpdateModulePtr					 m_curUpdateModule;
 
+	WorkerThreadPool*									m_workerThreadPool;				///< optional helpers for phase-parallel gathers (NULL == run inline)
+	std::vector<UpdateModulePtr>			m_phaseParallelUpdates;		///< scratch: modules gathered for the current phase
+	std::vector<Int>									m_phaseParallelSearch;		///< scratch: heap indices left to visit while gathering
+
 	ObjectPointerList m_objectsToDestroy;										///< List of things that need to be destroyed at end of frame
 
 	ObjectID m_nextObjID;																		///< For allocating object id's
@@ -44,6 +44,7 @@
 
 // INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
 #include "Common/NameKeyGenerator.h"
+#include "Common/NameKeyRegistry.h"
 #include "Common/Override.h"
 #include "Common/Snapshot.h"
 #include "GameLogic/Damage.h"
@@ -507,7 +508,7 @@ class LocomotorStore : public SubsystemInterface
 
 private:
 
-	typedef std::map< NameKeyType, LocomotorTemplate*, std::less<NameKeyType> > LocomotorTemplateMap;
+	typedef NameKeyRegistry<LocomotorTemplate> LocomotorTemplateMap;
 
 	LocomotorTemplateMap m_locomotorTemplates;
 
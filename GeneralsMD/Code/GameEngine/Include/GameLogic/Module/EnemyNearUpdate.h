@@ -85,12 +85,17 @@ class EnemyNearUpdate : public UpdateModule
 	// virtual destructor prototype provided by memory pool declaration
 
 	virtual UpdateSleepTime update();
+	virtual Bool isPhaseParallel() const { return TRUE; }
+	virtual void gatherPhaseParallel();
 
 protected:
 
 	UnsignedInt m_enemyScanDelay;
 	Bool m_enemyNear;
 
+	UnsignedInt m_gatheredFrame;		///< frame m_gatheredEnemyNear was scanned on (not saved)
+	Bool m_gatheredEnemyNear;				///< result of the scan done in gatherPhaseParallel()
+
 	void checkForEnemies( void );
 
 };
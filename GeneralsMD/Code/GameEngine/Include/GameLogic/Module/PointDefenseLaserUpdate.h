@@ -86,16 +86,24 @@ class PointDefenseLaserUpdate : public UpdateModule
 
 	virtual void onObjectCreated();
 	virtual UpdateSleepTime update();
+	virtual Bool isPhaseParallel() const { return TRUE; }
+	virtual void gatherPhaseParallel();
 
 	Object* scanClosestTarget();
 	void fireWhenReady();
 
 protected:
 
+	Object* findClosestTarget( Bool *inRange ) const;
+
 	ObjectID m_bestTargetID;
 	Bool m_inRange;
 	Int m_nextScanFrames;
 	Int m_nextShotAvailableInFrames;
+
+	UnsignedInt m_gatheredFrame;		///< frame m_gatheredTargetID was scanned on (not saved)
+	ObjectID m_gatheredTargetID;		///< result of the scan done in gatherPhaseParallel()
+	Bool m_gatheredInRange;
 };
 
 
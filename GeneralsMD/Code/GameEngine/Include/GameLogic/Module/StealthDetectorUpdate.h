@@ -102,10 +102,18 @@ class StealthDetectorUpdate : public UpdateModule
 	void setSDEnabled( Bool enabled );
 	virtual UpdateSleepTime update();
 	virtual DisabledMaskType getDisabledTypesToProcess() const { return MAKE_DISABLED_MASK( DISABLED_HELD ); }
+	virtual Bool isPhaseParallel() const { return TRUE; }
+	virtual void gatherPhaseParallel();
 
 private:
+	Bool canDetectFromContainer() const;
+	void findStealthed( std::vector<ObjectID>& found ) const;
+
 	Bool m_enabled;
 
+	UnsignedInt m_gatheredFrame;				///< frame m_stealthed was scanned on in gatherPhaseParallel() (not saved)
+	std::vector<ObjectID> m_stealthed;	///< stealthed or stealth-garrisoned objects in range, scratch for update()
+
 };
 
 
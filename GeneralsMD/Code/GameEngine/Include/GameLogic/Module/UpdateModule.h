@@ -111,6 +111,9 @@ class UpdateModuleInterface
 
 	virtual DisabledMaskType getDisabledTypesToProcess() const = 0;
 
+	virtual Bool isPhaseParallel() const = 0;
+	virtual void gatherPhaseParallel() = 0;
+
 #ifdef DIRECT_UPDATEMODULE_ACCESS
 	// these aren't in the interface; they are in the implementation, 
 	// because making them virtual is simply too much overhead. 
@@ -190,6 +193,27 @@ class UpdateModule : public BehaviorModule, public UpdateModuleInterface
 		return DISABLEDMASK_NONE; 
 	}
 
+	/*
+		Phase-parallel modules split their work in two. Before the first update()
+		of each phase, GameLogic calls gatherPhaseParallel() on every such module
+		due in that phase, spread across the logic worker threads. update() then
+		runs in the usual order on the main thread and applies what was gathered.
+
+		gatherPhaseParallel() may only read shared game state (partition queries,
+		object getters and the like) and write members of its own module. No
+		random numbers, no allocating or destroying objects, no messages. Since
+		the gathers can't affect each other, the result is the same whether they
+		run on one thread or eight.
+
+		update() must still work if it wasn't gathered first, e.g. when woken in
+		the middle of a phase or on the frame after a load. A gathered result 
+		sees the state at the start of the phase, so the gathers always run, 
+		with or without worker threads; -logicThreads only decides who does
+		the work, never what it finds.
+	*/
+	virtual Bool isPhaseParallel() const { return FALSE; }
+	virtual void gatherPhaseParallel() { }
+
 #ifdef DIRECT_UPDATEMODULE_ACCESS
 	#define UPDATEMODULE_FRIEND_DECLARATOR __forceinline
 #else
@@ -108,6 +108,7 @@ class UpdateModuleInterface;
 class UpgradeModule;
 class UpgradeModuleInterface;
 class UpgradeTemplate;
+class XferCRC;
 
 class ObjectHeldHelper;
 class ObjectDisabledHelper;
@@ -191,6 +192,10 @@ class Object : public Thing, public Snapshot
 
 	void updateObjValuesFromMapProperties(Dict* properties);			///< Brings in properties set in the editor.
 
+	// incremental CRC
+	void markCRCDirty() { m_crcCacheCount = -1; }									///< something crc() covers has changed, recompute our CRC words next time
+	void friend_xferIncrementalCRC( XferCRC *xfer );							///< crc() using cached words where we can. for use ONLY by GameLogic::getCRC!
+
 	// ids and binding
 	ObjectID getID() const { return m_id; }												///< this object's unique ID
 	void friend_bindToDrawable( Drawable *draw );									///< set drawable association. for use ONLY by GameLogic!
@@ -297,6 +302,13 @@ class Object : public Thing, public Snapshot
 
 	BehaviorModule** getBehaviorModules() const { return m_behaviors; }
 
+	// the modules that implement each notification interface, in module order and NULL terminated
+	DamageModuleInterface** getDamageModules() const { return m_damageModules; }
+	DieModuleInterface** getDieModules() const { return m_dieModules; }
+	UpgradeModuleInterface** getUpgradeModules() const { return m_upgradeModules; }
+	CollideModuleInterface** getCollideModules() const { return m_collideModules; }
+	SpecialPowerModuleInterface** getSpecialPowerModules() const { return m_specialPowerModules; }
+
 	BodyModuleInterface* getBodyModule() const { return m_body; }
 	ContainModuleInterface* getContain() const { return m_contain; }
   StealthUpdate*          getStealth() const { return m_stealth; }
@@ -655,6 +667,9 @@ class Object : public Thing, public Snapshot
 	void xfer( Xfer *xfer );
 	void loadPostProcess();
 
+	void crcState( Xfer *xfer );					///< the part of crc() that is cached between CRC frames
+	void crcWeapons( Xfer *xfer );				///< the part of crc() each Weapon caches for itself
+
 	void handleShroud();
 	void handleValueMap();
 	void handleThreatMap();
@@ -690,6 +705,8 @@ class Object : public Thing, public Snapshot
 
 	virtual void reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle);
 
+	void buildModuleInterfaceLists();		///< fill in the per-interface module lists from m_behaviors
+
 private:
 
 	// yes, private. No, really. Private. Don't expose.
@@ -748,6 +765,14 @@ class Object : public Thing, public Snapshot
 	// modules
 	BehaviorModule**							m_behaviors;	// BehaviorModule, not BehaviorModuleInterface
 
+	// per-interface views of m_behaviors, built once at creation, so the notification loops only
+	// visit the modules that can respond. (the entries are duplicates of the module array!)
+	DamageModuleInterface**				m_damageModules;
+	DieModuleInterface**					m_dieModules;
+	UpgradeModuleInterface**			m_upgradeModules;
+	CollideModuleInterface**			m_collideModules;
+	SpecialPowerModuleInterface**	m_specialPowerModules;
+
 	// cache these, for convenience
 	ContainModuleInterface*				m_contain;
 	BodyModuleInterface*					m_body;
@@ -785,6 +810,11 @@ class Object : public Thing, public Snapshot
 
 	SpecialPowerMaskType					m_specialPowerBits; ///< bits determining what kind of special abilities this object has access to.
 
+	// CRC words crcState() produced last time, replayed while nothing it covers has changed
+	enum { CRC_CACHE_WORDS = 24 };
+	UnsignedInt										m_crcCache[ CRC_CACHE_WORDS ];
+	Int														m_crcCacheCount;		///< words in m_crcCache, -1 if dirty
+
 	//////////////////////////////////////< for the non-stacking healers like ambulance and propaganda
 	ObjectID m_soleHealingBenefactorID; ///< who is the only other object that can give me this non-stacking heal benefit?
 	UnsignedInt m_soleHealingBenefactorExpirationFrame; ///< on what frame can I accept healing (thus to switch) from a new benefactor
@@ -68,6 +68,7 @@
 #include "Common/KindOf.h"
 #include "Common/Snapshot.h"
 #include "Common/Geometry.h"
+#include "Common/WorkerThreadPool.h"
 #include "GameClient/Display.h"	// for ShroudLevel
 
 //-----------------------------------------------------------------------------
@@ -205,6 +206,7 @@ class CellAndObjectIntersection	// not MPO: we allocate these in arrays
 	PartitionCell							*m_cell;									///< the cell being touched
 	PartitionData							*m_module;								///< the module (and thus, Object) touching
 	CellAndObjectIntersection *m_prevCoi, *m_nextCoi;		///< if in use, next/prev in this cell. if not in use, next/prev free in this module.
+	Int												m_queryIndex;							///< if in use, our slot in the cell's query arrays.
 
 public:
 
@@ -248,6 +250,8 @@ class CellAndObjectIntersection	// not MPO: we allocate these in arrays
 	// only for use by PartitionCell.
 	void friend_addToCellList(CellAndObjectIntersection **pListHead);
 	void friend_removeFromCellList(CellAndObjectIntersection **pListHead);
+	inline Int friend_getQueryIndex() const { return m_queryIndex; }
+	inline void friend_setQueryIndex(Int i) { m_queryIndex = i; }
 };
 
 /**
@@ -318,6 +322,25 @@ class PartitionCell : public Snapshot	// not MPO: allocated in an array
 	Short													m_cellX;						///< x-coord of this cell within the Partition Mgr coords (NOT in world coords)
 	Short													m_cellY;						///< y-coord of this cell within the Partition Mgr coords (NOT in world coords)
 
+	/*
+		A compact copy of the COI list, kept in structure-of-arrays form so that range queries
+		can reject by distance, kindof, player and relationship in a tight loop without touching 
+		the PartitionData or Object. Entries are appended as COIs are added and removed by moving
+		the last entry into the hole, so their order is deterministic but is NOT the order of the
+		COI list.
+	*/
+	std::vector<CellAndObjectIntersection*>	m_queryCoi;			///< the COI for each entry
+	std::vector<PartitionData*>							m_queryModule;	///< the module for each entry
+	std::vector<Real>												m_queryPosX;		///< object x for each entry
+	std::vector<Real>												m_queryPosY;		///< object y for each entry
+	std::vector<Real>												m_queryRadius;	///< larger of the object's bounding circle and sphere radii
+	std::vector<KindOfMaskType>							m_queryKindOf;	///< the object's kindof mask for each entry
+	std::vector<const Team*>								m_queryTeam;		///< the object's team (and thus player) for each entry
+	std::vector<UnsignedByte>								m_queryDefector;///< nonzero if the object is an undetected defector
+
+	void setQueryEntry(Int i, const PartitionData *module);
+	void moveQueryEntry(Int dst, Int src);
+
 public:
 
 	// Note, we allocate these in arrays, thus we must have a default ctor (and NOT descend from MPO)
@@ -364,6 +387,15 @@ class PartitionCell : public Snapshot	// not MPO: allocated in an array
 
 	inline CellAndObjectIntersection *getFirstCoiInCell() { return m_firstCoiInCell; }
 
+	// the compact query arrays. (only valid if getCoiCount() > 0.)
+	inline PartitionData* const* getQueryModules() const { return &m_queryModule[0]; }
+	inline const Real *getQueryPosX() const { return &m_queryPosX[0]; }
+	inline const Real *getQueryPosY() const { return &m_queryPosY[0]; }
+	inline const Real *getQueryRadius() const { return &m_queryRadius[0]; }
+	inline const KindOfMaskType *getQueryKindOf() const { return &m_queryKindOf[0]; }
+	inline const Team* const* getQueryTeams() const { return &m_queryTeam[0]; }
+	inline const UnsignedByte *getQueryDefector() const { return &m_queryDefector[0]; }
+
 	#ifdef _DEBUG
 	void validateCoiList();
 	#endif
@@ -373,6 +405,9 @@ class PartitionCell : public Snapshot	// not MPO: allocated in an array
 
 	// intended only for CellAndObjectIntersection.
 	void friend_removeFromCellList(CellAndObjectIntersection *coi);
+
+	// intended only for CellAndObjectIntersection and PartitionData.
+	void friend_refreshQueryEntry(CellAndObjectIntersection *coi);
 };
 
 //=====================================
@@ -404,7 +439,7 @@ class PartitionData : public MemoryPoolObject
 	Int													m_coiArrayCount;					///< number of COIs allocated (may be more than are in use)
 	Int													m_coiInUseCount;					///< number of COIs that are actually in use
 	CellAndObjectIntersection		*m_coiArray;							///< The array of COIs 
-	Int													m_doneFlag;
+	Int													m_doneFlag[WorkerThreadPool::MAX_THREAD_SLOTS];	///< one per thread, so phase-parallel updates can search at once
 	DirtyStatus									m_dirtyStatus;
 	ObjectShroudStatus					m_shroudedness[MAX_PLAYER_COUNT];						
 	ObjectShroudStatus					m_shroudednessPrevious[MAX_PLAYER_COUNT];	///<previous frames value of m_shroudedness						
@@ -517,6 +552,9 @@ class PartitionData : public MemoryPoolObject
 	// if needToUpdateCells is false, we'll just do the collision testing.
 	void makeDirty(Bool needToUpdateCells);
 
+	/// copy the object's current position and radius into the query arrays of the cells we touch.
+	void refreshQueryEntries();
+
 	Bool isInNeedOfUpdatingCells() const { return m_dirtyStatus == NEED_CELL_UPDATE_AND_COLLISION_CHECK; }
 	Bool isInNeedOfCollisionCheck() const { return m_dirtyStatus != NOT_DIRTY; }
 
@@ -560,8 +598,8 @@ class PartitionData : public MemoryPoolObject
 
 	// these are only for use by getClosestObjects.
 	// (note, if we ever use other bits in this, smarten this up...)
-	Int friend_getDoneFlag() { return m_doneFlag; }
-	void friend_setDoneFlag(Int i) { m_doneFlag = i; }
+	Int friend_getDoneFlag(Int slot) { return m_doneFlag[slot]; }
+	void friend_setDoneFlag(Int slot, Int i) { m_doneFlag[slot] = i; }
 
 	inline Bool isInListDirtyModules(PartitionData* const* pListHead) const
 	{
@@ -592,6 +630,46 @@ class PartitionData : public MemoryPoolObject
 
 };
 
+//=====================================
+/**
+	The part of a query's filters that can be tested against a PartitionCell's compact 
+	query arrays, before the Object is touched. Filters add to it in addToPrefilter(); it 
+	only records conditions that their allow() insists on too, so rejecting with it never
+	changes what a query returns.
+*/
+class PartitionQueryPrefilter
+{
+public:
+	PartitionQueryPrefilter();
+
+	void addKindOf(const KindOfMaskType& mustBeSet, const KindOfMaskType& mustBeClear);
+	void addPlayer(const Player *player, Bool match);
+	void addRelationship(const Object *obj, Int allowFlags);
+
+	inline Bool hasTests() const { return m_testKindOf || m_testPlayer || m_testRelationship; }
+
+	/// false if an object with these properties can't get past the filters.
+	Bool allowEntry(const KindOfMaskType& kindOf, const Team *team, Bool undetectedDefector);
+
+private:
+	KindOfMaskType	m_kindOfMustBeSet;
+	KindOfMaskType	m_kindOfMustBeClear;
+	const Player		*m_player;								///< if m_testPlayer, the controlling player must (or must not) be this
+	const Team			*m_relationshipTeam;			///< if m_testRelationship, the team whose view of the entries matters
+	Int							m_relationshipFlags;			///< the relationships (as 1<<rel) that are allowed
+	Bool						m_testKindOf;
+	Bool						m_testPlayer;
+	Bool						m_playerMatch;
+	Bool						m_testRelationship;
+	Bool						m_relationshipNeutralOnly;	///< the object has no team, or is an undetected defector
+
+	// the team lookups are memoized, since a cell's entries tend to share a handful of teams.
+	const Team			*m_lastTeam;
+	Bool						m_lastTeamValid;
+	Bool						m_lastTeamPlayerOK;
+	Relationship		m_lastTeamRelationship;
+};
+
 //=====================================
 /**
 	this is an ABC. PartitionData::iterate allows you to pass multiple filters
@@ -605,6 +683,8 @@ class PartitionFilter
 {
 public:
 	virtual Bool allow(Object *objOther) = 0;
+	/// record whatever part of allow() can be checked from the cell query arrays. (optional)
+	virtual void addToPrefilter(PartitionQueryPrefilter& prefilter) const { }
 #if defined(_DEBUG) || defined(_INTERNAL)
 	virtual const char* debugGetName() = 0;
 #endif
@@ -651,6 +731,7 @@ class PartitionFilterSamePlayer : public PartitionFilter
 public:
 	PartitionFilterSamePlayer(const Player *player) : m_player(player) { }
 	virtual Bool allow(Object *objOther);
+	virtual void addToPrefilter(PartitionQueryPrefilter& prefilter) const { prefilter.addPlayer(m_player, true); }
 #if defined(_DEBUG) || defined(_INTERNAL)
 	virtual const char* debugGetName() { return "PartitionFilterSamePlayer"; }
 #endif
@@ -677,6 +758,7 @@ class PartitionFilterRelationship : public PartitionFilter
 	};
 	PartitionFilterRelationship(const Object *obj, Int flags) : m_obj(obj), m_flags(flags) { }
 	virtual Bool allow(Object *objOther);
+	virtual void addToPrefilter(PartitionQueryPrefilter& prefilter) const { prefilter.addRelationship(m_obj, m_flags); }
 #if defined(_DEBUG) || defined(_INTERNAL)
 	virtual const char* debugGetName() { return "PartitionFilterRelationship"; }
 #endif
@@ -873,6 +955,7 @@ class PartitionFilterAcceptByKindOf : public PartitionFilter
 public:
 	PartitionFilterAcceptByKindOf(const KindOfMaskType& mustBeSet, const KindOfMaskType& mustBeClear) : m_mustBeSet(mustBeSet), m_mustBeClear(mustBeClear) { }
 	virtual Bool allow(Object *objOther);
+	virtual void addToPrefilter(PartitionQueryPrefilter& prefilter) const { prefilter.addKindOf(m_mustBeSet, m_mustBeClear); }
 #if defined(_DEBUG) || defined(_INTERNAL)
 	virtual const char* debugGetName() { return "PartitionFilterAcceptByKindOf"; }
 #endif
@@ -1092,6 +1175,7 @@ class PartitionFilterPlayer : public PartitionFilter
 
 public:
 	PartitionFilterPlayer(const Player *player, Bool match) : m_player(player), m_match(match) {}
+	virtual void addToPrefilter(PartitionQueryPrefilter& prefilter) const { prefilter.addPlayer(m_player, m_match); }
 protected:
 	virtual Bool allow( Object *other );
 #if defined(_DEBUG) || defined(_INTERNAL)
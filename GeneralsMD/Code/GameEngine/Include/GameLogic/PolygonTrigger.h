@@ -152,6 +152,7 @@ class PolygonTrigger : public MemoryPoolObject,
 	const PolygonTrigger *getNext(void) const {return m_nextPolygonTrigger;}
 	AsciiString getTriggerName(void)  const {return m_triggerName;} ///< Gets the trigger name.
 	Bool pointInTrigger(ICoord3D &point) const;
+	const IRegion2D *getBounds(void) const {if (m_boundsNeedsUpdate) updateBounds(); return &m_bounds;} ///< the box pointInTrigger checks first.
 	Bool doExportWithScripts(void) const {return m_exportWithScripts;} 
 	void setDoExportWithScripts(Bool val) {m_exportWithScripts = val;} 
 	Bool isWaterArea(void) const {return m_isWaterArea;} 
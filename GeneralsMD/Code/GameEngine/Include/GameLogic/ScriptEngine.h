@@ -132,6 +132,25 @@ typedef AllObjectTypes::iterator AllObjectTypesIt;
 typedef std::vector<NamedReveal> VecNamedReveal;
 typedef VecNamedReveal::iterator VecNamedRevealIt;
 
+typedef std::hash_map< NameKeyType, Int, rts::hash<NameKeyType>, rts::equal_to<NameKeyType> > NamedObjectIndexMap;
+typedef NamedObjectIndexMap::iterator NamedObjectIndexMapIt;
+typedef std::hash_map< ObjectID, Int, rts::hash<ObjectID>, rts::equal_to<ObjectID> > NamedObjectIDIndexMap;
+typedef NamedObjectIDIndexMap::iterator NamedObjectIDIndexMapIt;
+
+//-------------------------------------------------------------------------------------------------
+/** Game state that script conditions can depend on.  Scripts whose conditions came out false
+		are not evaluated again until one of the inputs they looked at is invalidated. */
+//-------------------------------------------------------------------------------------------------
+enum ScriptDependency
+{
+	SCRIPT_DEP_VARIABLES = 0,		///< Script counters & flags.
+	SCRIPT_DEP_MONEY,						///< Any player's money.
+	SCRIPT_DEP_OBJECTS,					///< Object death & destruction, team membership & activation, the named object cache.
+
+	SCRIPT_DEP_COUNT,
+	SCRIPT_DEP_VOLATILE = SCRIPT_DEP_COUNT	///< Anything not tracked.  Always re-evaluated.
+};
+
 class AttackPriorityInfo : public MemoryPoolObject, public Snapshot
 {
 	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(AttackPriorityInfo, "AttackPriorityInfo")		
@@ -263,6 +282,7 @@ class ScriptEngine : public SubsystemInterface,
 	virtual void runScript(const AsciiString& scriptName, Team *pThisTeam=NULL); ///<  Runs a script.
 	virtual void runObjectScript(const AsciiString& scriptName, Object *pThisObject=NULL); ///<  Runs a script attached to this object.
 	virtual Team *getTeamNamed(const AsciiString& teamName); ///<  Gets the named team.  May be null.
+	virtual Team *getTeamNamed(const Parameter *pTeamParm); ///<  Gets the team named by a script parameter, using its name key.  May be null.
 	virtual Player *getSkirmishEnemyPlayer(void); ///< Gets the ai's enemy Human player. May be null.
 	virtual Player *getCurrentPlayer(void); ///<  Gets the player that owns the current script.  May be null.
 	virtual Player *getPlayerFromAsciiString(const AsciiString& skirmishPlayerString);
@@ -292,6 +312,8 @@ class ScriptEngine : public SubsystemInterface,
 
 	virtual Object *getUnitNamed(const AsciiString& unitName); ///< Gets the named unit. May be null.
 	virtual Bool didUnitExist(const AsciiString& unitName);
+	virtual Object *getUnitNamed(const Parameter *pUnitParm); ///< Gets the unit named by a script parameter, using its name key. May be null.
+	virtual Bool didUnitExist(const Parameter *pUnitParm);
 	virtual void addObjectToCache( Object* pNewObject );
 	virtual void removeObjectFromCache( Object* pDeadObject );
 	virtual void transferObjectName( const AsciiString& unitName, Object *pNewObject );
@@ -336,6 +358,12 @@ class ScriptEngine : public SubsystemInterface,
 	void clearTeamFlags(void); ///< Hack for dustin.
 	void clearFlag(const AsciiString &name); ///< Hack for dustin.
 
+	/// Notes that an input script conditions may depend on has changed.
+	void invalidateScriptDependency(ScriptDependency dep) { m_dependencyStamps[dep] = ++m_dependencyStamp; }
+	void invalidateAllScriptDependencies(void);
+	/// Called while a condition is evaluated, to record what its result depended on.
+	void noteConditionDependency(ScriptDependency dep) { m_conditionDependencies |= (1 << dep); }
+
 	TFade getFade(void) {return m_fade;}
 	Real	getFadeValue(void) {return m_curFadeValue;}
 
@@ -409,6 +437,8 @@ class ScriptEngine : public SubsystemInterface,
 	Bool evaluateTimer( Condition *pCondition );
 	Bool evaluateCondition( Condition *pCondition );
 	void executeActions( ScriptAction *pActionHead );
+	Bool canReuseFalseConditions( Script *pScript );
+	void recordConditionResult( Script *pScript, Bool result, UnsignedInt stamp );
 
 	void setPriorityThing( ScriptAction *pAction );
 	void setPriorityKind( ScriptAction *pAction );
@@ -422,6 +452,14 @@ class ScriptEngine : public SubsystemInterface,
 
 	AttackPriorityInfo *findAttackInfo(const AsciiString& name, Bool addIfNotFound);
 
+	// Named object cache indices.
+	Int findNamedObjectIndex(NameKeyType nameKey);	///< Index of the entry in m_namedObjects with this name, or -1.
+	Object *getUnitNamedKey(NameKeyType nameKey);
+	Bool didUnitExistKey(NameKeyType nameKey);
+	Team *getTeamNamedKey(NameKeyType teamKey, const AsciiString& teamName);
+	void addNamedRequest(const AsciiString& name, Object *obj);	///< Appends to m_namedObjects & indexes it.
+	void rebuildNamedObjectIndex( void );
+
 protected:
 	/// Stuff to execute scripts sequentially
 	typedef std::vector<SequentialScript*> VecSequentialScriptPtr;
@@ -454,6 +492,8 @@ class ScriptEngine : public SubsystemInterface,
 	Team							*m_conditionTeam;				///< Team that is being used to evaluate conditions, used for THIS_TEAM
 	Object						*m_conditionObject;				///< Unit that is being used to evaluate conditions, used for THIS_OBJECT
 	VecNamedRequests	m_namedObjects;
+	NamedObjectIndexMap m_namedObjectIndex;		///< Name key -> index into m_namedObjects.
+	NamedObjectIDIndexMap m_namedObjectIDIndex;	///< Live object id -> index into m_namedObjects.
 	Bool							m_firstUpdate;			
 	Player						*m_currentPlayer;
 	Player						*m_skirmishHumanPlayer;
@@ -468,6 +508,10 @@ class ScriptEngine : public SubsystemInterface,
 	Int								m_fadeFramesHold;
 	Int								m_fadeFramesDecrease;
 
+	UnsignedInt				m_dependencyStamp;												///< Bumped whenever a script dependency is invalidated.
+	UnsignedInt				m_dependencyStamps[SCRIPT_DEP_COUNT];			///< m_dependencyStamp when each dependency last changed.
+	UnsignedInt				m_conditionDependencies;									///< ScriptDependency bits noted by the conditions being evaluated.
+
 	UnsignedInt				m_frameObjectCountChanged;
 
 	ObjectTypeCount		m_objectCounts[MAX_PLAYER_COUNT];
@@ -45,6 +45,7 @@
 #include "Common/Snapshot.h"
 #include "GameNetwork/NetworkDefs.h"
 #include "Common/ObjectStatusTypes.h"
+#include "Common/NameKeyGenerator.h"
 
 #define THIS_TEAM "<This Team>"
 #define ANY_TEAM "<Any Team>"
@@ -88,6 +89,7 @@ class Condition;
 class DataChunkInput;
 struct DataChunkInfo;
 class DataChunkOutput;
+class Player;
 
 #define NO_MORE_COMPLEX_SKIRMISH_SCRIPTS
 #ifndef NO_MORE_COMPLEX_SKIRMISH_SCRIPTS
@@ -645,6 +647,10 @@ class Script : public MemoryPoolObject, public Snapshot
 	Real				m_conditionTime;		///< Amount of time (cum) to evaluate conditions.
 	Real				m_curTime;		///< Amount of time (cum) to evaluate conditions.
 	Int					m_conditionExecutedCount; ///< Number of times conditions evaluated.
+	UnsignedInt	m_falseStamp;					///< ScriptEngine dependency stamp when the conditions were last false, 0 if that result can't be reused.
+	UnsignedInt	m_falseDependencies;	///< ScriptDependency bits the false result depended on.
+	Player			*m_falsePlayer;				///< Player the false result was evaluated for.
+	UnsignedInt	m_falseTeamID;				///< TeamID of the calling team the false result was evaluated for, 0 if none.
 
 public:
 	Script();
@@ -675,12 +681,18 @@ class Script : public MemoryPoolObject, public Snapshot
 	void addToConditionTime(Real time) {m_conditionTime += time;}
 	void setCurTime(Real time) {m_curTime	= time;}
 	void setDelayEvalSeconds(Int delay) {m_delayEvaluationSeconds = delay;}
+	void setFalseResult(UnsignedInt stamp, UnsignedInt dependencies, Player *player, UnsignedInt teamID) {m_falseStamp = stamp; m_falseDependencies = dependencies; m_falsePlayer = player; m_falseTeamID = teamID;}
+	void clearFalseResult(void) {m_falseStamp = 0;}
 
 	UnsignedInt getFrameToEvaluate(void) {return m_frameToEvaluateAt;}
 	Int getConditionCount(void) {return m_conditionExecutedCount;}
 	Real getConditionTime(void) {return m_conditionTime;}
 	Real getCurTime(void) {return m_curTime;}
 	Int getDelayEvalSeconds(void) {return m_delayEvaluationSeconds;}
+	UnsignedInt getFalseStamp(void) const {return m_falseStamp;}
+	UnsignedInt getFalseDependencies(void) const {return m_falseDependencies;}
+	Player *getFalsePlayer(void) const {return m_falsePlayer;}
+	UnsignedInt getFalseTeamID(void) const {return m_falseTeamID;}
 
 	AsciiString getName(void) const { return m_scriptName;}
 	AsciiString getComment(void) const {return m_comment;}
@@ -808,7 +820,8 @@ class Parameter : public MemoryPoolObject
 		m_initialized(false),
 		m_paramType(type),
 		m_int(val),
-		m_real(0)
+		m_real(0),
+		m_nameKey(NAMEKEY_INVALID)
 	{
 		m_coord.x=0;m_coord.y=0;m_coord.z=0;
 	}
@@ -821,12 +834,13 @@ class Parameter : public MemoryPoolObject
 	AsciiString		m_string;
 	Coord3D				m_coord;
 	ObjectStatusMaskType m_objectStatus;
+	mutable NameKeyType	m_nameKey;	///< m_string as a name key, resolved on first use.  Used for fast unit & team lookups.
 
 protected:
 	void setInt(Int i) {m_int = i;}
 	void setReal(Real r) {m_real = r;}
 	void setCoord3D(const Coord3D *pLoc);
-	void setString(AsciiString s) {m_string = s;}
+	void setString(AsciiString s) {m_string = s; m_nameKey = NAMEKEY_INVALID;}
 	void setStatus( ObjectStatusMaskType objectStatus ) { m_objectStatus.set( objectStatus ); }
 
 public:
@@ -839,11 +853,12 @@ class Parameter : public MemoryPoolObject
 	void friend_setInt(Int i) {m_int = i;}
 	void friend_setReal(Real r) {m_real = r;}
 	void friend_setCoord3D(const Coord3D *pLoc) { setCoord3D(pLoc); }
-	void friend_setString(AsciiString s) {m_string = s;}
+	void friend_setString(AsciiString s) {m_string = s; m_nameKey = NAMEKEY_INVALID;}
 
 	void qualify(const AsciiString& qualifier,const AsciiString& playerTemplateName,const AsciiString& newPlayerName);
 
 	const AsciiString& getString(void) const {return m_string;}
+	NameKeyType getNameKey(void) const;	///< Name key of the string, NAMEKEY_INVALID if empty.
 	AsciiString getUiText(void) const;
 
 	void WriteParameter(DataChunkOutput &chunkWriter);
@@ -242,6 +242,13 @@ class TerrainLogic : public Snapshot,
 
 	virtual Real getGroundHeight( Real x, Real y, Coord3D* normal = NULL )  const;
 	virtual Real getLayerHeight(Real x, Real y, PathfindLayerEnum layer, Coord3D* normal = NULL, Bool clip = true) const;
+
+	/// ground height (and normal, if wanted) for many xy pairs at once. normals may be NULL.
+	void getGroundHeights( Int count, const Coord2D *xy, Real *heights, Coord3D *normals ) const;
+
+	Bool hasHeightSamples( void ) const { return m_mapData != NULL; }	///< do we own a height grid for this map?
+	Int getRawMapHeight( const ICoord2D *gridPos ) const;						///< raw height sample at grid pos (not counting border)
+	void setRawMapHeight( const ICoord2D *gridPos, Int height );		///< lower the raw height sample at grid pos (never raises)
 	virtual void getExtent( Region3D *extent ) const { DEBUG_CRASH(("not implemented"));  }		///< @todo This should not be a stub - this should own this functionality
 	virtual void getExtentIncludingBorder( Region3D *extent ) const { DEBUG_CRASH(("not implemented"));  }		///< @todo This should not be a stub - this should own this functionality
 	virtual void getMaximumPathfindExtent( Region3D *extent ) const { DEBUG_CRASH(("not implemented"));  }		///< @todo This should not be a stub - this should own this functionality
@@ -350,9 +357,24 @@ class TerrainLogic : public Snapshot,
 	/// find the axis aligned region bounding the water table
 	void findAxisAlignedBoundingRect( const WaterHandle *waterHandle, Region3D *region );
 
+	/// bucket the water polygon triggers into a coarse grid by their bounding boxes
+	void rebuildWaterIndex( void );
+
+	/// take a copy of the map's height samples (including border), so height queries don't need a renderer.
+	void setHeightSamples( const UnsignedByte *data, Int dx, Int dy, Int border );
+	void freeHeightSamples( void );
+
+	/// sample m_mapData exactly the way the terrain render object does. (only valid if hasHeightSamples())
+	Real sampleGroundHeight( Real x, Real y, Coord3D *normal ) const;
+
+	/// nearest height sample to grid pos (x, y), counting the border. used off the edge of the samples.
+	virtual UnsignedByte getClipHeight( Int x, Int y ) const;
+
 	UnsignedByte	*m_mapData;									///< array of height samples
 	Int	m_mapDX;															///< width of map samples
 	Int	m_mapDY;															///< height of map samples
+	Int	m_mapBorder;													///< width of the border around the height samples
+	Real m_maxMapHeight;												///< highest height sample at load, in world units
 
 	VecICoord2D m_boundaries;
 	Int m_activeBoundary;
@@ -383,6 +405,21 @@ class TerrainLogic : public Snapshot,
 	} m_waterToUpdate[ MAX_DYNAMIC_WATER ];  ///< water tables to dynamicall update
 	Int m_numWaterToUpdate;						///< how many valid entries are in m_waterToUpdate
 
+	//
+	// getWaterHandle is called a lot (hover and amphibious locomotors, pathfinding), so rather
+	// than test every polygon trigger we look in a coarse grid of the water areas' bounding
+	// boxes. each cell lists the water triggers touching it in trigger list order, so the
+	// answer is the same as the full scan. water heights are read from the triggers at query
+	// time, so raising and lowering water doesn't invalidate this; only the set of triggers does.
+	//
+	Bool m_waterIndexDirty;										///< rebuild m_waterIndex* before the next lookup
+	IRegion2D m_waterIndexBounds;							///< union of the water areas' bounds
+	Int m_waterIndexCellSize;									///< cell size, in world units
+	Int m_waterIndexCellsX;										///< cells across
+	Int m_waterIndexCellsY;										///< cells down
+	std::vector<Int> m_waterIndexCellStart;		///< per cell, first entry in m_waterIndexTriggers (plus one at the end)
+	std::vector<PolygonTrigger *> m_waterIndexTriggers;	///< water triggers, grouped by cell
+
 };  // end class TerrainLogic
 
 // EXTERNALS //////////////////////////////////////////////////////////////////////////////////////
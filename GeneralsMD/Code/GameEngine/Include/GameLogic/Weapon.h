@@ -45,6 +45,7 @@
 // INCLUDES ///////////////////////////////////////////////////////////////////////////////////////
 #include "Common/AudioEventRTS.h"
 #include "Common/GameCommon.h"
+#include "Common/NameKeyRegistry.h"
 
 #include "GameLogic/Damage.h"
 
@@ -58,6 +59,7 @@ class ThingTemplate;
 class Object;
 class Weapon;
 class WeaponTemplate;
+class XferCRC;
 class INI;
 class ParticleSystemTemplate;
 enum NameKeyType;
@@ -596,6 +598,10 @@ class Weapon : public MemoryPoolObject,
 
 //~Weapon();
 
+	// incremental CRC
+	void markCRCDirty() { m_crcCacheCount = -1; }									///< something crc() covers has changed, recompute our CRC words next time
+	void friend_xferIncrementalCRC( XferCRC *xfer );							///< crc() using cached words where we can. for use ONLY by Object!
+
 	// return true if we auto-reloaded our clip after firing.
 	Bool fireWeapon(const Object *source, Object *target, ObjectID* projectileID = NULL);
 
@@ -671,9 +677,9 @@ class Weapon : public MemoryPoolObject,
 	Real getPercentReadyToFire() const;
 
 	// do not ever use this unless you are weaponset.cpp
-	void setPossibleNextShotFrame( UnsignedInt frameNum ) { m_whenWeCanFireAgain = frameNum; }
-	void setPreAttackFinishedFrame( UnsignedInt frameNum ) { m_whenPreAttackFinished = frameNum; }
-	void setLastReloadStartedFrame( UnsignedInt frameNum ) { m_whenLastReloadStarted = frameNum; }
+	void setPossibleNextShotFrame( UnsignedInt frameNum ) { m_whenWeCanFireAgain = frameNum; markCRCDirty(); }
+	void setPreAttackFinishedFrame( UnsignedInt frameNum ) { m_whenPreAttackFinished = frameNum; markCRCDirty(); }
+	void setLastReloadStartedFrame( UnsignedInt frameNum ) { m_whenLastReloadStarted = frameNum; markCRCDirty(); }
 
 	//Transfer the reload times and status from the passed in weapon.
 	void transferNextShotStatsFrom( const Weapon &weapon );
@@ -734,10 +740,10 @@ class Weapon : public MemoryPoolObject,
 	//weapon template has the LeechRangeWeapon set, it means that once the unit has closed to standard weapon range
 	//it fires the weapon, and will be able to hit the target even if it moves out of range! The unit will simply
 	//stand there. This functionality is used by hack attacks.
-	void setLeechRangeActive( Bool active ) { m_leechWeaponRangeActive = active; }
+	void setLeechRangeActive( Bool active ) { m_leechWeaponRangeActive = active; markCRCDirty(); }
 	Bool hasLeechRange() const { return m_leechWeaponRangeActive; }
 
-	void setMaxShotCount(Int maxShots) { m_maxShotCount = maxShots; }
+	void setMaxShotCount(Int maxShots) { m_maxShotCount = maxShots; markCRCDirty(); }
 	Int getMaxShotCount() const { return m_maxShotCount; }
 
 	Bool isClearFiringLineOfSightTerrain(const Object* source, const Object* victim) const;
@@ -814,6 +820,11 @@ class Weapon : public MemoryPoolObject,
 	Bool											m_pitchLimited;
 	Bool											m_leechWeaponRangeActive;		///< This weapon has unlimited range until attack state is aborted!
 
+	// CRC words crc() produced last time, replayed while nothing it covers has changed
+	enum { CRC_CACHE_WORDS = 32 };
+	UnsignedInt								m_crcCache[ CRC_CACHE_WORDS ];
+	Int												m_crcCacheCount;						///< words in m_crcCache, -1 if dirty
+
 	// setter function for status that should not be used outside this class
 	void setStatus( WeaponStatus status) { m_status = status; }
 };
@@ -866,6 +877,7 @@ class WeaponStore : public SubsystemInterface
 	WeaponTemplate *newOverride( WeaponTemplate *weaponTemplate );
 
 	void deleteAllDelayedDamage();
+	void processDelayedDamage( UnsignedInt frame );	///< deal the delayed damage in the wheel bucket for 'frame'
 	void resetWeaponTemplates( void );
 	void setDelayedDamage(const WeaponTemplate *weapon, const Coord3D* pos, UnsignedInt whichFrame, ObjectID sourceID, ObjectID victimID, const WeaponBonus& bonus);
 
@@ -888,8 +900,20 @@ class WeaponStore : public SubsystemInterface
 		WeaponBonus m_bonus;												///< the weapon bonus to use
 	};
 
+	/**
+		Pending delayed damage is kept in a timing wheel: bucket (frame % DDI_WHEEL_SIZE) holds,
+		in the order they were set, the pool indices of the entries due on that frame (or on a
+		later frame that wraps to the same bucket). Each frame only looks at its own bucket.
+	*/
+	enum { DDI_WHEEL_SIZE = 128 };
+
 	std::vector<WeaponTemplate*> m_weaponTemplateVector;
-	std::list<WeaponDelayedDamageInfo> m_weaponDDI;
+	NameKeyRegistry<WeaponTemplate> m_weaponTemplateIndex;	///< m_weaponTemplateVector by name key
+	std::vector<WeaponDelayedDamageInfo> m_weaponDDI;				///< entry pool, indexed by the wheel buckets
+	std::vector<Int> m_weaponDDIFree;												///< unused indices in m_weaponDDI
+	std::vector<Int> m_weaponDDIWheel[ DDI_WHEEL_SIZE ];		///< pending entries, bucketed by frame
+	Int m_weaponDDIPending;																	///< number of entries in the wheel
+	UnsignedInt m_weaponDDINextFrame;												///< first frame whose bucket hasn't been processed yet
 };
 
 // EXTERNALS //////////////////////////////////////////////////////////////////////////////////////
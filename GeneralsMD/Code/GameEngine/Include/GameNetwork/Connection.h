@@ -89,6 +89,8 @@ class Connection : public MemoryPoolObject
 	void setQuitting( void );
 	Bool isQuitting( void ) { return m_isQuitting; }
 
+	Int getTotalRetries( void ) { return m_totalRetries; }	///< Commands sent again for want of an ack, since init.
+
 #if defined(_DEBUG) || defined(_INTERNAL)
 	void debugPrintCommands();
 #endif
@@ -103,6 +105,7 @@ class Connection : public MemoryPoolObject
 	User *m_user;
 
 	NetCommandList *m_netCommandList;
+	NetPacket *m_fitPacket;				///< Scratch packet sendNetCommandMsg uses to see if a command needs splitting.
 	time_t m_retryTime;						///< The time between sending retry packets for this connection.  Time is in milliseconds.
 	Real m_averageLatency;			///< The average time between sending a command and receiving an ACK.
 	Real m_latencies[CONNECTION_LATENCY_HISTORY_LENGTH];	///< List of the last 100 latencies.
@@ -110,6 +113,7 @@ class Connection : public MemoryPoolObject
 	time_t m_frameGrouping;				///< The minimum time between packet sends.
 	time_t m_lastTimeSent;				///< The time of the last packet send.
 	Int m_numRetries;							///< The number of retries for the last second.
+	Int m_totalRetries;						///< The number of retries since init.
 	time_t m_retryMetricsTime;		///< The start time of the current retry metrics thing.
 };
 
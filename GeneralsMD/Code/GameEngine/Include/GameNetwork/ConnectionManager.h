@@ -61,7 +61,7 @@ class ConnectionManager
 {
 public:
 	ConnectionManager();
-	~ConnectionManager();
+	virtual ~ConnectionManager();
 
 	virtual void init();				///< Initialize this instance.
 	virtual void reset();				///< Take this instance back to the initial state.
@@ -69,6 +69,12 @@ class ConnectionManager
 
 	// End SubsystemInterface functions
 
+	// What the rest of the game is doing.  In the game these come from TheGameLogic, TheNetwork and
+	// TheDisplay; a harness that runs several of us in one process overrides them.
+	virtual UnsignedInt getLogicFrame( void );		///< The frame the game logic is on (the next one to execute).
+	virtual Int getExecutionFrame( void );				///< The frame that commands issued now will execute on.
+	virtual Real getLocalFps( void );							///< The local frame rate to report in our run ahead metrics.
+
 	void updateRunAhead(Int oldRunAhead, Int frameRate, Bool didSelfSlug, Int nextExecutionFrame);	///< Update the run ahead value.  If we are the current packet router, issue the command.
 
 	void attachTransport(Transport *transport);
@@ -124,9 +130,15 @@ class ConnectionManager
 	Real getOutgoingPacketsPerSecond( void );
 	Real getUnknownBytesPerSecond( void );
 	Real getUnknownPacketsPerSecond( void );
+	Real getIncomingPacketsPerCall( void );
+	Real getOutgoingPacketsPerCall( void );
 	UnsignedInt getPacketArrivalCushion( void );
 
 	UnsignedInt getMinimumCushion();
+	Real getAverageLatency( void );							///< Our average round trip for frame info, in seconds.
+	Int getFrameResendRequests( void ) { return m_frameResendRequests; }	///< Frames we have asked someone to resend.
+	Int getFrameResendsServed( void ) { return m_frameResendsServed; }		///< Frame resend requests we have answered.
+	Int getTotalRetries( void );								///< Commands resent for want of an ack, over the connections still open.
 
 	void flushConnections();
 
@@ -220,6 +232,11 @@ class ConnectionManager
 	Int  m_minFps;
 	UnsignedInt m_smallestPacketArrivalCushion;
 	Bool m_didSelfSlug;
+	time_t m_lastRunAheadMetricsTime;				///< When updateRunAhead last sent or computed the metrics.
+	Int m_keepAliveIndex;										///< The next slot doKeepAlive sends to.
+	time_t m_keepAliveStartTime;						///< When doKeepAlive started the current round of slots.
+	Int m_frameResendRequests;
+	Int m_frameResendsServed;
 
 	// -----------------------------------------------------------------------------
 	FileCommandMap s_fileCommandMap;
@@ -98,7 +98,7 @@ class DisconnectManager
 	Bool isPlayerVotedOut(Int slot, ConnectionManager *conMgr);	///< returns true if this player has been voted out.
 	Bool isPlayerInGame(Int slot, ConnectionManager *conMgr); ///< returns true if the player has neither timed out or been voted out.
 	UnsignedInt getMaxDisconnectFrame();	///< returns the highest frame that people have got to.
-	Int countVotesForPlayer(Int slot); ///< return the number of disconnect votes a player has.
+	Int countVotesForPlayer(Int slot, ConnectionManager *conMgr); ///< return the number of disconnect votes a player has.
 	void resetPlayersVotes(Int playerID, UnsignedInt frame, ConnectionManager *conMgr); ///< reset the votes for this player.
 
 	void turnOnScreen(ConnectionManager *conMgr); ///< This gets called when the disconnect screen is first turned on.
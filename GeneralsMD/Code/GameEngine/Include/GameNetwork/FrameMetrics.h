@@ -50,7 +50,7 @@ class FrameMetrics {
 	void init();
 	void reset();
 
-	void doPerFrameMetrics(UnsignedInt frame);
+	void doPerFrameMetrics(UnsignedInt frame, Real fps);	///< fps is the local frame rate to fold into the history.
 	void processLatencyResponse(UnsignedInt frame);
 	void addCushion(Int cushion);
 
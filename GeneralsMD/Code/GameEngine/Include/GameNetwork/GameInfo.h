@@ -243,6 +243,9 @@ class GameInfo
   inline Bool oldFactionsOnly(void) const;
   inline void setOldFactionsOnly( Bool oldFactionsOnly );
 
+	inline Bool getCompactGameCommands( void ) const;							///< Do all players send game commands with the compact packet encoding?
+	inline void setCompactGameCommands( Bool compact );
+
 protected:
 	Int m_preorderMask;
 	Int m_crcInterval;
@@ -264,6 +267,7 @@ class GameInfo
   Money         m_startingCash;
   UnsignedShort m_superweaponRestriction;
   Bool m_oldFactionsOnly; // Only USA, China, GLA -- not USA Air Force General, GLA Toxic General, et al
+	Bool m_compactGameCommands;
 };
 
 extern GameInfo *TheGameInfo;
@@ -285,6 +289,8 @@ const Money&GameInfo::getStartingCash( void ) const         { return m_startingC
 UnsignedShort GameInfo::getSuperweaponRestriction( void ) const { return m_superweaponRestriction; }
 Bool        GameInfo::oldFactionsOnly(void) const           { return m_oldFactionsOnly; }
 void        GameInfo::setOldFactionsOnly( Bool oldFactionsOnly ) { m_oldFactionsOnly = oldFactionsOnly; }
+Bool				GameInfo::getCompactGameCommands( void ) const	{ return m_compactGameCommands; }
+void				GameInfo::setCompactGameCommands( Bool compact ) { m_compactGameCommands = compact; }
 
 AsciiString GameInfoToAsciiString( const GameInfo *game );
 Bool ParseAsciiStringToGameInfo( GameInfo *game, AsciiString options );
@@ -0,0 +1,156 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+//																																						//
+//  (c) 2001-2003 Electronic Arts Inc.																				//
+//																																						//
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The loopback network is an in-process stand in for UDP, for exercising the lockstep code under
+ * conditions we pick rather than whatever the lab network is doing today.  Any number of LoopbackUDP
+ * sockets can be bound to made up addresses on one LoopbackNetwork; a datagram written to one is
+ * delivered to the socket bound at the destination after that link's latency, give or take its
+ * jitter, unless the link loses it.  A share of packets can be held back so they arrive behind ones
+ * sent later.  Every link is directed and can be changed at any time, which is how a benchmark
+ * scripts lag spikes or a player dropping off.
+ *
+ * Random decisions come from the network's own seeded generator, so a run only depends on the
+ * seed and the timing of the callers.  Not thread safe: everything sharing a LoopbackNetwork should
+ * run on one thread.
+ */
+
+#pragma once
+
+#ifndef __LOOPBACKNETWORK_H
+#define __LOOPBACKNETWORK_H
+
+#include "GameNetwork/udp.h"
+#include "GameNetwork/NetworkDefs.h"
+
+struct LoopbackLinkSettings
+{
+	Int m_latency;				///< one way delay, in milliseconds.
+	Int m_jitter;					///< each packet's delay is off by up to this many milliseconds either way.
+	Int m_packetLoss;			///< percent of packets dropped.
+	Int m_reorder;				///< percent of packets delayed by another m_latency, so later ones overtake them.
+};
+
+struct LoopbackLinkStats
+{
+	UnsignedInt m_packets;		///< datagrams written to the link, lost or not.
+	UnsignedInt m_bytes;			///< payload bytes written to the link.
+	UnsignedInt m_lost;				///< datagrams the link dropped.
+	UnsignedInt m_reordered;	///< datagrams held back to arrive out of order.
+};
+
+class LoopbackNetwork
+{
+public:
+	LoopbackNetwork(UnsignedInt seed);
+	~LoopbackNetwork();
+
+	void setDefaultLinkSettings(const LoopbackLinkSettings &settings);	///< Applies to every link, including ones given their own settings before.
+	void setLinkSettings(UnsignedInt fromAddr, UnsignedInt toAddr, const LoopbackLinkSettings &settings);
+	LoopbackLinkSettings getLinkSettings(UnsignedInt fromAddr, UnsignedInt toAddr);
+
+	LoopbackLinkStats getLinkStats(UnsignedInt fromAddr, UnsignedInt toAddr);
+	LoopbackLinkStats getTotalStats();
+	void resetStats();
+
+	Bool bind(UnsignedInt addr, UnsignedShort port);		///< FALSE if something is already bound there.
+	void unbind(UnsignedInt addr, UnsignedShort port);	///< Also throws away anything still on its way there.
+	Int send(UnsignedInt fromAddr, UnsignedShort fromPort, UnsignedInt toAddr, UnsignedShort toPort, const unsigned char *buf, UnsignedInt len);
+	Int receive(UnsignedInt addr, UnsignedShort port, unsigned char *buf, UnsignedInt len, UnsignedInt &fromAddr, UnsignedShort &fromPort);	///< 0 if nothing has arrived yet.
+
+protected:
+	struct Link
+	{
+		UnsignedInt m_fromAddr;
+		UnsignedInt m_toAddr;
+		LoopbackLinkSettings m_settings;
+		LoopbackLinkStats m_stats;
+	};
+
+	struct Datagram
+	{
+		UnsignedInt m_fromAddr;
+		UnsignedShort m_fromPort;
+		UnsignedInt m_toAddr;
+		UnsignedShort m_toPort;
+		UnsignedInt m_deliveryTime;
+		UnsignedInt m_sequence;			///< keeps datagrams due at the same time in the order they were sent.
+		UnsignedInt m_length;
+		unsigned char m_data[MAX_MESSAGE_LEN];
+	};
+
+	struct Endpoint
+	{
+		UnsignedInt m_addr;
+		UnsignedShort m_port;
+	};
+
+	typedef std::vector<Link> LinkVec;
+	typedef std::list<Datagram *> DatagramList;
+	typedef std::vector<Endpoint> EndpointVec;
+
+	Link *findLink(UnsignedInt fromAddr, UnsignedInt toAddr);	///< Creates the link with the default settings if we haven't seen it.
+	Bool isBound(UnsignedInt addr, UnsignedShort port);
+	Int randomValue(Int lo, Int hi);
+
+	LinkVec m_links;
+	DatagramList m_inFlight;
+	EndpointVec m_endpoints;
+	LoopbackLinkSettings m_defaultSettings;
+	UnsignedInt m_seed;
+	UnsignedInt m_nextSequence;
+};
+
+/**
+ * A UDP socket on a LoopbackNetwork.  Hand one to Transport::init in place of a real UDP.
+ */
+class LoopbackUDP : public UDP
+{
+public:
+	LoopbackUDP(LoopbackNetwork *network);
+	virtual ~LoopbackUDP();
+
+	virtual Int Bind(UnsignedInt IP, UnsignedShort port);
+	virtual Int Write(const unsigned char *msg, UnsignedInt len, UnsignedInt IP, UnsignedShort port);
+	virtual Int Read(unsigned char *msg, UnsignedInt len, sockaddr_in *from);
+	virtual sockStat GetStatus(void);
+
+protected:
+	LoopbackNetwork *m_network;
+	UnsignedInt m_addr;
+	UnsignedShort m_port;
+	Bool m_isBound;
+};
+
+#endif
@@ -43,15 +43,12 @@
 
 /**
  * The NetCommandList is a ordered linked list of NetCommandRef objects.
- * The list is ordered based on the command id, player id, and command type.
+ * The list is ordered based on the command type, player id, and command id (the sort number).
  * It is ordered in this way to aid in constructing the packets efficiently.
- * The list keeps track of the last message inserted in order to accommodate
- * adding commands in order more efficiently since that is whats going to be
- * done most of the time.  If the new message doesn't go after the last message
- * inserted, then the list will be traversed linearly until the proper spot is
- * found.  We can get away with this inefficient method since these occurances
- * will be rare.  Also, the list is not expected to ever have more than 30 or so
- * commands on it at a time.  Five commands would probably be a normal amount.
+ * Alongside the linked list the list keeps an array of the same refs in the same order, which
+ * addMessage binary searches for the insert position, and a hash of the commands that carry a
+ * command id, keyed on player id and command id, so duplicates and findMessage lookups don't walk
+ * the list.  Resend storms and big relay frames can put hundreds of commands on one list.
  */
 
 class NetCommandList : public MemoryPoolObject
@@ -73,12 +70,29 @@ class NetCommandList : public MemoryPoolObject
 																								///< a command id.
 	void removeMessage(NetCommandRef *msg);			///< Remove the given message from the list.
 	void appendList(NetCommandList *list);			///< Append the given list to the end of this list.
-	Int length();									///< Returns the number of nodes in this list.  This is inefficient and is meant to be a debug tool.
+	Int length();									///< Returns the number of nodes in this list.
 
 protected:
+	Int compareCommands(NetCommandMsg *msg1, NetCommandMsg *msg2);	///< <0, 0 or >0 as msg1 goes before, with, or after msg2 in the list.
+	Int findInsertIndex(NetCommandMsg *msg);		///< Index of the first command that doesn't go before msg.
+	Int findIndex(NetCommandRef *ref);				///< Index of ref in m_sorted, or -1.
+	void growSorted();
+	UnsignedInt hashSlot(UnsignedShort commandID, UnsignedByte playerID);
+	NetCommandRef * hashFind(UnsignedShort commandID, UnsignedByte playerID);
+	void hashInsert(NetCommandRef *ref);
+	void hashRemove(NetCommandRef *ref);
+	void rehash(Int size);
+
 	NetCommandRef *m_first;							///< Head of the list.
 	NetCommandRef *m_last;							///< Tail of the list.
-	NetCommandRef *m_lastMessageInserted;			///< The last message that was inserted to this list.
+	Int m_count;												///< Number of nodes in the list.
+
+	NetCommandRef **m_sorted;						///< Every node, in list order.
+	Int m_sortedSize;										///< Allocated length of m_sorted.
+
+	NetCommandRef **m_idHash;						///< Open addressed, linear probing. Only commands that require a command id.
+	Int m_idHashSize;										///< Power of two, or 0 until the first such command.
+	Int m_idHashCount;
 };
 
 #endif
@@ -55,6 +55,7 @@ be specialized code.
 #include "Common/GameMemory.h"
 
 class NetPacket;
+class GameMessageParser;
 
 typedef std::list<NetPacket *> NetPacketList;
 typedef std::list<NetPacket *>::iterator NetPacketListIter;
@@ -78,6 +79,12 @@ class NetPacket : public MemoryPoolObject
 	static NetCommandRef * ConstructNetCommandMsgFromRawData(UnsignedByte *data, UnsignedShort dataLength);
 	static NetPacketList ConstructBigCommandPacketList(NetCommandRef *ref);
 
+	// Game commands are packed with the compact encoding (varint ids and
+	// frame deltas, delta coded object ids) only when every player in the
+	// game agreed to it.  Packets of either encoding can always be read.
+	static void SetCompactGameCommands(Bool compact);
+	static Bool GetCompactGameCommands();
+
 	UnsignedByte *getData();
 	Int getLength();
 	UnsignedInt getAddr();
@@ -149,6 +156,9 @@ class NetPacket : public MemoryPoolObject
 	Bool isRoomForAckMessage(NetCommandRef *msg);
 	Bool addGameCommand(NetCommandRef *msg);
 	Bool isRoomForGameMessage(NetCommandRef *msg, GameMessage *gmsg);
+	Bool addCompactGameCommand(NetCommandRef *msg, GameMessage *gmsg);
+	Bool isSameArgumentLayout(GameMessageParser *parser, Int offset);
+	Bool writeCompactGameMessageArgument(GameMessageArgumentDataType type, GameMessageArgumentType arg, Int &offset, ObjectID &lastObjectID);
 	Bool addPlayerLeaveCommand(NetCommandRef *msg);
 	Bool isRoomForPlayerLeaveMessage(NetCommandRef *msg);
 	Bool addRunAheadMetricsCommand(NetCommandRef *msg);
@@ -201,6 +211,7 @@ class NetPacket : public MemoryPoolObject
 	Bool isFrameRepeat(NetCommandRef *msg);
 
 	static NetCommandMsg * readGameMessage(UnsignedByte *data, Int &i);
+	static NetCommandMsg * readCompactGameMessage(UnsignedByte *data, Int &i, Int &lastLayout, ObjectID &lastObjectID);
 	static NetCommandMsg * readAckBothMessage(UnsignedByte *data, Int &i);
 	static NetCommandMsg * readAckStage1Message(UnsignedByte *data, Int &i);
 	static NetCommandMsg * readAckStage2Message(UnsignedByte *data, Int &i);
@@ -230,6 +241,7 @@ class NetPacket : public MemoryPoolObject
 
 	void writeGameMessageArgumentToPacket(GameMessageArgumentDataType type, GameMessageArgumentType arg);
 	static void readGameMessageArgumentFromPacket(GameMessageArgumentDataType type, NetGameCommandMsg *msg, UnsignedByte *data, Int &i);
+	static void readCompactGameMessageArgumentFromPacket(GameMessageArgumentDataType type, NetGameCommandMsg *msg, UnsignedByte *data, Int &i, ObjectID &lastObjectID);
 
 	void dumpPacketToLog();
 
@@ -245,6 +257,10 @@ class NetPacket : public MemoryPoolObject
 	UnsignedByte		m_lastPlayerID;
 	UnsignedByte		m_lastCommandType;
 	UnsignedByte		m_lastRelay;
+	ObjectID				m_lastObjectID;				///< last object id written by a compact game command
+	Int							m_lastArgumentLayout;	///< offset of the last compact argument layout, or -1
+
+	static Bool			s_compactGameCommands;
 };
 
 #endif // __NETPACKET_H
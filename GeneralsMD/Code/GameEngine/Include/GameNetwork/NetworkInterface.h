@@ -107,6 +107,8 @@ class NetworkInterface : public SubsystemInterface
 	virtual Real getOutgoingPacketsPerSecond( void ) = 0;
 	virtual Real getUnknownBytesPerSecond( void ) = 0;
 	virtual Real getUnknownPacketsPerSecond( void ) = 0;
+	virtual Real getIncomingPacketsPerCall( void ) = 0;		///< average packets read per socket service call
+	virtual Real getOutgoingPacketsPerCall( void ) = 0;		///< average packets written per socket service call
 
 	virtual void updateLoadProgress( Int percent ) = 0;
 	virtual void loadProgressComplete( void ) = 0;
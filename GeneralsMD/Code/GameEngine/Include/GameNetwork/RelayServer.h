@@ -0,0 +1,133 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+//																																						//
+//  (c) 2001-2003 Electronic Arts Inc.																				//
+//																																						//
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The relay server is a headless packet router.  It takes the job the ConnectionManager of whichever
+ * player is the packet router normally does in doRelay/sendRemoteCommand -- acking commands, fanning
+ * them out to the other players and sending the stage 2 ack once everyone has them -- off the players'
+ * machines, for as many games as we care to give it.
+ *
+ * Each game has a host slot.  The host is still the logical packet router: it decides the run ahead and
+ * everyone's frame data lives on the clients as before.  The only difference on the clients is that every
+ * remote Connection is addressed to the relay instead of the other player (run them with
+ * -relay <ip>:<port>), so the relay sees all the traffic.  Acks are always consumed by the relay, everything else is forwarded according to its relay
+ * mask, with retries handled by the relay's own Connection to each player.
+ *
+ * Nothing here touches TheGameLogic or TheGlobalData; one RelayServer is one event loop with its own
+ * Transport, so a process can run one per core.
+ */
+
+#pragma once
+
+#ifndef __RELAYSERVER_H
+#define __RELAYSERVER_H
+
+#include "GameNetwork/Connection.h"
+#include "GameNetwork/NetCommandList.h"
+#include "GameNetwork/Transport.h"
+#include "GameNetwork/NetworkDefs.h"
+
+enum { MAX_RELAY_GAMES = 64 };	///< games per RelayServer, i.e. per event loop
+
+class RelayGame : public MemoryPoolObject
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(RelayGame, "RelayGame")
+public:
+	RelayGame();
+	//~RelayGame();
+
+	void init(UnsignedInt gameID, UnsignedInt hostSlot, Transport *transport);
+	void reset();
+	void update();													///< Drop players that have finished leaving and send everything queued.
+
+	Bool addPlayer(UnsignedInt slot, UnsignedInt addr, UnsignedShort port);	///< Register the address a slot's packets come from.
+	Int findSlot(UnsignedInt addr, UnsignedShort port);	///< Returns the slot at that address, or -1.
+	void processCommand(NetCommandRef *ref, UnsignedInt slot);	///< Ack, relay and take metrics from a command the given slot sent us.
+	Bool isOver();													///< TRUE once every player has left.
+
+	UnsignedInt getGameID() { return m_gameID; }
+	UnsignedInt getHostSlot() { return m_hostSlot; }
+
+	// Run ahead metrics
+	Real getMaximumLatency();								///< Sum of the two highest reported latencies, as ConnectionManager computes it.
+	void getMinimumFps(Int &minFps, Int &minFpsPlayer);
+	Int getRunAhead() { return m_runAhead; }				///< The run ahead the host last issued.
+	Int getFrameRate() { return m_frameRate; }			///< The frame rate the host last issued.
+	UnsignedInt getFrameSpread();						///< How many frames the furthest ahead player leads the furthest behind one.
+
+protected:
+	void ackCommand(NetCommandRef *ref, UnsignedInt slot);
+	void relayCommand(NetCommandRef *ref, UnsignedInt slot);
+	void processAck(NetCommandMsg *msg);
+	void processRunAheadMetrics(NetRunAheadMetricsCommandMsg *msg);
+	UnsignedByte getLiveMask();								///< Slots we can still send to.
+
+	UnsignedInt m_gameID;
+	UnsignedInt m_hostSlot;
+	Transport *m_transport;
+
+	Connection *m_connections[MAX_SLOTS];
+	NetCommandList *m_relayedCommands;		///< Commands waiting on stage 2 acks; the relay mask holds who hasn't acked yet.
+
+	Real m_latencyAverages[MAX_SLOTS];		///< From each player's run ahead metrics.
+	Int m_fpsAverages[MAX_SLOTS];					///< From each player's run ahead metrics, -1 until we hear from them.
+	UnsignedInt m_lastFrameInfo[MAX_SLOTS];	///< The latest frame each player has sent a command count for.
+	Int m_runAhead;
+	Int m_frameRate;
+};
+
+class RelayServer
+{
+public:
+	RelayServer();
+	~RelayServer();
+
+	Bool init(UnsignedInt ip, UnsignedShort port);	///< Open the socket this event loop serves.
+	void reset();
+	void update();									///< One pass of the event loop: receive, relay, send.
+
+	RelayGame *addGame(UnsignedInt gameID, UnsignedInt hostSlot);	///< Returns NULL if this loop is full.
+	RelayGame *findGame(UnsignedInt gameID);
+	Int getNumGames() { return m_numGames; }
+	Transport *getTransport() { return m_transport; }
+
+protected:
+	RelayGame *findGameByAddress(UnsignedInt addr, UnsignedShort port, Int &slot);
+
+	Transport *m_transport;
+	RelayGame *m_games[MAX_RELAY_GAMES];
+	Int m_numGames;
+};
+
+#endif
@@ -60,6 +60,7 @@ class Transport //: public MemoryPoolObject
 
 	Bool init( AsciiString ip, UnsignedShort port );
 	Bool init( UnsignedInt ip, UnsignedShort port );
+	Bool init( UDP *sock, UnsignedInt ip, UnsignedShort port );	///< Run over a socket we're given, e.g. a LoopbackUDP.
 	void reset( void );
 	Bool update( void );									///< Call this once a GameEngine tick, regardless of whether the frame advances.
 
@@ -82,9 +83,10 @@ class Transport //: public MemoryPoolObject
 	Real getOutgoingPacketsPerSecond( void );
 	Real getUnknownBytesPerSecond( void );
 	Real getUnknownPacketsPerSecond( void );
+	Real getIncomingPacketsPerCall( void );		///< average batch size of doRecv calls that read anything
+	Real getOutgoingPacketsPerCall( void );		///< average batch size of doSend calls that wrote anything
 
-	TransportMessage m_outBuffer[MAX_MESSAGES];
-	TransportMessage m_inBuffer[MAX_MESSAGES];
+	TransportMessage m_inBuffer[MAX_MESSAGES];		///< received messages; consumers clear length once they've handled one
 
 #if defined(_DEBUG) || defined(_INTERNAL)
 	DelayedTransportMessage m_delayedInBuffer[MAX_MESSAGES];
@@ -95,6 +97,21 @@ class Transport //: public MemoryPoolObject
 	Bool m_winsockInit;
 	UDP *m_udpsock;
 
+	// The send queue and the receive queue are single-producer/single-consumer rings: only the
+	// producer advances the tail and only the consumer advances the head, so neither side locks or
+	// scans for free slots.  Heads and tails count up forever; index with & RING_MASK.
+	enum { RING_MASK = MAX_MESSAGES - 1 };	// MAX_MESSAGES must be a power of two
+
+	TransportMessage m_outBuffer[MAX_MESSAGES];		///< queued by queueSend, drained by doSend
+	volatile UnsignedInt m_outHead;
+	volatile UnsignedInt m_outTail;
+
+	TransportMessage m_recvRing[MAX_MESSAGES];		///< valid datagrams off the socket, waiting for a free m_inBuffer slot
+	volatile UnsignedInt m_recvHead;
+	volatile UnsignedInt m_recvTail;
+
+	void deliverIncoming( void );			///< move everything we can from m_recvRing into free m_inBuffer slots in one pass
+
 	// Latency insertion and packet loss
 	Bool m_useLatency;
 	Bool m_usePacketLoss;
@@ -106,6 +123,8 @@ class Transport //: public MemoryPoolObject
 	UnsignedInt m_incomingPackets[MAX_TRANSPORT_STATISTICS_SECONDS];
 	UnsignedInt m_unknownPackets[MAX_TRANSPORT_STATISTICS_SECONDS];
 	UnsignedInt m_outgoingPackets[MAX_TRANSPORT_STATISTICS_SECONDS];
+	UnsignedInt m_incomingBatches[MAX_TRANSPORT_STATISTICS_SECONDS];	///< doRecv calls that read at least one packet
+	UnsignedInt m_outgoingBatches[MAX_TRANSPORT_STATISTICS_SECONDS];	///< doSend calls that wrote at least one packet
 	Int m_statisticsSlot;
 	UnsignedInt m_lastSecond;
 
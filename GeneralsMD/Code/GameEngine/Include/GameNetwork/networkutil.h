@@ -47,6 +47,7 @@ Bool CommandRequiresAck(NetCommandMsg *msg);
 Bool CommandRequiresDirectSend(NetCommandMsg *msg);
 Bool IsCommandSynchronized(NetCommandType type);
 AsciiString GetAsciiNetCommandType(NetCommandType type);
+void ComputeRunAhead(Real maxLatency, Int minFps, Int frameRate, Int fpsLimit, Int slackPercent, Int &newRunAhead, Int &newFrameRate);
 
 #ifdef DEBUG_LOGGING
 extern "C" {
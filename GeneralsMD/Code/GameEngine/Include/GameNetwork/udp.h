@@ -114,12 +114,13 @@ class UDP
 
  public:
                    UDP();
-                  ~UDP();
-  Int           Bind(UnsignedInt IP,UnsignedShort port);
+  virtual         ~UDP();
+  // Virtual so the loopback network simulator (LoopbackUDP) can stand in for a real socket.
+  virtual Int   Bind(UnsignedInt IP,UnsignedShort port);
   Int           Bind(const char *Host,UnsignedShort port);
-  Int           Write(const unsigned char *msg,UnsignedInt len,UnsignedInt IP,UnsignedShort port);
-  Int           Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from);
-  sockStat         GetStatus(void);
+  virtual Int   Write(const unsigned char *msg,UnsignedInt len,UnsignedInt IP,UnsignedShort port);
+  virtual Int   Read(unsigned char *msg,UnsignedInt len,sockaddr_in *from);
+  virtual sockStat GetStatus(void);
   void             ClearStatus(void);
   //int              Wait(Int sec,Int usec,fd_set &returnSet);
   //int              Wait(Int sec,Int usec,fd_set &givenSet,fd_set &returnSet);
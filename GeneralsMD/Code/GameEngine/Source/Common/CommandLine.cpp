@@ -40,6 +40,7 @@
 #include "Common/CRCDebug.h"
 #include "Common/LocalFileSystem.h"
 #include "Common/Version.h"
+#include "Common/WorkerThreadPool.h"
 #include "GameClient/TerrainVisual.h" // for TERRAIN_LOD_MIN definition
 #include "GameClient/GameText.h"
 
@@ -61,6 +62,7 @@ Bool g_keepCRCSaves = FALSE;
 Bool g_crcModuleDataFromLogic = FALSE;
 Bool g_crcModuleDataFromClient = FALSE;
 Bool g_verifyClientCRC = FALSE; // verify that GameLogic CRC doesn't change from client
+Bool g_verifyIncrementalCRC = FALSE; // verify that the incremental object CRC matches a full walk
 Bool g_clientDeepCRC = FALSE;
 Bool g_logObjectCRCs = FALSE;
 #endif
@@ -290,6 +292,16 @@ Int parseVerifyClientCRC(char *args[], int argc)
 	return 1;
 }
 
+//=============================================================================
+//=============================================================================
+Int parseVerifyIncrementalCRC(char *args[], int argc)
+{
+#ifdef DEBUG_CRC
+	g_verifyIncrementalCRC = TRUE;
+#endif
+	return 1;
+}
+
 //=============================================================================
 //=============================================================================
 Int parseLogObjectCRCs(char *args[], int argc)
@@ -759,6 +771,72 @@ Int parseNoCinematic(char *args[], int)
 }
 #endif
 
+Int parseHeadless(char *args[], int)
+{
+	if (TheWritableGlobalData)
+	{
+		TheWritableGlobalData->m_headless = TRUE;
+		TheWritableGlobalData->m_windowed = TRUE;
+		TheWritableGlobalData->m_audioOn = false;
+		TheWritableGlobalData->m_speechOn = false;
+		TheWritableGlobalData->m_soundsOn = false;
+		TheWritableGlobalData->m_musicOn = false;
+		TheWritableGlobalData->m_videoOn = false;
+		TheWritableGlobalData->m_shellMapOn = FALSE;
+		TheWritableGlobalData->m_playIntro = FALSE;
+		TheWritableGlobalData->m_useFpsLimit = false;
+		TheWritableGlobalData->m_framesPerSecondLimit = 30000;
+	}
+	return 1;
+}
+
+Int parseSimulateReplay(char *args[], int num)
+{
+	if (TheWritableGlobalData && num > 1)
+	{
+		TheWritableGlobalData->m_simulateReplay = args[1];
+		parseHeadless(args, num);
+	}
+	return 2;
+}
+
+Int parseLogicThreads(char *args[], int num)
+{
+	if (TheWritableGlobalData && num > 1)
+	{
+		Int threads = atoi(args[1]);
+		if (threads < 0)
+			threads = 0;
+		if (threads > WorkerThreadPool::MAX_WORKER_THREADS)
+			threads = WorkerThreadPool::MAX_WORKER_THREADS;
+		TheWritableGlobalData->m_logicWorkerThreads = threads;
+	}
+	return 2;
+}
+
+Int parseRelay(char *args[], int num)
+{
+	if (TheWritableGlobalData && num > 1)
+	{
+		UnsignedInt a, b, c, d, port;
+		if (sscanf(args[1], "%u.%u.%u.%u:%u", &a, &b, &c, &d, &port) == 5)
+		{
+			TheWritableGlobalData->m_networkRelayIP = (a << 24) | (b << 16) | (c << 8) | d;
+			TheWritableGlobalData->m_networkRelayPort = (UnsignedShort)port;
+		}
+	}
+	return 2;
+}
+
+Int parseScriptPolling(char *args[], int)
+{
+	if (TheWritableGlobalData)
+	{
+		TheWritableGlobalData->m_scriptConditionPolling = TRUE;
+	}
+	return 1;
+}
+
 Int parseSync(char *args[], int)
 {
 	if (TheWritableGlobalData)
@@ -1155,6 +1233,11 @@ static CommandLineParam params[] =
 	{ "-mod", parseMod },
 	{ "-noshaders", parseNoShaders },
 	{ "-quickstart", parseQuickStart },
+	{ "-headless", parseHeadless },
+	{ "-simReplay", parseSimulateReplay },
+	{ "-logicThreads", parseLogicThreads },
+	{ "-scriptPolling", parseScriptPolling },
+	{ "-relay", parseRelay },
 
 #if (defined(_DEBUG) || defined(_INTERNAL))
 	{ "-noaudio", parseNoAudio },
@@ -1178,6 +1261,7 @@ static CommandLineParam params[] =
 	{ "-CRCClientModuleData", parseCRCClientModuleData },
 	{ "-ClientDeepCRC", parseClientDeepCRC },
 	{ "-VerifyClientCRC", parseVerifyClientCRC },
+	{ "-VerifyIncrementalCRC", parseVerifyIncrementalCRC },
 	{ "-LogObjectCRCs", parseLogObjectCRCs },
 	{ "-saveAllStats", parseSaveAllStats },
 	{ "-NetCRCInterval", parseNetCRCInterval },
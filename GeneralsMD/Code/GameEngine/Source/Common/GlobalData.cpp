@@ -494,6 +494,7 @@ GlobalData* GlobalData::m_theOriginal = NULL;
 	{ "NetworkDisconnectTime", INI::parseInt, NULL, offsetof(GlobalData, m_networkDisconnectTime) },
 	{ "NetworkPlayerTimeoutTime", INI::parseInt, NULL, offsetof(GlobalData, m_networkPlayerTimeoutTime) },
 	{ "NetworkDisconnectScreenNotifyTime", INI::parseInt, NULL, offsetof(GlobalData, m_networkDisconnectScreenNotifyTime) },
+	{ "NetworkCompactGameCommands", INI::parseBool, NULL, offsetof(GlobalData, m_networkCompactGameCommands) },
 	
 	{ "KeyboardCameraRotateSpeed", INI::parseReal, NULL, offsetof( GlobalData, m_keyboardCameraRotateSpeed ) },
 	{ "PlayStats",									INI::parseInt,				NULL,			offsetof( GlobalData, m_playStats ) },
@@ -784,6 +785,10 @@ GlobalData::GlobalData()
 //	m_inGame = FALSE;	
 
 	m_noDraw = 0;
+	m_headless = FALSE;
+	m_simulateReplay.clear();
+	m_logicWorkerThreads = 0;
+	m_scriptConditionPolling = FALSE;
 	m_particleScale = 1.0f;
 
 	m_autoFireParticleSmallMax = 0;
@@ -950,6 +955,9 @@ GlobalData::GlobalData()
 	m_networkDisconnectTime = 5000;
 	m_networkPlayerTimeoutTime = 60000;
 	m_networkDisconnectScreenNotifyTime = 15000;
+	m_networkRelayIP = 0;
+	m_networkRelayPort = 0;
+	m_networkCompactGameCommands = FALSE;
 
 	m_isBreakableMovie = FALSE;
 	m_breakTheMovie = FALSE;
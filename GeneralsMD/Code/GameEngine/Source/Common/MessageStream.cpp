@@ -69,7 +69,8 @@ CommandList *TheCommandList = NULL;
  */
 GameMessage::GameMessage( GameMessage::Type type ) 
 { 
-	m_playerIndex = ThePlayerList->getLocalPlayer()->getPlayerIndex();
+	// The relay server packetizes game commands without a game loaded, and so without a player list.
+	m_playerIndex = (ThePlayerList != NULL) ? ThePlayerList->getLocalPlayer()->getPlayerIndex() : 0;
 	m_type = type; 
 	m_argList = NULL;
 	m_argTail = NULL;
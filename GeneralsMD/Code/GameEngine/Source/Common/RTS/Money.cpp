@@ -60,6 +60,7 @@
 #include "Common/Player.h"
 #include "Common/PlayerList.h"
 #include "Common/Xfer.h"
+#include "GameLogic/ScriptEngine.h"
 
 // ------------------------------------------------------------------------------------------------
 UnsignedInt Money::withdraw(UnsignedInt amountToWithdraw, Bool playSound)
@@ -79,6 +80,8 @@ UnsignedInt Money::withdraw(UnsignedInt amountToWithdraw, Bool playSound)
 		TheAudio->addAudioEvent(&event);
 
 	m_money -= amountToWithdraw;
+	if (TheScriptEngine)
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_MONEY);
 
 	return amountToWithdraw;
 }
@@ -98,6 +101,8 @@ void Money::deposit(UnsignedInt amountToDeposit, Bool playSound)
 		TheAudio->addAudioEvent(&event);
 	
 	m_money += amountToDeposit;
+	if (TheScriptEngine)
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_MONEY);
 
 	if( amountToDeposit > 0 )
 	{
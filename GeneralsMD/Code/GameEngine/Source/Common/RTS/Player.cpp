@@ -1431,11 +1431,9 @@ static void doFindMostReadySpecialPowerForThing( Object *obj, void *userData )
 				&& !obj->isEffectivelyDead() )
 		{
 			// search the modules for the one with the matching template
-			for( BehaviorModule** m = obj->getBehaviorModules(); *m; ++m )
+			for( SpecialPowerModuleInterface** m = obj->getSpecialPowerModules(); *m; ++m )
 			{
-				SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-				if (!sp)
-					continue;
+				SpecialPowerModuleInterface* sp = *m;
 
 				UnsignedInt percentage = sp->getPercentReady();
 				if( percentage > info->highestPercentage )
@@ -1778,6 +1776,8 @@ void Player::addTeamToList(TeamPrototype* team)
 	}
 
 	m_playerTeamPrototypes.push_back(team);
+	if (TheScriptEngine)
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 }
 
 //=============================================================================
@@ -1789,6 +1789,8 @@ void Player::removeTeamFromList(TeamPrototype* team)
 		if (team == *it)
 		{
 			m_playerTeamPrototypes.erase(it);
+			if (TheScriptEngine)
+				TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 			return;
 		}
 	}
@@ -2567,11 +2569,9 @@ Bool Player::addScience(ScienceType science)
 				if (!obj)
 					continue;
 
-				for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+				for (SpecialPowerModuleInterface** m = obj->getSpecialPowerModules(); *m; ++m)
 				{
-					SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-					if (!sp)
-						continue;
+					SpecialPowerModuleInterface* sp = *m;
 
 					if (sp->getRequiredScience() == science)
 					{
@@ -175,6 +175,7 @@ void SpecialPowerStore::parseSpecialPowerDefinition( INI *ini )
 			specialPower->friend_setNameAndID(name, ++TheSpecialPowerStore->m_nextSpecialPowerID);
 			specialPower->markAsOverride();
 			TheSpecialPowerStore->m_specialPowerTemplates.push_back(specialPower);
+			TheSpecialPowerStore->m_specialPowerIndex.add(NAMEKEY(name), specialPower);
 		}
 	}
 	else
@@ -191,6 +192,7 @@ void SpecialPowerStore::parseSpecialPowerDefinition( INI *ini )
 				*specialPower = *defaultTemplate;
 			specialPower->friend_setNameAndID(name, ++TheSpecialPowerStore->m_nextSpecialPowerID);
 			TheSpecialPowerStore->m_specialPowerTemplates.push_back(specialPower);
+			TheSpecialPowerStore->m_specialPowerIndex.add(NAMEKEY(name), specialPower);
 		}
 	}
 
@@ -270,6 +272,7 @@ SpecialPowerStore::~SpecialPowerStore( void )
 
 	// erase the list
 	m_specialPowerTemplates.clear();
+	m_specialPowerIndex.clear();
 
 	// set our count to zero
 	m_nextSpecialPowerID = 0;
@@ -281,12 +284,7 @@ SpecialPowerStore::~SpecialPowerStore( void )
 SpecialPowerTemplate* SpecialPowerStore::findSpecialPowerTemplatePrivate( AsciiString name )
 {
 
-	// search the template list for matching name
-	for( Int i = 0; i < m_specialPowerTemplates.size(); ++i )
-		if( m_specialPowerTemplates[ i ]->getName() == name )
-			return m_specialPowerTemplates[ i ];
-
-	return NULL;  // not found
+	return m_specialPowerIndex.find( NAMEKEY( name ) );
 
 }
 
@@ -388,4 +386,9 @@ void SpecialPowerStore::reset( void )
 			++it;
 		}
 	}
+
+	// the map specific templates we just deleted may still be in the index
+	m_specialPowerIndex.clear();
+	for (Int i = 0; i < m_specialPowerTemplates.size(); ++i)
+		m_specialPowerIndex.add(NAMEKEY(m_specialPowerTemplates[i]->getName()), m_specialPowerTemplates[i]);
 }  // end reset
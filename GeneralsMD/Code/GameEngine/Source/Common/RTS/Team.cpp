@@ -287,8 +287,13 @@ void TeamFactory::removeTeamPrototypeFromList(TeamPrototype* team)
 // ------------------------------------------------------------------------
 TeamPrototype *TeamFactory::findTeamPrototype(const AsciiString& name)
 {
-	NameKeyType nk = NAMEKEY(name);
-	TeamPrototypeMap::iterator it = m_prototypes.find(nk);
+	return findTeamPrototypeByNameKey(NAMEKEY(name));
+}
+
+// ------------------------------------------------------------------------
+TeamPrototype *TeamFactory::findTeamPrototypeByNameKey(NameKeyType nameKey)
+{
+	TeamPrototypeMap::iterator it = m_prototypes.find(nameKey);
 	if (it != m_prototypes.end())
 		return it->second;
 
@@ -1347,6 +1352,7 @@ Team::Team(TeamPrototype *proto, TeamID id ) :
 	if (proto)
 	{
 		proto->prependTo_TeamInstanceList(this);
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 		if (!proto->getTemplateInfo()->m_scriptOnAllClear.isEmpty() ||
 				!proto->getTemplateInfo()->m_scriptOnEnemySighted.isEmpty())
 		{
@@ -1403,6 +1409,17 @@ Team::~Team()
 
 }
 
+// ------------------------------------------------------------------------
+void Team::setActive(void)
+{
+	if (!m_active) 
+	{ 
+		m_created = true;
+		m_active = true;
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
+	}
+}
+
 // ------------------------------------------------------------------------
 Player *Team::getControllingPlayer() const
 {
@@ -1824,6 +1841,7 @@ void Team::updateState(void)
 	if (m_created) 
 	{
 		m_created = false;
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 		// Run the on create script, if any.
 		if (!pInfo->m_scriptOnCreate.isEmpty()) 
 		{
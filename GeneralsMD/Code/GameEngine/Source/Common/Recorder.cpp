@@ -53,6 +53,7 @@
 #include "GameLogic/GameLogic.h"
 #include "Common/RandomValue.h"
 #include "Common/CRCDebug.h"
+#include "Common/crc.h"
 #include "Common/Version.h"
 
 #ifdef _INTERNAL
@@ -947,12 +948,21 @@ class CRCInfo
 	void setSawCRCMismatch(void) { m_sawCRCMismatch = TRUE; }
 	Bool sawCRCMismatch(void) { return m_sawCRCMismatch; }
 
+	void addCheckedCRC(UnsignedInt frame, UnsignedInt val);
+	UnsignedInt getNumCheckedCRCs(void) { return m_numCheckedCRCs; }
+	UnsignedInt getLastCheckedCRC(void) { return m_lastCheckedCRC; }
+	UnsignedInt getCheckedCRCDigest(void) { return m_checkedCRCDigest.get(); }
+
 protected:
 
 	Bool m_sawCRCMismatch;
 	Bool m_skippedOne;
 	std::list<UnsignedInt> m_data;
 	UnsignedInt m_localPlayer;
+
+	CRC m_checkedCRCDigest;					///< every (frame, crc) pair compared against the replay
+	UnsignedInt m_numCheckedCRCs;
+	UnsignedInt m_lastCheckedCRC;
 };
 
 CRCInfo::CRCInfo()
@@ -960,6 +970,16 @@ CRCInfo::CRCInfo()
 	m_localPlayer = ~0;
 	m_skippedOne = FALSE;
 	m_sawCRCMismatch = FALSE;
+	m_numCheckedCRCs = 0;
+	m_lastCheckedCRC = 0;
+}
+
+void CRCInfo::addCheckedCRC(UnsignedInt frame, UnsignedInt val)
+{
+	m_checkedCRCDigest.computeCRC(&frame, sizeof(frame));
+	m_checkedCRCDigest.computeCRC(&val, sizeof(val));
+	++m_numCheckedCRCs;
+	m_lastCheckedCRC = val;
 }
 
 void CRCInfo::addCRC(UnsignedInt val)
@@ -1007,6 +1027,7 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 	if (samePlayer || (localPlayerIndex < 0))
 	{
 		UnsignedInt playbackCRC = m_crcInfo->readCRC();
+		m_crcInfo->addCheckedCRC(TheGameLogic->getFrame(), newCRC);
 		//DEBUG_LOG(("RecorderClass::handleCRCMessage() - Comparing CRCs of %8.8X/%8.8X from %d\n", newCRC, playbackCRC, playerIndex));
 		if (TheGameLogic->getFrame() > 0 && newCRC != playbackCRC && !m_crcInfo->sawCRCMismatch())
 		{
@@ -1018,8 +1039,17 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 			// tail end of patch season, let's just disable the message, and hope the users believe the
 			// problem is fixed. -MDC 3/20/2003
 			//TheInGameUI->message("GUI:CRCMismatch");
-			DEBUG_CRASH(("Replay has gone out of sync!  All bets are off!\nOld:%8.8X New:%8.8X\nFrame:%d",
-				playbackCRC, newCRC, TheGameLogic->getFrame()));
+			if (TheGlobalData->m_headless)
+			{
+				// nobody is around to dismiss the dialog; the replay simulation reports it instead
+				DEBUG_LOG(("Replay has gone out of sync!  Old:%8.8X New:%8.8X Frame:%d\n",
+					playbackCRC, newCRC, TheGameLogic->getFrame()));
+			}
+			else
+			{
+				DEBUG_CRASH(("Replay has gone out of sync!  All bets are off!\nOld:%8.8X New:%8.8X\nFrame:%d",
+					playbackCRC, newCRC, TheGameLogic->getFrame()));
+			}
 		}
 		return;
 	}
@@ -1027,6 +1057,28 @@ void RecorderClass::handleCRCMessage(UnsignedInt newCRC, Int playerIndex, Bool f
 	//DEBUG_LOG(("RecorderClass::handleCRCMessage() - Skipping CRC of %8.8X from %d (our index is %d)\n", newCRC, playerIndex, localPlayerIndex));
 }
 
+/**
+ * Return true if the replay being played back has produced a CRC that differs from the recorded one.
+ */
+Bool RecorderClass::sawCRCMismatch( void )
+{
+	return m_crcInfo != NULL && m_crcInfo->sawCRCMismatch();
+}
+
+/**
+ * Return a digest of every (frame, CRC) pair the playback has compared against the recorded CRCs,
+ * optionally with how many there were and the last one.  Two builds that play a replay identically
+ * produce the same digest.
+ */
+UnsignedInt RecorderClass::getPlaybackCRCDigest( UnsignedInt *numCRCs, UnsignedInt *lastCRC )
+{
+	if (numCRCs)
+		*numCRCs = m_crcInfo ? m_crcInfo->getNumCheckedCRCs() : 0;
+	if (lastCRC)
+		*lastCRC = m_crcInfo ? m_crcInfo->getLastCheckedCRC() : 0;
+	return m_crcInfo ? m_crcInfo->getCheckedCRCDigest() : 0;
+}
+
 /**
  * Return true if this version of the file is the same as our version of the game
  */
@@ -0,0 +1,142 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ReplaySimulation.cpp ///////////////////////////////////////////////////////
+// Runs a recorded replay through the game logic as fast as possible with no
+// rendering, audio or frame limiting, and reports the CRC stream and timings.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include "Common/GameEngine.h"
+#include "Common/GlobalData.h"
+#include "Common/PerfTimer.h"
+#include "Common/Recorder.h"
+#include "Common/ReplaySimulation.h"
+
+#include "GameLogic/GameLogic.h"
+
+//-------------------------------------------------------------------------------------------------
+/** Print a line of the simulation report.  The report goes to stdout so that batch runs can
+	* redirect it, and to the debug log for builds that have one. */
+//-------------------------------------------------------------------------------------------------
+static void reportLine( const char *fmt, ... )
+{
+	char buf[1024];
+	va_list args;
+	va_start( args, fmt );
+	_vsnprintf( buf, sizeof(buf) - 1, fmt, args );
+	va_end( args );
+	buf[sizeof(buf) - 1] = 0;
+
+	printf( "%s\n", buf );
+	fflush( stdout );
+	DEBUG_LOG(( "ReplaySimulation: %s\n", buf ));
+}
+
+//-------------------------------------------------------------------------------------------------
+Int ReplaySimulation::simulateReplay( const AsciiString& filename )
+{
+	DEBUG_ASSERTCRASH( TheGlobalData->m_headless, ("ReplaySimulation - running without -headless will draw every frame") );
+
+	reportLine( "Simulating replay '%s'", filename.str() );
+
+	if( !TheRecorder->playbackFile( filename ) )
+	{
+		reportLine( "RESULT: FAILED - could not open '%s%s'", TheRecorder->getReplayDir().str(), filename.str() );
+		return 1;
+	}
+
+	UnsignedInt lastFrame = 0;
+	Bool started = FALSE;
+
+	DWORD startTime = timeGetTime();
+	DWORD loadedTime = startTime;
+
+	while( !TheGameEngine->getQuitting() )
+	{
+		TheGameEngine->update();
+
+		if( TheGameLogic->isInGame() )
+		{
+			if( !started )
+			{
+				// don't charge the map load to the simulation rate
+				started = TRUE;
+				loadedTime = timeGetTime();
+#ifdef PERF_TIMERS
+				PerfGather::resetAll();
+#endif
+			}
+
+			lastFrame = TheGameLogic->getFrame();
+		}
+		else if( started )
+		{
+			// the recorder clears the game data when it runs out of commands
+			break;
+		}
+	}
+
+	DWORD endTime = timeGetTime();
+
+	if( !started )
+	{
+		reportLine( "RESULT: FAILED - the game never started" );
+		return 1;
+	}
+
+	Real loadSeconds = (loadedTime - startTime) / 1000.0f;
+	Real simSeconds = (endTime - loadedTime) / 1000.0f;
+	Real gameSeconds = (Real)lastFrame / LOGICFRAMES_PER_SECOND;
+
+	reportLine( "Map load: %.2f s", loadSeconds );
+	reportLine( "Simulated %d frames (%.1f game seconds) in %.2f s", lastFrame, gameSeconds, simSeconds );
+	if( simSeconds > 0.0f )
+		reportLine( "Rate: %.1f frames/s, %.1fx real time", lastFrame / simSeconds, gameSeconds / simSeconds );
+	// the recorder folds every CRC the logic generated on its CRC frames, with the frame, into one
+	// value as it checks them against the replay, so builds can be compared without diffing the stream
+	UnsignedInt numCRCs = 0;
+	UnsignedInt lastCRC = 0;
+	UnsignedInt digest = TheRecorder->getPlaybackCRCDigest( &numCRCs, &lastCRC );
+	reportLine( "CRCs: %d, last %8.8X, digest %8.8X", numCRCs, lastCRC, digest );
+
+#ifdef PERF_TIMERS
+	PerfGather::dumpAll( lastFrame );
+#endif
+
+	if( TheRecorder->sawCRCMismatch() )
+	{
+		reportLine( "RESULT: MISMATCH - replay went out of sync" );
+		return 1;
+	}
+
+	reportLine( "RESULT: OK" );
+	return 0;
+
+}
@@ -77,6 +77,7 @@
 //         Defines                                                         
 //----------------------------------------------------------------------------
 
+enum { INITIAL_INDEX_SIZE = 4096 };	///< slots in the path index before the first grow (a power of two)
 
 
 //----------------------------------------------------------------------------
@@ -107,6 +108,60 @@ ArchiveFileSystem *TheArchiveFileSystem = NULL;
 //         Private Functions                                               
 //----------------------------------------------------------------------------
 
+/**
+	* Reduce a path to the key used by the path index: lower case, '\\' separators,
+	* no empty components, and ending with the component that holds the last '.'.
+	* That last rule is how the old per-directory tree told the file name from its
+	* directories, so a path finds exactly what it used to.  Returns FALSE for
+	* paths that have no such component or won't fit in _MAX_PATH.
+	*/
+static Bool normalizeArchivePath(const Char *filename, Char *path, UnsignedInt &hash)
+{
+	Int len = 0;
+	Int keyLen = 0;
+	Bool componentHasDot = FALSE;
+
+	for (const Char *c = filename; *c != 0; ++c) {
+		Char ch = *c;
+		if (ch == '\\' || ch == '/') {
+			if (componentHasDot) {
+				keyLen = len;
+				componentHasDot = FALSE;
+			}
+			if (len == 0 || path[len - 1] == '\\') {
+				continue;
+			}
+			ch = '\\';
+		} else {
+			ch = tolower((UnsignedByte)ch);
+			if (ch == '.') {
+				componentHasDot = TRUE;
+			}
+		}
+
+		if (len >= _MAX_PATH - 1) {
+			return FALSE;
+		}
+		path[len++] = ch;
+	}
+
+	if (componentHasDot) {
+		keyLen = len;
+	}
+	if (keyLen == 0) {
+		return FALSE;
+	}
+	path[keyLen] = 0;
+
+	// FNV-1a
+	hash = 2166136261U;
+	for (Int i = 0; i < keyLen; ++i) {
+		hash = (hash ^ (UnsignedByte)path[i]) * 16777619U;
+	}
+
+	return TRUE;
+}
+
 
 
 //----------------------------------------------------------------------------
@@ -116,7 +171,8 @@ ArchiveFileSystem *TheArchiveFileSystem = NULL;
 //------------------------------------------------------
 // ArchivedFileInfo
 //------------------------------------------------------
-ArchiveFileSystem::ArchiveFileSystem() 
+ArchiveFileSystem::ArchiveFileSystem() :
+	m_fileIndexCount(0)
 {
 }
 
@@ -133,7 +189,7 @@ ArchiveFileSystem::~ArchiveFileSystem()
 	}
 }
 
-void ArchiveFileSystem::loadIntoDirectoryTree(const ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite)
+void ArchiveFileSystem::loadIntoDirectoryTree(ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite)
 {
 
 	FilenameList filenameList;
@@ -143,40 +199,8 @@ void ArchiveFileSystem::loadIntoDirectoryTree(const ArchiveFile *archiveFile, co
 	FilenameListIter it = filenameList.begin();
 
 	while (it != filenameList.end()) {
-		// add this filename to the directory tree.
-		AsciiString path = *it;
-		path.toLower();
-		AsciiString token;
-		AsciiString debugpath;
-
-		ArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
-
-		Bool infoInPath;
-		infoInPath = path.nextToken(&token, "\\/");
-
-		while (infoInPath && (!token.find('.') || path.find('.'))) {
-			ArchivedDirectoryInfoMap::iterator tempiter = dirInfo->m_directories.find(token);
-			if (tempiter == dirInfo->m_directories.end()) 
-			{
-				dirInfo->m_directories[token].clear();
-				dirInfo->m_directories[token].m_directoryName = token;
-			}
-
-			dirInfo = &(dirInfo->m_directories[token]);
-			debugpath.concat(token);
-			debugpath.concat('\\');
-			infoInPath = path.nextToken(&token, "\\/");
-		}
-
-		// token is the filename, and dirInfo is the directory that this file is in.
-		if (dirInfo->m_files.find(token) == dirInfo->m_files.end() || overwrite) {
-			AsciiString path2;
-			path2 = debugpath;
-			path2.concat(token);
-//			DEBUG_LOG(("ArchiveFileSystem::loadIntoDirectoryTree - adding file %s, archived in %s\n", path2.str(), archiveFilename.str()));
-			dirInfo->m_files[token] = archiveFilename;
-		}
-
+		// add this filename to the index, unless an earlier archive already has it and we aren't overriding.
+		addIndexEntry((*it).str(), archiveFile, archiveFilename, overwrite);
 		it++;
 	}
 }
@@ -210,46 +234,18 @@ void ArchiveFileSystem::loadMods() {
 
 Bool ArchiveFileSystem::doesFileExist(const Char *filename) const
 {
-	AsciiString path = filename;
-	path.toLower();
-	AsciiString token;
-
-	const ArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
-
-	path.nextToken(&token, "\\/");
-
-	while (!token.find('.') || path.find('.')) 
-	{
-		ArchivedDirectoryInfoMap::const_iterator tempiter = dirInfo->m_directories.find(token);
-		if (tempiter != dirInfo->m_directories.end()) 
-		{
-			dirInfo = &tempiter->second;
-			path.nextToken(&token, "\\/");
-		}
-		else
-		{
-			// the directory doesn't exist, so return false
-			return FALSE;
-		}
-	}
-
-	// token is the filename, and dirInfo is the directory that this file is in.
-	if (dirInfo->m_files.find(token) == dirInfo->m_files.end()) {
-		return FALSE;
-	}
-	return TRUE;
+	return findIndexEntry(filename) != NULL;
 }
 
 File * ArchiveFileSystem::openFile(const Char *filename, Int access /* = 0 */) 
 {
-	AsciiString archiveFilename;
-	archiveFilename = getArchiveFilenameForFile(AsciiString(filename));
+	const ArchivedFileIndexEntry *entry = findIndexEntry(filename);
 
-	if (archiveFilename.getLength() == 0) {
+	if (entry == NULL) {
 		return NULL;
 	}
 
-	return m_archiveFileMap[archiveFilename]->openFile(filename, access);
+	return entry->m_archiveFile->openFile(filename, access);
 }
 
 Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileInfo) const
@@ -262,11 +258,10 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 		return FALSE;
 	}
 
-	AsciiString archiveFilename = getArchiveFilenameForFile(filename);
-	ArchiveFileMap::const_iterator it = m_archiveFileMap.find(archiveFilename);
-	if (it != m_archiveFileMap.end())
+	const ArchivedFileIndexEntry *entry = findIndexEntry(filename.str());
+	if (entry != NULL)
 	{
-		return it->second->getFileInfo(filename, fileInfo);
+		return entry->m_archiveFile->getFileInfo(filename, fileInfo);
 	}
 	else
 	{
@@ -276,55 +271,118 @@ Bool ArchiveFileSystem::getFileInfo(const AsciiString& filename, FileInfo *fileI
 
 AsciiString ArchiveFileSystem::getArchiveFilenameForFile(const AsciiString& filename) const
 {
-	AsciiString path;
-	path = filename;
-	path.toLower();
-	AsciiString token;
-	AsciiString debugpath;
+	const ArchivedFileIndexEntry *entry = findIndexEntry(filename.str());
+	if (entry != NULL)
+	{
+		return entry->m_archiveFilename;
+	}
+	else
+	{
+		return AsciiString::TheEmptyString;
+	}
 
-	const ArchivedDirectoryInfo *dirInfo = &m_rootDirectory;
+}
 
-	path.nextToken(&token, "\\/");
+//------------------------------------------------------
+// Path index
+//------------------------------------------------------
+const ArchivedFileIndexEntry * ArchiveFileSystem::findIndexEntry(const Char *filename) const
+{
+	if (m_fileIndexCount == 0) {
+		return NULL;
+	}
 
-	while (!token.find('.') || path.find('.')) {
+	Char path[_MAX_PATH];
+	UnsignedInt hash;
+	if (!normalizeArchivePath(filename, path, hash)) {
+		return NULL;
+	}
 
-		ArchivedDirectoryInfoMap::const_iterator it = dirInfo->m_directories.find(token);
-		if (it != dirInfo->m_directories.end())
-		{
-			dirInfo = &it->second;
+	UnsignedInt mask = m_fileIndex.size() - 1;
+	for (UnsignedInt slot = hash & mask; ; slot = (slot + 1) & mask) {
+		const ArchivedFileIndexEntry &entry = m_fileIndex[slot];
+		if (entry.m_path.isEmpty()) {
+			return NULL;
 		}
-		else
-		{
-			// the directory doesn't exist, so return NULL
-
-			// dump the directories;
-			//DEBUG_LOG(("directory %s not found in %s in archive file system\n", token.str(), debugpath.str()));
-			//DEBUG_LOG(("directories in %s in archive file system are:\n", debugpath.str()));
-			//ArchivedDirectoryInfoMap::const_iterator it = dirInfo->m_directories.begin();
-			//while (it != dirInfo->m_directories.end()) {
-			//	DEBUG_LOG(("\t%s\n", it->second.m_directoryName.str()));
-			//	it++;
-			//}
-			//DEBUG_LOG(("end of directory list.\n"));
-			return AsciiString::TheEmptyString;
+		if (entry.m_hash == hash && strcmp(entry.m_path.str(), path) == 0) {
+			return &entry;
 		}
+	}
+}
 
-		debugpath.concat(token);
-		debugpath.concat('\\');
+void ArchiveFileSystem::addIndexEntry(const Char *filename, ArchiveFile *archiveFile, const AsciiString& archiveFilename, Bool overwrite)
+{
+	Char path[_MAX_PATH];
+	UnsignedInt hash;
+	if (!normalizeArchivePath(filename, path, hash)) {
+		// the old directory tree couldn't find these either.
+		return;
+	}
 
-		path.nextToken(&token, "\\/");
+	// keep the load factor at or below one half so probe runs stay short.
+	if ((m_fileIndexCount + 1) * 2 > (Int)m_fileIndex.size()) {
+		resizeIndex(m_fileIndex.empty() ? INITIAL_INDEX_SIZE : m_fileIndex.size() * 2);
 	}
 
-	ArchivedFileLocationMap::const_iterator it = dirInfo->m_files.find(token);
-	if (it != dirInfo->m_files.end())
-	{
-		return it->second;
+	UnsignedInt mask = m_fileIndex.size() - 1;
+	for (UnsignedInt slot = hash & mask; ; slot = (slot + 1) & mask) {
+		ArchivedFileIndexEntry &entry = m_fileIndex[slot];
+		if (entry.m_path.isEmpty()) {
+			entry.m_hash = hash;
+			entry.m_path = path;
+			entry.m_archiveFilename = archiveFilename;
+			entry.m_archiveFile = archiveFile;
+			++m_fileIndexCount;
+			return;
+		}
+		if (entry.m_hash == hash && strcmp(entry.m_path.str(), path) == 0) {
+			if (overwrite) {
+				entry.m_archiveFilename = archiveFilename;
+				entry.m_archiveFile = archiveFile;
+			}
+			return;
+		}
 	}
-	else
-	{
-		return AsciiString::TheEmptyString;
+}
+
+void ArchiveFileSystem::removeArchiveFromIndex(const ArchiveFile *archiveFile)
+{
+	// clearing slots in place would break other entries' probe runs, so clear then rehash.
+	Int removed = 0;
+	for (ArchivedFileIndex::iterator it = m_fileIndex.begin(); it != m_fileIndex.end(); ++it) {
+		if (it->m_archiveFile == archiveFile) {
+			it->m_path.clear();
+			++removed;
+		}
 	}
 
+	if (removed > 0) {
+		resizeIndex(m_fileIndex.size());
+	}
+}
+
+void ArchiveFileSystem::resizeIndex(Int capacity)
+{
+	DEBUG_ASSERTCRASH((capacity & (capacity - 1)) == 0, ("ArchiveFileSystem::resizeIndex - capacity %d is not a power of two", capacity));
+
+	ArchivedFileIndex oldIndex;
+	oldIndex.swap(m_fileIndex);
+	m_fileIndex.resize(capacity);
+	m_fileIndexCount = 0;
+
+	UnsignedInt mask = capacity - 1;
+	for (ArchivedFileIndex::iterator it = oldIndex.begin(); it != oldIndex.end(); ++it) {
+		if (it->m_path.isEmpty()) {
+			continue;
+		}
+
+		UnsignedInt slot = it->m_hash & mask;
+		while (!m_fileIndex[slot].m_path.isEmpty()) {
+			slot = (slot + 1) & mask;
+		}
+		m_fileIndex[slot] = *it;
+		++m_fileIndexCount;
+	}
 }
 
 void ArchiveFileSystem::getFileListInDirectory(const AsciiString& currentDirectory, const AsciiString& originalDirectory, const AsciiString& searchName, FilenameList &filenameList, Bool searchSubdirectories) const
@@ -1498,6 +1498,45 @@ void Checkpointable::debugResetCheckpoints()
 }
 #endif
 
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+// PER-THREAD MAGAZINES
+//-----------------------------------------------------------------------------
+
+enum
+{
+	MAGAZINE_SIZE = 32,										///< most free blocks a thread holds for any one pool
+	MAGAZINE_BATCH = MAGAZINE_SIZE / 2,		///< blocks moved between a magazine and its pool at a time
+	MAX_MAGAZINE_POOLS = 2048							///< pools created after this many just always take the lock
+};
+
+/**
+	A thread's private stack of free blocks for one pool. As far as the blobs are concerned
+	these blocks are in use; as far as the pool's counts are concerned, they're free.
+*/
+struct PoolMagazine
+{
+	MemoryPool							*m_pool;
+	Int											m_generation;		///< the pool's m_magazineGeneration when these blocks were taken
+	Int											m_count;
+	MemoryPoolSingleBlock		*m_blocks[MAGAZINE_SIZE];
+};
+
+/**
+	All of one thread's magazines, indexed by MemoryPool::m_magazineIndex. Only the owning 
+	thread ever touches these; a pool that is reset or destroyed leaves a note for the 
+	owners instead (see discardMagazines), and each thread throws away its own stale blocks.
+*/
+struct ThreadMagazines
+{
+	PoolMagazine						*m_magazines[MAX_MAGAZINE_POOLS];
+};
+
+static __declspec(thread) ThreadMagazines *theThreadMagazines = NULL;	///< null for threads that don't use magazines
+static long theNextMagazineIndex = 0;
+static Bool theRetiredMagazineSlots[MAX_MAGAZINE_POOLS];						///< slots of destroyed pools. protected by TheMemoryPoolCriticalSection
+#endif
+
 //-----------------------------------------------------------------------------
 // METHODS for MemoryPool
 //-----------------------------------------------------------------------------
@@ -1519,6 +1558,10 @@ MemoryPool::MemoryPool() :
 	m_firstBlob(NULL),
 	m_lastBlob(NULL),
 	m_firstBlobWithFreeBlocks(NULL)
+#ifdef MEMORYPOOL_MAGAZINES
+	, m_magazineIndex(-1)
+	, m_magazineGeneration(0)
+#endif
 {
 }
 
@@ -1541,6 +1584,15 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 	m_lastBlob = NULL;
 	m_firstBlobWithFreeBlocks = NULL;
 
+#ifdef MEMORYPOOL_MAGAZINES
+	// reset() comes back thru here; keep our slot.
+	if (m_magazineIndex < 0)
+	{
+		Int index = InterlockedIncrement(&theNextMagazineIndex) - 1;
+		m_magazineIndex = (index < MAX_MAGAZINE_POOLS) ? index : -1;
+	}
+#endif
+
 	// go ahead and init the initial block here (will throw on failure)
 	createBlob(m_initialAllocationCount);
 }
@@ -1551,6 +1603,10 @@ void MemoryPool::init(MemoryPoolFactory *factory, const char *poolName, Int allo
 */
 MemoryPool::~MemoryPool()
 {   
+#ifdef MEMORYPOOL_MAGAZINES
+	discardMagazines(TRUE);
+#endif
+
 	// toss everything. we could do this slightly more efficiently,
 	// but not really worth the extra code to do so.
 	while (m_firstBlob) 
@@ -1621,7 +1677,7 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 	::sysFree((void *)blob);
 
 	// finally... bookkeeping
-	m_usedBlocksInPool -= usedBlocksInBlob;
+	InterlockedExchangeAdd((long *)&m_usedBlocksInPool, -usedBlocksInBlob);
 	m_totalBlocksInPool -= totalBlocksInBlob;
 
 #ifdef MEMORYPOOL_DEBUG
@@ -1633,14 +1689,12 @@ Int MemoryPool::freeBlob(MemoryPoolBlob* blob)
 
 //-----------------------------------------------------------------------------
 /**
-	allocate a block from this pool and return it, but don't bother zeroing
-	out the block. if unable to allocate, throw ERROR_OUT_OF_MEMORY. this
-	function will never return null.
+	take a free block out of this pool's blobs. if there aren't any, create an overflow
+	blob if allowGrow is set (throwing ERROR_OUT_OF_MEMORY if the pool may not grow), 
+	otherwise return null. the caller must hold TheMemoryPoolCriticalSection.
 */
-void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
+MemoryPoolSingleBlock* MemoryPool::takeBlockFromBlobs(Bool allowGrow DECLARE_LITERALSTRING_ARG2)
 {
-	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
-
 	if (m_firstBlobWithFreeBlocks != NULL && !m_firstBlobWithFreeBlocks->hasAnyFreeBlocks()) 
 	{
 		// hmm... the current 'free' blob has nothing available. look and see if there
@@ -1660,7 +1714,11 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 	// allocate an overflow block.
 	if (m_firstBlobWithFreeBlocks == NULL) 
 	{
-		if (m_overflowAllocationCount == 0)
+		if (!allowGrow)
+		{
+			return NULL;
+		}
+		else if (m_overflowAllocationCount == 0)
 		{
 			throw ERROR_OUT_OF_MEMORY;	// this pool is not allowed to grow
 		}
@@ -1677,6 +1735,178 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 	MemoryPoolSingleBlock *block = blob->allocateSingleBlock(PASS_LITERALSTRING_ARG1);
 	DEBUG_ASSERTCRASH(block, ("should not fail here"));
 
+	return block;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	give a block back to the blob it came from. the caller must hold 
+	TheMemoryPoolCriticalSection.
+*/
+void MemoryPool::returnBlockToBlob(MemoryPoolSingleBlock *block)
+{
+	MemoryPoolBlob *blob = block->getOwningBlob();
+	
+	DEBUG_ASSERTCRASH(blob && blob->getOwningPool() == this, ("block does not belong to this pool"));
+
+	blob->freeSingleBlock(block);
+	
+	// if we want to free the blobs as they become empty, do that here.
+	// normally we don't bother, but just in case this is ever desired, here's how you'd do it...
+	//
+	// if (blob->m_usedBlocksInBlob == 0) 
+	// {
+	//	freeBlob(blob);
+	//	return;
+	//} 
+	
+	if (!m_firstBlobWithFreeBlocks)
+		m_firstBlobWithFreeBlocks = blob;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	the used count can change without the pool lock (see the magazines), so it's
+	always updated atomically.
+*/
+inline void MemoryPool::noteBlockAllocated()
+{
+	Int used = InterlockedIncrement((long *)&m_usedBlocksInPool);
+	// raise the peak atomically. if the exchange hands back a bigger peak than ours,
+	// another thread got there first and we just lowered it, so put theirs back.
+	while (m_peakUsedBlocksInPool < used)
+	{
+		Int old = InterlockedExchange((long *)&m_peakUsedBlocksInPool, used);
+		if (old <= used)
+			break;
+		used = old;
+	}
+}
+
+//-----------------------------------------------------------------------------
+inline void MemoryPool::noteBlockFreed()
+{
+	InterlockedDecrement((long *)&m_usedBlocksInPool);
+}
+
+#ifdef MEMORYPOOL_MAGAZINES
+//-----------------------------------------------------------------------------
+inline PoolMagazine* MemoryPool::getThreadMagazine()
+{
+	ThreadMagazines *tm = theThreadMagazines;
+	if (tm == NULL || m_magazineIndex < 0)
+		return NULL;
+
+	PoolMagazine *mag = tm->m_magazines[m_magazineIndex];
+	if (mag == NULL)
+	{
+		mag = (PoolMagazine *)::sysAllocateDoNotZero(sizeof(PoolMagazine));	// throws on failure
+		mag->m_pool = this;
+		mag->m_generation = m_magazineGeneration;
+		mag->m_count = 0;
+		tm->m_magazines[m_magazineIndex] = mag;
+	}
+	else if (mag->m_generation != m_magazineGeneration)
+	{
+		// the pool was reset since we last used it, and our blocks went with its blobs.
+		mag->m_generation = m_magazineGeneration;
+		mag->m_count = 0;
+	}
+
+	DEBUG_ASSERTCRASH(mag->m_pool == this, ("magazine belongs to another pool"));
+	return mag;
+}
+
+//-----------------------------------------------------------------------------
+/**
+	move up to MAGAZINE_BATCH free blocks from the blobs into an empty magazine.
+	grows the pool only if there are no free blocks at all.
+*/
+void MemoryPool::refillMagazine(PoolMagazine *mag)
+{
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	DEBUG_ASSERTCRASH(mag->m_count == 0, ("refilling a magazine that isn't empty"));
+
+	// throws if the pool is out and can't grow
+	mag->m_blocks[mag->m_count++] = takeBlockFromBlobs(true);
+
+	while (mag->m_count < MAGAZINE_BATCH)
+	{
+		MemoryPoolSingleBlock *block = takeBlockFromBlobs(false);
+		if (block == NULL)
+			break;
+		mag->m_blocks[mag->m_count++] = block;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void MemoryPool::drainMagazine(PoolMagazine *mag, Int keep)
+{
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	while (mag->m_count > keep)
+		returnBlockToBlob(mag->m_blocks[--mag->m_count]);
+}
+
+//-----------------------------------------------------------------------------
+void MemoryPool::releaseMagazine(PoolMagazine *mag)
+{
+	if (mag->m_generation == m_magazineGeneration)
+		drainMagazine(mag, 0);
+}
+
+//-----------------------------------------------------------------------------
+/**
+	the blocks every thread is holding for this pool are about to go away with the 
+	blobs they live in. we never touch other threads' magazines: a reset bumps the 
+	generation, so each thread empties its own magazine the next time it uses the pool,
+	and a destroyed pool retires its slot, so each thread just frees its magazine when it
+	shuts down its cache. (if another thread is using this pool while it is being reset
+	or destroyed, you were already in trouble.)
+*/
+void MemoryPool::discardMagazines(Bool destroying)
+{
+	if (m_magazineIndex < 0)
+		return;
+
+	if (destroying)
+	{
+		ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+		theRetiredMagazineSlots[m_magazineIndex] = TRUE;
+	}
+	else
+	{
+		InterlockedIncrement((long *)&m_magazineGeneration);
+	}
+}
+#endif
+
+//-----------------------------------------------------------------------------
+/**
+	allocate a block from this pool and return it, but don't bother zeroing
+	out the block. if unable to allocate, throw ERROR_OUT_OF_MEMORY. this
+	function will never return null.
+*/
+void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG1)
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	PoolMagazine *mag = getThreadMagazine();
+	if (mag)
+	{
+		if (mag->m_count == 0)
+			refillMagazine(mag);	// throws on failure
+
+		MemoryPoolSingleBlock *block = mag->m_blocks[--mag->m_count];
+		noteBlockAllocated();
+		return block->getUserData();
+	}
+#endif
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	MemoryPoolSingleBlock *block = takeBlockFromBlobs(true PASS_LITERALSTRING_ARG2);	// throws on failure
+
 #ifdef MEMORYPOOL_CHECKPOINTING
 	BlockCheckpointInfo *bi = debugAddCheckpointInfo(block->debugGetLiteralTagString(), m_factory->getCurCheckpoint(), getAllocationSize());
 	if (bi)
@@ -1684,9 +1914,7 @@ void* MemoryPool::allocateBlockDoNotZeroImplementation(DECLARE_LITERALSTRING_ARG
 #endif
 
 	// bookkeeping
-	++m_usedBlocksInPool;
-	if (m_peakUsedBlocksInPool < m_usedBlocksInPool)
-		m_peakUsedBlocksInPool = m_usedBlocksInPool;
+	noteBlockAllocated();
 
 #ifdef MEMORYPOOL_DEBUG
 	m_factory->adjustTotals(debugLiteralTagString, 1*getAllocationSize(), 0);
@@ -1723,16 +1951,30 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;	// my, that was easy
 
+	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+
+#ifdef MEMORYPOOL_MAGAZINES
+	PoolMagazine *mag = getThreadMagazine();
+	if (mag)
+	{
+		DEBUG_ASSERTCRASH(block->getOwningBlob() && block->getOwningBlob()->getOwningPool() == this, ("block does not belong to this pool"));
+
+		// full? hand a batch back to the blobs so other threads can have them.
+		if (mag->m_count == MAGAZINE_SIZE)
+			drainMagazine(mag, MAGAZINE_SIZE - MAGAZINE_BATCH);
+
+		mag->m_blocks[mag->m_count++] = block;
+		noteBlockFreed();
+		return;
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
-	MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
-	MemoryPoolBlob *blob = block->getOwningBlob();
 #ifdef MEMORYPOOL_DEBUG
 	const char* tagString = block->debugGetLiteralTagString();
 #endif
 	
-	DEBUG_ASSERTCRASH(blob && blob->getOwningPool() == this, ("block does not belong to this pool"));
-
 #ifdef MEMORYPOOL_CHECKPOINTING
 	BlockCheckpointInfo *bi = block->debugGetCheckpointInfo();
 	DEBUG_ASSERTCRASH(bi, ("hmm, no checkpoint info"));
@@ -1740,22 +1982,10 @@ void MemoryPool::freeBlock(void* pBlockPtr)
 		bi->debugSetFreepoint(m_factory->getCurCheckpoint());
 #endif
 
-	blob->freeSingleBlock(block);
-	
-	// if we want to free the blobs as they become empty, do that here.
-	// normally we don't bother, but just in case this is ever desired, here's how you'd do it...
-	//
-	// if (blob->m_usedBlocksInBlob == 0) 
-	// {
-	//	freeBlob(blob);
-	//	return;
-	//} 
-	
-	if (!m_firstBlobWithFreeBlocks)
-		m_firstBlobWithFreeBlocks = blob;
+	returnBlockToBlob(block);
 
 	// bookkeeping
-	--m_usedBlocksInPool;
+	noteBlockFreed();
 
 #ifdef MEMORYPOOL_DEBUG
 	m_factory->adjustTotals(tagString, -1*getAllocationSize(), 0);
@@ -1803,6 +2033,10 @@ Int MemoryPool::releaseEmpties()
 */
 void MemoryPool::reset()
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	discardMagazines(FALSE);
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
 
 	// toss everything. we could do this slightly more efficiently,
@@ -2171,6 +2405,19 @@ void DynamicMemoryAllocator::debugIgnoreLeaksForThisBlock(void* pBlockPtr)
 */
 void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes DECLARE_LITERALSTRING_ARG2)
 {
+#ifdef MEMORYPOOL_MAGAZINES
+	// pooled sizes don't need the dma lock: the subpool has its own (and usually won't need even that)
+	{
+		MemoryPool *pool = findPoolForSize(numBytes);
+		if (pool != NULL)
+		{
+			void *result = pool->allocateBlockDoNotZeroImplementation(PASS_LITERALSTRING_ARG1);
+			InterlockedIncrement((long *)&m_usedBlocksInDma);
+			return result;
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
 
 	void *result = NULL;
@@ -2245,7 +2492,7 @@ void *DynamicMemoryAllocator::allocateBytesDoNotZeroImplementation(Int numBytes
 }
 #endif MEMORYPOOL_DEBUG
 
-	++m_usedBlocksInDma;
+	InterlockedIncrement((long *)&m_usedBlocksInDma);
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 #ifdef MEMORYPOOL_DEBUG
 	#ifdef USE_FILLER_VALUE
@@ -2287,6 +2534,19 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 	if (!pBlockPtr)
 		return;
 
+#ifdef MEMORYPOOL_MAGAZINES
+	// as in allocateBytesDoNotZeroImplementation, pooled blocks skip the dma lock
+	{
+		MemoryPoolSingleBlock *block = MemoryPoolSingleBlock::recoverBlockFromUserData(pBlockPtr);
+		if (block->getOwningBlob()) 
+		{
+			block->getOwningBlob()->getOwningPool()->freeBlock(pBlockPtr);
+			InterlockedDecrement((long *)&m_usedBlocksInDma);
+			return;
+		}
+	}
+#endif
+
 	ScopedCriticalSection scopedCriticalSection(TheDmaCriticalSection);
 
 #ifdef MEMORYPOOL_CHECK_BLOCK_OWNERSHIP
@@ -2351,7 +2611,7 @@ void DynamicMemoryAllocator::freeBytes(void* pBlockPtr)
 		::sysFree((void *)block);
 
 	}
-	--m_usedBlocksInDma;
+	InterlockedDecrement((long *)&m_usedBlocksInDma);
 	DEBUG_ASSERTCRASH(m_usedBlocksInDma >= 0, ("negative count for m_usedBlocksInDma"));
 
 #ifdef INTENSE_DMA_BOOKKEEPING
@@ -3483,6 +3743,55 @@ void initMemoryManager()
 
 	theMainInitFlag = true;
 
+	initThreadMemoryCache();
+}
+
+//-----------------------------------------------------------------------------
+/**
+	start giving the calling thread its own magazines. (see GameMemory.h)
+*/
+void initThreadMemoryCache()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	if (theThreadMagazines != NULL)
+		return;
+
+	ThreadMagazines *tm = (ThreadMagazines *)::sysAllocateDoNotZero(sizeof(ThreadMagazines));	// throws on failure
+	memset(tm, 0, sizeof(ThreadMagazines));
+	theThreadMagazines = tm;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+/**
+	return every block in the calling thread's magazines to its pool, and stop using
+	magazines on this thread.
+*/
+void shutdownThreadMemoryCache()
+{
+#ifdef MEMORYPOOL_MAGAZINES
+	ThreadMagazines *tm = theThreadMagazines;
+	if (tm == NULL)
+		return;
+
+	theThreadMagazines = NULL;
+
+	ScopedCriticalSection scopedCriticalSection(TheMemoryPoolCriticalSection);
+
+	for (Int i = 0; i < MAX_MAGAZINE_POOLS; ++i)
+	{
+		PoolMagazine *mag = tm->m_magazines[i];
+		if (mag)
+		{
+			// a retired slot's pool is gone, and its blocks with it.
+			if (!theRetiredMagazineSlots[i])
+				mag->m_pool->releaseMagazine(mag);
+			::sysFree((void *)mag);
+		}
+	}
+
+	::sysFree((void *)tm);
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -3531,6 +3840,8 @@ void shutdownMemoryManager()
 	}
 	else
 	{
+		shutdownThreadMemoryCache();
+
 		if (TheDynamicMemoryAllocator)
 		{
 			DEBUG_ASSERTCRASH(TheMemoryPoolFactory, ("hmm, no factory"));
@@ -99,7 +99,7 @@
 //         Private Data                                                     
 //----------------------------------------------------------------------------
 
-static Int s_totalOpen = 0;
+static LONG s_totalOpen = 0;	///< archives are opened from worker threads while mounting
 
 //----------------------------------------------------------------------------
 //         Public Data                                                      
@@ -147,14 +147,14 @@ LocalFile::~LocalFile()
 	{
 		fclose(m_file);
 		m_file = NULL;
-		--s_totalOpen;
+		InterlockedDecrement(&s_totalOpen);
 	}
 #else
 	if( m_handle != -1 )
 	{
 		_close( m_handle );
 		m_handle = -1;
-		--s_totalOpen;
+		InterlockedDecrement(&s_totalOpen);
 	}
 #endif
 
@@ -286,7 +286,7 @@ Bool LocalFile::open( const Char *filename, Int access )
 
 #endif
 
-	++s_totalOpen;
+	InterlockedIncrement(&s_totalOpen);
 ///	DEBUG_LOG(("LocalFile::open %s (total %d)\n",filename,s_totalOpen));
 	if ( m_access & APPEND )
 	{
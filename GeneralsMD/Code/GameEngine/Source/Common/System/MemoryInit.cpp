@@ -365,6 +365,7 @@ static PoolSizeRec sizes[] =
 	{ "DeployStyleAIUpdate", 32, 32 },
 	{ "AssaultTransportAIUpdate", 64, 32 },
 	{ "StreamingArchiveFile", 8, 8 },
+	{ "Win32MappedArchiveFile", 32, 32 },
 
 	{ "DozerActionStateMachine", 256, 32 },
 	{ "DozerPrimaryStateMachine", 256, 32 },
@@ -633,6 +634,7 @@ static PoolSizeRec sizes[] =
 	{ "Connection", 32, 32 },
 	{ "User", 32, 32 },
 	{ "FrameDataManager", 32, 32 },
+	{ "RelayGame", 32, 32 },
 	{ "DrawableIconInfo", 32, 32 },
 	{ "TintEnvelope", 128, 32 },
 	{ "DynamicAudioEventRTS", 4000, 256 },
@@ -261,6 +261,7 @@ UpgradeCenter::~UpgradeCenter( void )
 		m_upgradeList = next;
 
 	}  // end while
+	m_upgradeIndex.clear();
 
 }  // end ~UpgradeCenter
 
@@ -277,14 +278,21 @@ void UpgradeCenter::init( void )
 //up = newUpgrade("");
 //up->friend_makeVeterancyUpgrade(LEVEL_REGULAR);
 
+	// (relink each one after renaming it, so it is indexed under its real name)
 	up = newUpgrade("");
+	unlinkUpgrade(up);
 	up->friend_makeVeterancyUpgrade(LEVEL_VETERAN);
+	linkUpgrade(up);
 
 	up = newUpgrade("");
+	unlinkUpgrade(up);
 	up->friend_makeVeterancyUpgrade(LEVEL_ELITE);
+	linkUpgrade(up);
 
 	up = newUpgrade("");
+	unlinkUpgrade(up);
 	up->friend_makeVeterancyUpgrade(LEVEL_HEROIC);
+	linkUpgrade(up);
 
 }
 
@@ -318,15 +326,8 @@ const UpgradeTemplate *UpgradeCenter::findVeterancyUpgrade( VeterancyLevel level
 //-------------------------------------------------------------------------------------------------
 UpgradeTemplate *UpgradeCenter::findNonConstUpgradeByKey( NameKeyType key )
 {
-	UpgradeTemplate *upgrade;
 
-	// search list
-	for( upgrade = m_upgradeList; upgrade; upgrade = upgrade->friend_getNext() )
-		if( upgrade->getUpgradeNameKey() == key )
-			return upgrade;
-
-	// item not found
-	return NULL;
+	return m_upgradeIndex.find( key );
 
 }
 
@@ -345,15 +346,9 @@ UpgradeTemplate *UpgradeCenter::firstUpgradeTemplate( void )
 //-------------------------------------------------------------------------------------------------
 const UpgradeTemplate *UpgradeCenter::findUpgradeByKey( NameKeyType key ) const
 {
-	const UpgradeTemplate *upgrade;
 
-	// search list
-	for( upgrade = m_upgradeList; upgrade; upgrade = upgrade->friend_getNext() )
-		if( upgrade->getUpgradeNameKey() == key )
-			return upgrade;
+	return m_upgradeIndex.find( key );
 
-	// item not found
-	return NULL;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -416,6 +411,9 @@ void UpgradeCenter::linkUpgrade( UpgradeTemplate *upgrade )
 		m_upgradeList->friend_setPrev( upgrade );
 	m_upgradeList = upgrade;
 
+	// we link at the head, so the newest upgrade is the one a lookup by key finds
+	m_upgradeIndex.add( upgrade->getUpgradeNameKey(), upgrade );
+
 }  // end linkUpgrade
 
 //-------------------------------------------------------------------------------------------------
@@ -435,6 +433,8 @@ void UpgradeCenter::unlinkUpgrade( UpgradeTemplate *upgrade )
 	else
 		m_upgradeList = upgrade->friend_getNext();
 
+	m_upgradeIndex.remove( upgrade->getUpgradeNameKey(), upgrade );
+
 }  // end unlinkUpgrade
 
 //-------------------------------------------------------------------------------------------------
@@ -0,0 +1,193 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// WorkerThreadPool.cpp ///////////////////////////////////////////////////////
+// A small fixed pool of worker threads that run batches of independent jobs.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file in the GameEngine
+
+#include <process.h>
+
+#include "Common/WorkerThreadPool.h"
+#include "GameLogic/FPUControl.h"
+
+static __declspec(thread) Int s_threadSlot = 0;
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+WorkerThreadPool::WorkerThreadPool( Int numThreads )
+{
+	if( numThreads < 0 )
+		numThreads = 0;
+	if( numThreads > MAX_WORKER_THREADS )
+		numThreads = MAX_WORKER_THREADS;
+
+	m_numThreads = 0;
+	m_quitting = FALSE;
+	m_proc = NULL;
+	m_userData = NULL;
+	m_numJobs = 0;
+	m_nextJob = 0;
+	m_workersBusy = 0;
+	m_doneEvent = CreateEvent( NULL, FALSE, FALSE, NULL );
+
+	for( Int i = 0; i < numThreads; ++i )
+	{
+		WorkerInfo &info = m_workers[ i ];
+		info.m_pool = this;
+		info.m_slot = i + 1;
+		info.m_startEvent = CreateEvent( NULL, FALSE, FALSE, NULL );
+
+		unsigned threadID;
+		info.m_thread = (void *)_beginthreadex( NULL, 0, threadProc, &info, 0, &threadID );
+		if( info.m_thread == NULL )
+		{
+			DEBUG_CRASH(( "WorkerThreadPool - could only start %d of %d threads", i, numThreads ));
+			CloseHandle( info.m_startEvent );
+			break;
+		}
+
+		++m_numThreads;
+	}
+
+	DEBUG_LOG(( "WorkerThreadPool - started %d worker threads\n", m_numThreads ));
+
+}  // end WorkerThreadPool
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+WorkerThreadPool::~WorkerThreadPool()
+{
+	Int i;
+
+	m_quitting = TRUE;
+	for( i = 0; i < m_numThreads; ++i )
+		SetEvent( m_workers[ i ].m_startEvent );
+
+	for( i = 0; i < m_numThreads; ++i )
+	{
+		WaitForSingleObject( m_workers[ i ].m_thread, INFINITE );
+		CloseHandle( m_workers[ i ].m_thread );
+		CloseHandle( m_workers[ i ].m_startEvent );
+	}
+
+	CloseHandle( m_doneEvent );
+
+}  // end ~WorkerThreadPool
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int WorkerThreadPool::getThreadSlot( void )
+{
+	return s_threadSlot;
+}
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::run( JobProc proc, void *userData, Int numJobs )
+{
+	if( numJobs <= 0 )
+		return;
+
+	DEBUG_ASSERTCRASH( s_threadSlot == 0, ("WorkerThreadPool::run - can't start a batch from a worker") );
+
+	// not worth waking anybody up for a single job
+	if( m_numThreads == 0 || numJobs == 1 )
+	{
+		for( Int i = 0; i < numJobs; ++i )
+			proc( userData, i );
+		return;
+	}
+
+	m_proc = proc;
+	m_userData = userData;
+	m_numJobs = numJobs;
+	m_nextJob = 0;
+	m_workersBusy = m_numThreads;
+
+	for( Int i = 0; i < m_numThreads; ++i )
+		SetEvent( m_workers[ i ].m_startEvent );
+
+	runJobs();
+
+	WaitForSingleObject( m_doneEvent, INFINITE );
+
+	m_proc = NULL;
+	m_userData = NULL;
+	m_numJobs = 0;
+
+}  // end run
+
+//-------------------------------------------------------------------------------------------------
+/** Take jobs from the current batch until there are none left */
+//-------------------------------------------------------------------------------------------------
+void WorkerThreadPool::runJobs( void )
+{
+	for( ;; )
+	{
+		Int job = InterlockedIncrement( (long *)&m_nextJob ) - 1;
+		if( job >= m_numJobs )
+			break;
+		m_proc( m_userData, job );
+	}
+
+}  // end runJobs
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+unsigned __stdcall WorkerThreadPool::threadProc( void *param )
+{
+	WorkerInfo *info = (WorkerInfo *)param;
+	WorkerThreadPool *pool = info->m_pool;
+
+	s_threadSlot = info->m_slot;
+
+	// keep our allocations off the memory pool lock as much as possible
+	initThreadMemoryCache();
+
+	for( ;; )
+	{
+		WaitForSingleObject( info->m_startEvent, INFINITE );
+		if( pool->m_quitting )
+			break;
+
+		// logic jobs must round exactly the way the main thread does
+		setFPMode();
+
+		pool->runJobs();
+
+		if( InterlockedDecrement( (long *)&pool->m_workersBusy ) == 0 )
+			SetEvent( pool->m_doneEvent );
+	}
+
+	shutdownThreadMemoryCache();
+
+	return 0;
+
+}  // end threadProc
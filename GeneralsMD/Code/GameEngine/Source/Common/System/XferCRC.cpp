@@ -56,6 +56,9 @@ XferCRC::XferCRC( void )
 	//Initialization(s) inserted
 	m_crc = 0;
 	//
+	m_captureBuffer = NULL;
+	m_captureMax = 0;
+	m_captureCount = 0;
 }  // end XferCRC
 
 //-------------------------------------------------------------------------------------------------
@@ -111,6 +114,13 @@ void XferCRC::addCRC( UnsignedInt val )
 
 	val = htonl(val);
 
+	if (m_captureBuffer)
+	{
+		if (m_captureCount < m_captureMax)
+			m_captureBuffer[m_captureCount] = val;
+		++m_captureCount;
+	}
+
 	if (m_crc & 0x80000000)
 	{
 		hibit = 1;
@@ -193,6 +203,55 @@ UnsignedInt XferCRC::getCRC( void )
 
 }  // end skip
 
+//-------------------------------------------------------------------------------------------------
+/** Start recording the words that go into the CRC.  Since each word is rotated into the running
+	* value, the CRC of a block can't be cached on its own; what can be cached is the word stream,
+	* and replaying it with addCapturedCRC() gives exactly the same result as xfering again. */
+//-------------------------------------------------------------------------------------------------
+void XferCRC::beginCapture( UnsignedInt *buffer, Int maxWords )
+{
+
+	DEBUG_ASSERTCRASH( m_captureBuffer == NULL, ("XferCRC::beginCapture - captures don't nest") );
+	m_captureBuffer = buffer;
+	m_captureMax = maxWords;
+	m_captureCount = 0;
+
+}  // end beginCapture
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+Int XferCRC::endCapture( void )
+{
+	Int count = m_captureCount;
+
+	if( count > m_captureMax )
+		count = -1;
+
+	m_captureBuffer = NULL;
+	m_captureMax = 0;
+	m_captureCount = 0;
+
+	return count;
+
+}  // end endCapture
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void XferCRC::addCapturedCRC( const UnsignedInt *words, Int count )
+{
+	UnsignedInt crc = m_crc;
+
+	// same as addCRC, the captured words are already in network byte order
+	for( Int i = 0; i < count; ++i )
+	{
+		UnsignedInt hibit = crc >> 31;
+		crc = (crc << 1) + words[ i ] + hibit;
+	}
+
+	m_crc = crc;
+
+}  // end addCapturedCRC
+
 
 //-------------------------------------------------------------------------------------------------
 //-------------------------------------------------------------------------------------------------
@@ -741,6 +741,12 @@ void GameClient::update( void )
 	}
 #endif
 
+	// headless runs only need the drawables kept in step with the logic; nothing is ever shown
+	if (TheGlobalData->m_headless)
+	{
+		return;
+	}
+
 	// update all particle systems
 	if( !freezeTime )
 	{
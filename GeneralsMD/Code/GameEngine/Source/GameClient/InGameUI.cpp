@@ -650,11 +650,9 @@ void InGameUI::objectChangedTeam(const Object *obj, Int oldPlayerIndex, Int newP
 	{
 		ObjectID id = obj->getID();
 		AsciiString powerName;
-		for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+		for (SpecialPowerModuleInterface** m = obj->getSpecialPowerModules(); *m; ++m)
 		{
-			SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-			if (!sp)
-				continue;
+			SpecialPowerModuleInterface* sp = *m;
 
 			const SpecialPowerTemplate *powerTemplate = sp->getSpecialPowerTemplate();
 			powerName = powerTemplate->getName();
@@ -226,14 +226,14 @@ void Particle::computeAlphaRate( void )
 {
 	if (m_alphaKey[ m_alphaTargetKey ].frame == 0)
 	{
-		m_alphaRate = 0.0f;
+		m_system->m_particleAlphaRate[ m_slot ] = 0.0f;
 		return;
 	}
 
 	Real delta = m_alphaKey[ m_alphaTargetKey ].value - m_alphaKey[ m_alphaTargetKey-1 ].value;
 	UnsignedInt time = m_alphaKey[ m_alphaTargetKey ].frame - m_alphaKey[ m_alphaTargetKey-1 ].frame;
 
-	m_alphaRate = delta/time;
+	m_system->m_particleAlphaRate[ m_slot ] = delta/time;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -266,11 +266,20 @@ void Particle::computeColorRate( void )
 Particle::Particle( ParticleSystem *system, const ParticleInfo *info )
 {
 	m_system = system;
+	m_slot = -1;
+	m_personality = 0;
+
+	m_inSystemList = m_inOverallList = FALSE;
+	m_systemPrev = m_systemNext = m_overallPrev = m_overallNext = NULL;
+
+	// add this particle to the global list, retaining particle creation order
+	TheParticleSystemManager->addParticle(this, system->getPriority() );
+
+	// add this particle to the Particle System list, retaining local creation order.  This also
+	// assigns our slot in the system's state arrays, which the setup below writes into
+	m_system->addParticle(this);
 
 	m_isCulled = FALSE;
-	m_accel.x = 0.0f;
-	m_accel.y = 0.0f;
-	m_accel.z = 0.0f;
 
 	m_vel = info->m_vel;
 	m_pos = info->m_pos;
@@ -294,7 +303,6 @@ Particle::Particle( ParticleSystem *system, const ParticleInfo *info )
 	m_lifetime = info->m_lifetime;
 	m_lifetimeLeft = info->m_lifetime;
 	m_createTimestamp = TheGameClient->getFrame();
-	m_personality = 0;
 
 	m_size = info->m_size;
 	m_sizeRate = info->m_sizeRate;
@@ -304,7 +312,7 @@ Particle::Particle( ParticleSystem *system, const ParticleInfo *info )
 	for( int i=0; i<MAX_KEYFRAMES; i++ )
 		m_alphaKey[i] = info->m_alphaKey[i];
 
-	m_alpha = m_alphaKey[0].value;
+	m_system->m_particleAlpha[ m_slot ] = m_alphaKey[0].value;
 	m_alphaTargetKey = 1;
 	computeAlphaRate();
 
@@ -318,14 +326,8 @@ Particle::Particle( ParticleSystem *system, const ParticleInfo *info )
 
 	m_colorScale = info->m_colorScale;
 
-	m_inSystemList = m_inOverallList = FALSE;
-	m_systemPrev = m_systemNext = m_overallPrev = m_overallNext = NULL;
-
-	// add this particle to the global list, retaining particle creation order
-	TheParticleSystemManager->addParticle(this, system->getPriority() );
-
-	// add this particle to the Particle System list, retaining local creation order
-	m_system->addParticle(this);
+	// seed the integrator state from the info we just copied
+	copyInfoToState();
 
 	//DEBUG_ASSERTLOG(!(totalParticleCount % 100 == 0), ( "TotalParticleCount = %d\n", m_totalParticleCount ));
 }
@@ -357,37 +359,47 @@ Particle::~Particle()
 // ------------------------------------------------------------------------------------------------
 void Particle::applyForce( const Coord3D *force )
 {
-	m_accel.x += force->x;
-	m_accel.y += force->y;
-	m_accel.z += force->z;
+	Coord3D *accel = &m_system->m_particleAccel[ m_slot ];
+	accel->x += force->x;
+	accel->y += force->y;
+	accel->z += force->z;
 }
 
 // ------------------------------------------------------------------------------------------------
-/** Update the behavior of an individual particle */
+/** Copy the integrator state held in our system's arrays into the ParticleInfo fields */
 // ------------------------------------------------------------------------------------------------
-Bool Particle::update( void )
+void Particle::copyStateToInfo( void )
 {
-	// integrate acceleration into velocity
-	m_vel.x += m_accel.x;
-	m_vel.y += m_accel.y;
-	m_vel.z += m_accel.z;
-
-	m_vel.x *= m_velDamping;
-	m_vel.y *= m_velDamping;
-	m_vel.z *= m_velDamping;
-
-	// integrate velocity into position
-	const Coord3D *driftVel = m_system->getDriftVelocity();
-	m_pos.x += m_vel.x + driftVel->x;
-	m_pos.y += m_vel.y + driftVel->y;
-	m_pos.z += m_vel.z + driftVel->z;
+	m_pos = m_system->m_particlePos[ m_slot ];
+	m_vel = m_system->m_particleVel[ m_slot ];
+	m_velDamping = m_system->m_particleVelDamping[ m_slot ];
+	m_size = m_system->m_particleSize[ m_slot ];
+	m_sizeRate = m_system->m_particleSizeRate[ m_slot ];
+	m_sizeRateDamping = m_system->m_particleSizeRateDamping[ m_slot ];
+	m_windRandomness = m_system->m_particleWindRandomness[ m_slot ];
+}
 
-	// integrate the wind (if specified) into position
-	ParticleSystemInfo::WindMotion windMotion = m_system->getWindMotion();
+// ------------------------------------------------------------------------------------------------
+/** Copy the ParticleInfo fields into the integrator state held in our system's arrays */
+// ------------------------------------------------------------------------------------------------
+void Particle::copyInfoToState( void )
+{
+	m_system->m_particlePos[ m_slot ] = m_pos;
+	m_system->m_particleVel[ m_slot ] = m_vel;
+	m_system->m_particleVelDamping[ m_slot ] = m_velDamping;
+	m_system->m_particleSize[ m_slot ] = m_size;
+	m_system->m_particleSizeRate[ m_slot ] = m_sizeRate;
+	m_system->m_particleSizeRateDamping[ m_slot ] = m_sizeRateDamping;
+	m_system->m_particleWindRandomness[ m_slot ] = m_windRandomness;
+}
 
-	// see if we should even do anything
-	if( windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED )
-		doWindMotion();
+// ------------------------------------------------------------------------------------------------
+/** Finish the update of an individual particle.  Motion, wind, size and the alpha ramp have
+	* already been integrated by ParticleSystem::integrateParticles() for the whole system; what
+	* remains here is the state that depends on keyframes or per particle branching. */
+// ------------------------------------------------------------------------------------------------
+Bool Particle::update( void )
+{
 
 	// update orientation
 	m_angleZ += m_angularRateZ;
@@ -396,42 +408,39 @@ Bool Particle::update( void )
 	if (m_particleUpTowardsEmitter) {
 		// adjust the up position back towards the particle
 		static const Coord2D upVec = { 0.0f, 1.0f };
+		const Coord3D *pos = getPosition();
 		Coord2D emitterDir;
-		emitterDir.x = m_pos.x - m_emitterPos.x;
-		emitterDir.y = m_pos.y - m_emitterPos.y;
+		emitterDir.x = pos->x - m_emitterPos.x;
+		emitterDir.y = pos->y - m_emitterPos.y;
 		m_angleZ = (angleBetween(&upVec, &emitterDir) + PI);
 
 
 	}
 
-	// update size
-	m_size += m_sizeRate;
-	m_sizeRate *= m_sizeRateDamping;
-
 	//
 	// Update alpha (if used)
 	//
 
 	if (m_system->getShaderType() != ParticleSystemInfo::ADDITIVE)
 	{
-		m_alpha += m_alphaRate;
+		Real &alpha = m_system->m_particleAlpha[ m_slot ];
 
 		if (m_alphaTargetKey < MAX_KEYFRAMES && m_alphaKey[ m_alphaTargetKey ].frame)
 		{
 			if (TheGameClient->getFrame() - m_createTimestamp >= m_alphaKey[ m_alphaTargetKey ].frame)
 			{
-				m_alpha = m_alphaKey[ m_alphaTargetKey ].value;
+				alpha = m_alphaKey[ m_alphaTargetKey ].value;
 				m_alphaTargetKey++;
 				computeAlphaRate();
 			}
 		}
 		else
-			m_alphaRate = 0.0f;
+			m_system->m_particleAlphaRate[ m_slot ] = 0.0f;
 
-		if (m_alpha < 0.0f)
-			m_alpha = 0.0f;
-		else if (m_alpha > 1.0f)
-			m_alpha = 1.0f;
+		if (alpha < 0.0f)
+			alpha = 0.0f;
+		else if (alpha > 1.0f)
+			alpha = 1.0f;
 	}
 
 
@@ -480,9 +489,6 @@ Bool Particle::update( void )
 		m_color.blue = 1.0f;
 
 
-	// reset the acceleration for accumulation next frame
-	m_accel.z=m_accel.y=m_accel.x= 0.0f;
-
 	// monitor lifetime
 	if (m_lifetimeLeft && --m_lifetimeLeft == 0)
 		return false;
@@ -495,88 +501,6 @@ Bool Particle::update( void )
 	return true;
 }
 
-// ------------------------------------------------------------------------------------------------
-/** Do wind motion as specified by the particle system template, if present */
-// ------------------------------------------------------------------------------------------------
-void Particle::doWindMotion( void )
-{
-
-	// get the angle of the wind
-	Real windAngle = m_system->getWindAngle();
-
-	// get the system position
-	Coord3D systemPos;
-	m_system->getPosition( &systemPos );
-
-	// when we're attached objects and drawables we offset by that position as well
-	if( ObjectID attachedObj = m_system->getAttachedObject() )
-	{
-		Object *obj = TheGameLogic->findObjectByID( attachedObj );
-
-		if( obj )
-		{
-			const Coord3D *objPos = obj->getPosition();
-
-			systemPos.x += objPos->x;
-			systemPos.y += objPos->y;
-			systemPos.z += objPos->z;
-
-		}  // end if
-
-	}  // end if
-	else if( DrawableID attachedDraw = m_system->getAttachedDrawable() )
-	{
-		Drawable *draw = TheGameClient->findDrawableByID( attachedDraw );
-
-		if( draw )
-		{
-			const Coord3D *drawPos = draw->getPosition();
-
-			systemPos.x += drawPos->x;
-			systemPos.y += drawPos->y;
-			systemPos.z += drawPos->z;
-
-		}  // end if
-
-	}  // end else if
-
-	//
-	// compute a vector from the system position in the world to the particle ... we will use
-	// this to compute how much force we apply
-	//
-	Coord3D v;
-	v.x = m_pos.x - systemPos.x;
-	v.y = m_pos.y - systemPos.y;
-	v.z = m_pos.z - systemPos.z;
-
-	// distance amounts for full force from wind and no force at all
-	Real fullForceDistance = 75.0f;
-	Real noForceDistance = 200.0f;
-
-	//
-	// given the distance from the wind position to the particle ... figure out how much
-	// force we're going to apply to it.  When it's further away (outside of the full force
-	// distance) we will apply only a fraction of the force
-	//
-
-	Real distFromWind = v.length();
-	if( distFromWind < noForceDistance )
-	{
-		Real windForceStrength = 2.0f * m_windRandomness;
-
-		// only apply force if still within the circle of influence
-		if( distFromWind > fullForceDistance )
-			windForceStrength *= (1.0f - ((distFromWind - fullForceDistance) / 
-																		(noForceDistance - fullForceDistance)));
-
-		// integate the wind motion into the position
-		m_pos.x += (Cos( windAngle ) * windForceStrength);
-		m_pos.y += (Sin( windAngle ) * windForceStrength);
-
-	}  // end if
-
-}  // doWindMotion
-
 // ------------------------------------------------------------------------------------------------
 /** Get priority of a particle ... which is the priority of it's attached system */
 // ------------------------------------------------------------------------------------------------
@@ -605,7 +529,7 @@ Bool Particle::isInvisible( void )
 
 		case ParticleSystemInfo::ALPHA:
 			// if alpha is zero, this particle is invisible
-			if (m_alpha < 0.02f)
+			if (getAlpha() < 0.02f)
 				return true;
 			return false;
 
@@ -650,6 +574,10 @@ void Particle::xfer( Xfer *xfer )
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
+	// the base class fields the integrator works on are kept in the system arrays, stage them
+	if( xfer->getXferMode() != XFER_LOAD )
+		copyStateToInfo();
+
 	// base class particle info
 	ParticleInfo::xfer( xfer );
 
@@ -657,7 +585,8 @@ void Particle::xfer( Xfer *xfer )
 	xfer->xferUnsignedInt( &m_personality );
 
 	// acceleration
-	xfer->xferCoord3D( &m_accel );
+	Coord3D accel = m_system->m_particleAccel[ m_slot ];
+	xfer->xferCoord3D( &accel );
 
 	// last position
 	xfer->xferCoord3D( &m_lastPos );
@@ -669,10 +598,12 @@ void Particle::xfer( Xfer *xfer )
 	xfer->xferUnsignedInt( &m_createTimestamp );
 
 	// alpha
-	xfer->xferReal( &m_alpha );
+	Real alpha = m_system->m_particleAlpha[ m_slot ];
+	xfer->xferReal( &alpha );
 
 	// alpha rate
-	xfer->xferReal( &m_alphaRate );
+	Real alphaRate = m_system->m_particleAlphaRate[ m_slot ];
+	xfer->xferReal( &alphaRate );
 
 	// alpha target key
 	xfer->xferInt( &m_alphaTargetKey );
@@ -694,6 +625,17 @@ void Particle::xfer( Xfer *xfer )
 	ParticleSystemID systemUnderControlID = m_systemUnderControl ? m_systemUnderControl->getSystemID() : INVALID_PARTICLE_SYSTEM_ID;
 	xfer->xferUser( &systemUnderControlID, sizeof( ParticleSystemID ) );
 
+	// put the loaded integrator state back into the system arrays
+	if( xfer->getXferMode() == XFER_LOAD )
+	{
+
+		copyInfoToState();
+		m_system->m_particleAccel[ m_slot ] = accel;
+		m_system->m_particleAlpha[ m_slot ] = alpha;
+		m_system->m_particleAlphaRate[ m_slot ] = alphaRate;
+
+	}  // end if
+
 }  // end xfer
 
 // ------------------------------------------------------------------------------------------------
@@ -2059,23 +2001,16 @@ Bool ParticleSystem::update( Int localPlayerIndex  )
 	} // end if is destroyed
 
 	//
-	// Update all particles in the system
+	// Update all particles in the system.  The arrays are integrated a stage at a time first,
+	// then each particle finishes its keyframed state and decides if it is dead
 	//
+	integrateParticles();
+
 	Particle *p = m_systemParticlesHead;
 	Particle *oldParticle;
 	while (p)
 	{
 
-		// apply 'gravity' force
-		if (m_gravity != 0.0f)
-		{
-			Coord3D force;
-			force.x = 0.0f;
-			force.y = 0.0f;
-			force.z = m_gravity;
-			p->applyForce( &force );
-		}
-
 		if (p->update() == false)
 		{
 			oldParticle = p;
@@ -2248,6 +2183,171 @@ void ParticleSystem::updateWindMotion( void )
 
 }  // end updateWindMotion
 
+// ------------------------------------------------------------------------------------------------
+/** Integrate the per frame state of every particle in the system.  Each stage is a separate
+	* pass over the state arrays with no calls or per particle branches inside, so the compiler
+	* can keep everything in registers and the memory is walked front to back.  The stages keep
+	* the same order of operations the per particle update always used. */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::integrateParticles( void )
+{
+	Int count = m_particleSlots.size();
+	if( count == 0 )
+		return;
+
+	Coord3D *pos = &m_particlePos[ 0 ];
+	Coord3D *vel = &m_particleVel[ 0 ];
+	Coord3D *accel = &m_particleAccel[ 0 ];
+	const Real *velDamping = &m_particleVelDamping[ 0 ];
+	Int i;
+
+	// apply 'gravity' force
+	if( m_gravity != 0.0f )
+	{
+		for( i = 0; i < count; ++i )
+			accel[ i ].z += m_gravity;
+	}  // end if
+
+	// integrate acceleration into velocity, and velocity into position
+	const Coord3D *driftVel = getDriftVelocity();
+	Real driftX = driftVel->x;
+	Real driftY = driftVel->y;
+	Real driftZ = driftVel->z;
+	for( i = 0; i < count; ++i )
+	{
+		Real damping = velDamping[ i ];
+
+		vel[ i ].x = (vel[ i ].x + accel[ i ].x) * damping;
+		vel[ i ].y = (vel[ i ].y + accel[ i ].y) * damping;
+		vel[ i ].z = (vel[ i ].z + accel[ i ].z) * damping;
+
+		pos[ i ].x += vel[ i ].x + driftX;
+		pos[ i ].y += vel[ i ].y + driftY;
+		pos[ i ].z += vel[ i ].z + driftZ;
+
+		// reset the acceleration for accumulation next frame
+		accel[ i ].x = 0.0f;
+		accel[ i ].y = 0.0f;
+		accel[ i ].z = 0.0f;
+	}  // end for i
+
+	// integrate the wind (if specified) into position
+	if( m_windMotion != ParticleSystemInfo::WIND_MOTION_NOT_USED )
+		doWindMotion();
+
+	// update size
+	Real *size = &m_particleSize[ 0 ];
+	Real *sizeRate = &m_particleSizeRate[ 0 ];
+	const Real *sizeRateDamping = &m_particleSizeRateDamping[ 0 ];
+	for( i = 0; i < count; ++i )
+	{
+		size[ i ] += sizeRate[ i ];
+		sizeRate[ i ] *= sizeRateDamping[ i ];
+	}  // end for i
+
+	// ramp alpha towards the next key, the keys themselves are handled in Particle::update()
+	if( m_shaderType != ParticleSystemInfo::ADDITIVE )
+	{
+		Real *alpha = &m_particleAlpha[ 0 ];
+		const Real *alphaRate = &m_particleAlphaRate[ 0 ];
+		for( i = 0; i < count; ++i )
+			alpha[ i ] += alphaRate[ i ];
+	}  // end if
+
+}  // end integrateParticles
+
+// ------------------------------------------------------------------------------------------------
+/** Do wind motion as specified by the particle system template, if present */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystem::doWindMotion( void )
+{
+	Int count = m_particleSlots.size();
+	if( count == 0 )
+		return;
+
+	// get the system position
+	Coord3D systemPos;
+	getPosition( &systemPos );
+
+	// when we're attached objects and drawables we offset by that position as well
+	if( m_attachedToObjectID != INVALID_ID )
+	{
+		Object *obj = TheGameLogic->findObjectByID( m_attachedToObjectID );
+
+		if( obj )
+		{
+			const Coord3D *objPos = obj->getPosition();
+
+			systemPos.x += objPos->x;
+			systemPos.y += objPos->y;
+			systemPos.z += objPos->z;
+
+		}  // end if
+
+	}  // end if
+	else if( m_attachedToDrawableID != INVALID_DRAWABLE_ID )
+	{
+		Drawable *draw = TheGameClient->findDrawableByID( m_attachedToDrawableID );
+
+		if( draw )
+		{
+			const Coord3D *drawPos = draw->getPosition();
+
+			systemPos.x += drawPos->x;
+			systemPos.y += drawPos->y;
+			systemPos.z += drawPos->z;
+
+		}  // end if
+
+	}  // end else if
+
+	// the wind blows the same way for every particle this frame
+	Real windX = Cos( m_windAngle );
+	Real windY = Sin( m_windAngle );
+
+	// distance amounts for full force from wind and no force at all
+	const Real fullForceDistance = 75.0f;
+	const Real noForceDistance = 200.0f;
+
+	Coord3D *pos = &m_particlePos[ 0 ];
+	const Real *windRandomness = &m_particleWindRandomness[ 0 ];
+	for( Int i = 0; i < count; ++i )
+	{
+
+		//
+		// compute a vector from the system position in the world to the particle ... we will use
+		// this to compute how much force we apply
+		//
+		Coord3D v;
+		v.x = pos[ i ].x - systemPos.x;
+		v.y = pos[ i ].y - systemPos.y;
+		v.z = pos[ i ].z - systemPos.z;
+
+		//
+		// given the distance from the wind position to the particle ... figure out how much
+		// force we're going to apply to it.  When it's further away (outside of the full force
+		// distance) we will apply only a fraction of the force
+		//
+		Real distFromWind = v.length();
+		if( distFromWind < noForceDistance )
+		{
+			Real windForceStrength = 2.0f * windRandomness[ i ];
+
+			// only apply force if still within the circle of influence
+			if( distFromWind > fullForceDistance )
+				windForceStrength *= (1.0f - ((distFromWind - fullForceDistance) / 
+																			(noForceDistance - fullForceDistance)));
+
+			// integate the wind motion into the position
+			pos[ i ].x += (windX * windForceStrength);
+			pos[ i ].y += (windY * windForceStrength);
+
+		}  // end if
+
+	}  // end for i
+
+}  // end doWindMotion
+
 // ------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------
 void ParticleSystem::addParticle( Particle *particleToAdd )
@@ -2276,6 +2376,21 @@ void ParticleSystem::addParticle( Particle *particleToAdd )
 
 	++m_particleCount;
 
+	// give the particle the slot at the end of the state arrays, the particle fills it in
+	static const Coord3D zero = { 0.0f, 0.0f, 0.0f };
+	particleToAdd->m_slot = m_particleSlots.size();
+	m_particleSlots.push_back( particleToAdd );
+	m_particlePos.push_back( zero );
+	m_particleVel.push_back( zero );
+	m_particleAccel.push_back( zero );
+	m_particleVelDamping.push_back( 0.0f );
+	m_particleSize.push_back( 0.0f );
+	m_particleSizeRate.push_back( 0.0f );
+	m_particleSizeRateDamping.push_back( 0.0f );
+	m_particleAlpha.push_back( 0.0f );
+	m_particleAlphaRate.push_back( 0.0f );
+	m_particleWindRandomness.push_back( 0.0f );
+
 	particleToAdd->setPersonality( m_personalityStore++ ); 
 
 }
@@ -2303,6 +2418,43 @@ void ParticleSystem::removeParticle( Particle *particleToRemove )
 	particleToRemove->m_systemNext = particleToRemove->m_systemPrev = NULL;
 	particleToRemove->m_inSystemList = FALSE;
 	--m_particleCount;
+
+	// move the last slot into the hole so the state arrays stay packed
+	Int slot = particleToRemove->m_slot;
+	Int last = m_particleSlots.size() - 1;
+	DEBUG_ASSERTCRASH( slot >= 0 && slot <= last && m_particleSlots[ slot ] == particleToRemove,
+										 ("ParticleSystem::removeParticle - particle slot %d is out of sync\n", slot) );
+	if( slot != last )
+	{
+		Particle *moved = m_particleSlots[ last ];
+
+		m_particleSlots[ slot ] = moved;
+		m_particlePos[ slot ] = m_particlePos[ last ];
+		m_particleVel[ slot ] = m_particleVel[ last ];
+		m_particleAccel[ slot ] = m_particleAccel[ last ];
+		m_particleVelDamping[ slot ] = m_particleVelDamping[ last ];
+		m_particleSize[ slot ] = m_particleSize[ last ];
+		m_particleSizeRate[ slot ] = m_particleSizeRate[ last ];
+		m_particleSizeRateDamping[ slot ] = m_particleSizeRateDamping[ last ];
+		m_particleAlpha[ slot ] = m_particleAlpha[ last ];
+		m_particleAlphaRate[ slot ] = m_particleAlphaRate[ last ];
+		m_particleWindRandomness[ slot ] = m_particleWindRandomness[ last ];
+		moved->m_slot = slot;
+
+	}  // end if
+
+	m_particleSlots.pop_back();
+	m_particlePos.pop_back();
+	m_particleVel.pop_back();
+	m_particleAccel.pop_back();
+	m_particleVelDamping.pop_back();
+	m_particleSize.pop_back();
+	m_particleSizeRate.pop_back();
+	m_particleSizeRateDamping.pop_back();
+	m_particleAlpha.pop_back();
+	m_particleAlphaRate.pop_back();
+	m_particleWindRandomness.pop_back();
+	particleToRemove->m_slot = -1;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -2924,6 +3076,7 @@ void ParticleSystemManager::reset( void )
 	m_particleCount = 0;
 	m_fieldParticleCount = 0;
 	m_particleSystemCount = 0;
+	m_systemIDMap.clear();
 
 	m_uniqueSystemID = INVALID_PARTICLE_SYSTEM_ID;
 	
@@ -3008,23 +3161,40 @@ ParticleSystem *ParticleSystemManager::findParticleSystem( ParticleSystemID id )
 	if (id == INVALID_PARTICLE_SYSTEM_ID)
 		return NULL;	// my, that was easy
 
-	ParticleSystem *system = NULL;
-
-	for( ParticleSystemListIt it = m_allParticleSystemList.begin(); it != m_allParticleSystemList.end(); ++it ) {
-		system = *it;
-		if (!system) {
-			continue;
-		}
-
-		if( system->getSystemID() == id ) {
-			return system;
-		}
-	}
+	ParticleSystemIDMap::const_iterator it = m_systemIDMap.find( id );
+	if( it != m_systemIDMap.end() )
+		return (*it).second;
 
 	return NULL;
 
 }  // end findParticleSystem
 
+// ------------------------------------------------------------------------------------------------
+/** Rebuild the ID index from scratch.  Systems read from a save game are created with a fresh
+	* ID and only get their saved one back in ParticleSystem::xfer, so the index must be re-keyed
+	* once they have all been loaded */
+// ------------------------------------------------------------------------------------------------
+void ParticleSystemManager::rebuildSystemIDMap( void )
+{
+
+	m_systemIDMap.clear();
+	for( ParticleSystemListIt it = m_allParticleSystemList.begin(); it != m_allParticleSystemList.end(); ++it )
+	{
+		ParticleSystem *system = *it;
+
+		if( system )
+		{
+
+			DEBUG_ASSERTCRASH( m_systemIDMap.find( system->getSystemID() ) == m_systemIDMap.end(),
+												 ("ParticleSystemManager::rebuildSystemIDMap - duplicate system ID %d\n", system->getSystemID()) );
+			m_systemIDMap[ system->getSystemID() ] = system;
+
+		}  // end if
+
+	}  // end for, it
+
+}  // end rebuildSystemIDMap
+
 // ------------------------------------------------------------------------------------------------
 /** destroy the particle system with the given id (if it still exists) */
 // ------------------------------------------------------------------------------------------------
@@ -3188,6 +3358,7 @@ void ParticleSystemManager::removeParticle( Particle *particleToRemove)
 void ParticleSystemManager::friend_addParticleSystem( ParticleSystem *particleSystemToAdd )
 {
 	m_allParticleSystemList.push_back(particleSystemToAdd);
+	m_systemIDMap[ particleSystemToAdd->getSystemID() ] = particleSystemToAdd;
 	++m_particleSystemCount;
 }
 
@@ -3200,6 +3371,11 @@ void ParticleSystemManager::friend_removeParticleSystem( ParticleSystem *particl
 	if (it != m_allParticleSystemList.end()) {
 		m_allParticleSystemList.erase(it);
 		--m_particleSystemCount;
+
+		// only drop the index entry if it is really ours, mid-load it may be keyed to another system
+		ParticleSystemIDMap::iterator mapIt = m_systemIDMap.find( particleSystemToRemove->getSystemID() );
+		if( mapIt != m_systemIDMap.end() && (*mapIt).second == particleSystemToRemove )
+			m_systemIDMap.erase( mapIt );
 	}
 
 }
@@ -3352,6 +3528,12 @@ void ParticleSystemManager::xfer( Xfer *xfer )
 
 		}  // end for, i
 
+		//
+		// the systems now carry their saved IDs, re-key the index before anything resolves them ...
+		// the loadPostProcess of the systems and particles runs before ours and already uses it
+		//
+		rebuildSystemIDMap();
+
 	}  // end else, load
 
 }  // end particleSystemManager
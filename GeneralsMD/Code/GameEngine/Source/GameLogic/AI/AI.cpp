@@ -537,6 +537,11 @@ class PartitionFilterLiveMapEnemies : public PartitionFilter
 		return true;
 	}
 
+	virtual void addToPrefilter(PartitionQueryPrefilter& prefilter) const
+	{
+		prefilter.addRelationship(m_obj, 1<<ENEMIES);
+	}
+
 #if defined(_DEBUG) || defined(_INTERNAL)
 	virtual const char* debugGetName() { return "PartitionFilterLiveMapEnemies"; }
 #endif
@@ -1114,6 +1114,9 @@ enum { PATHFIND_CELLS_PER_FRAME=5000}; // Number of cells we will search pathfin
 enum {CELL_INFOS_TO_ALLOCATE = 30000};
 PathfindCellInfo *PathfindCellInfo::s_infoArray = NULL;
 PathfindCellInfo *PathfindCellInfo::s_firstFree = NULL;						
+PathfindCellInfo **PathfindCellInfo::s_openHeap = NULL;
+Int PathfindCellInfo::s_openHeapCount = 0;
+UnsignedInt PathfindCellInfo::s_openSequence = 0;
 /**
  * Allocates a pool of pathfind cell infos.
  */
@@ -1121,6 +1124,10 @@ void PathfindCellInfo::allocateCellInfos(void)
 {
 	releaseCellInfos();
 	s_infoArray = MSGNEW("PathfindCellInfo") PathfindCellInfo[CELL_INFOS_TO_ALLOCATE];	// pool[]ify
+	// Every cell on the open heap holds an info, so the heap can never outgrow the info pool.
+	s_openHeap = MSGNEW("PathfindCellInfo") PathfindCellInfo*[CELL_INFOS_TO_ALLOCATE];
+	s_openHeapCount = 0;
+	s_openSequence = 0;
 	s_infoArray[CELL_INFOS_TO_ALLOCATE-1].m_pathParent = NULL;
 	s_infoArray[CELL_INFOS_TO_ALLOCATE-1].m_isFree = true;
 	s_firstFree = s_infoArray;
@@ -1148,6 +1155,66 @@ void PathfindCellInfo::releaseCellInfos(void)
 	delete s_infoArray;
 	s_infoArray = NULL;
 	s_firstFree = NULL;
+	delete [] s_openHeap;
+	s_openHeap = NULL;
+	s_openHeapCount = 0;
+}
+
+/**
+ * Open heap ordering.  Cells are ordered by total cost, and cells of equal cost
+ * in the order they were put on the open list.  This pops cells in exactly the
+ * order the old sorted open list did, so paths (and CRCs) are unchanged.
+ */
+inline Bool PathfindCellInfo::openHeapLess(const PathfindCellInfo *a, const PathfindCellInfo *b)
+{
+	if (a->m_totalCost != b->m_totalCost) {
+		return a->m_totalCost < b->m_totalCost;
+	}
+	return a->m_openSequence < b->m_openSequence;
+}
+
+/**
+ * Moves the heap entry at ndx towards the root until the heap is ordered.
+ */
+void PathfindCellInfo::openHeapSiftUp(Int ndx)
+{
+	PathfindCellInfo *info = s_openHeap[ndx];
+	while (ndx > 0) {
+		Int parent = (ndx-1)>>1;
+		if (!openHeapLess(info, s_openHeap[parent])) {
+			break;
+		}
+		s_openHeap[ndx] = s_openHeap[parent];
+		s_openHeap[ndx]->m_heapIndex = ndx;
+		ndx = parent;
+	}
+	s_openHeap[ndx] = info;
+	info->m_heapIndex = ndx;
+}
+
+/**
+ * Moves the heap entry at ndx towards the leaves until the heap is ordered.
+ */
+void PathfindCellInfo::openHeapSiftDown(Int ndx)
+{
+	PathfindCellInfo *info = s_openHeap[ndx];
+	for (;;) {
+		Int child = 2*ndx+1;
+		if (child >= s_openHeapCount) {
+			break;
+		}
+		if (child+1 < s_openHeapCount && openHeapLess(s_openHeap[child+1], s_openHeap[child])) {
+			child++;
+		}
+		if (!openHeapLess(s_openHeap[child], info)) {
+			break;
+		}
+		s_openHeap[ndx] = s_openHeap[child];
+		s_openHeap[ndx]->m_heapIndex = ndx;
+		ndx = child;
+	}
+	s_openHeap[ndx] = info;
+	info->m_heapIndex = ndx;
 }
 
 /**
@@ -1165,6 +1232,8 @@ PathfindCellInfo *PathfindCellInfo::getACellInfo(PathfindCell *cell,const ICoord
 
 		info->m_nextOpen = NULL;
 		info->m_prevOpen = NULL;
+		info->m_heapIndex = -1;
+		info->m_openSequence = 0;
 		info->m_pathParent = NULL;
 		info->m_costSoFar = 0;		
 		info->m_totalCost = 0;
@@ -1252,8 +1321,12 @@ Bool PathfindCell::startPathfind( PathfindCell *goalCell  )
 	if (goalCell) {
 		m_info->m_totalCost = costToGoal( goalCell );
 	}
-	m_info->m_open = TRUE;
+	// The start cell is the only cell on a new search's open heap.
+	PathfindCellInfo::s_openHeapCount = 0;
+	PathfindCellInfo::s_openSequence = 0;
+	m_info->m_open = FALSE;
 	m_info->m_closed = FALSE;
+	putOnSortedOpenList(NULL);
 	return true;
 }
 /**
@@ -1319,6 +1392,7 @@ void PathfindCell::releaseInfo( void )
 	if (m_info) {
 		DEBUG_ASSERTCRASH(m_info->m_prevOpen==NULL && m_info->m_nextOpen==NULL, ("Shouldn't be linked."));
 		DEBUG_ASSERTCRASH(m_info->m_open==NULL && m_info->m_closed==NULL, ("Shouldn't be linked."));
+		DEBUG_ASSERTCRASH(m_info->m_heapIndex==-1, ("Shouldn't be on open heap."));
 		DEBUG_ASSERTCRASH(m_info->m_goalUnitID==INVALID_ID && m_info->m_posUnitID==INVALID_ID, ("Shouldn't be occupied."));
 		DEBUG_ASSERTCRASH(m_info->m_goalAircraftID==INVALID_ID , ("Shouldn't be occupied by aircraft."));
 		if (m_info->m_prevOpen || m_info->m_nextOpen || m_info->m_open || m_info->m_closed) {
@@ -1517,97 +1591,80 @@ Bool PathfindCell::removeObstacle( Object *obstacle )
 	return true;
 }
 
-/// put self on "open" list in ascending cost order, return new list
+/// put self on "open" heap, return the lowest cost cell on the heap
 PathfindCell *PathfindCell::putOnSortedOpenList( PathfindCell *list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==FALSE, ("Serious error - Invalid flags. jba"));
-	if (list == NULL)
-	{
-		list = this;
-		m_info->m_prevOpen = NULL;
-		m_info->m_nextOpen = NULL;
-	}
-	else
-	{
-		// insertion sort
-		PathfindCell *c, *lastCell = NULL;
-		for( c = list; c; c = c->getNextOpen() )
-		{
-			if (c->m_info->m_totalCost > m_info->m_totalCost)
-				break;
-
-			lastCell = c;
-		}
+	DEBUG_ASSERTCRASH(list==NULL || list==getOpenListCell(0), ("Open list out of sync with open heap."));
+	DEBUG_ASSERTCRASH(PathfindCellInfo::s_openHeapCount < CELL_INFOS_TO_ALLOCATE, ("Open heap overflow."));
 
-		if (c)
-		{
-			// insert just before "c"
-			if (c->m_info->m_prevOpen)
-				c->m_info->m_prevOpen->m_nextOpen = this->m_info;
-			else
-				list = this;
-
-			m_info->m_prevOpen = c->m_info->m_prevOpen;
-			c->m_info->m_prevOpen = this->m_info;
-				
-			m_info->m_nextOpen = c->m_info;
-
-		}
-		else
-		{
-			// append after "lastCell" - end of list
-			lastCell->m_info->m_nextOpen = this->m_info;
-			m_info->m_prevOpen = lastCell->m_info;
-			m_info->m_nextOpen = NULL;
-		}
-	}
+	m_info->m_openSequence = PathfindCellInfo::s_openSequence++;
+	Int ndx = PathfindCellInfo::s_openHeapCount++;
+	PathfindCellInfo::s_openHeap[ndx] = m_info;
+	PathfindCellInfo::openHeapSiftUp(ndx);
 
 	// mark newCell as being on open list
 	m_info->m_open = true;
 	m_info->m_closed = false;
 
-	return list;
+	return PathfindCellInfo::s_openHeap[0]->m_cell;
 }
 
-/// remove self from "open" list
+/// remove self from "open" heap, return the lowest cost cell on the heap
 PathfindCell *PathfindCell::removeFromOpenList( PathfindCell *list )
 {
 	DEBUG_ASSERTCRASH(m_info, ("Has to have info."));
 	DEBUG_ASSERTCRASH(m_info->m_closed==FALSE && m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
-	if (m_info->m_nextOpen)
-		m_info->m_nextOpen->m_prevOpen = m_info->m_prevOpen;
-	
-	if (m_info->m_prevOpen)
-		m_info->m_prevOpen->m_nextOpen = m_info->m_nextOpen;
-	else
-		list = getNextOpen();
+	DEBUG_ASSERTCRASH(list==getOpenListCell(0), ("Open list out of sync with open heap."));
+	Int ndx = m_info->m_heapIndex;
+	DEBUG_ASSERTCRASH(ndx>=0 && ndx<PathfindCellInfo::s_openHeapCount && PathfindCellInfo::s_openHeap[ndx]==m_info, ("Bad open heap index."));
+
+	Int last = --PathfindCellInfo::s_openHeapCount;
+	if (ndx != last) {
+		// Move the last entry into the hole, and restore heap order around it.
+		PathfindCellInfo *moved = PathfindCellInfo::s_openHeap[last];
+		PathfindCellInfo::s_openHeap[ndx] = moved;
+		moved->m_heapIndex = ndx;
+		PathfindCellInfo::openHeapSiftUp(ndx);
+		if (moved->m_heapIndex == ndx) {
+			PathfindCellInfo::openHeapSiftDown(ndx);
+		}
+	}
 
 	m_info->m_open = false;
-	m_info->m_nextOpen = NULL;
-	m_info->m_prevOpen = NULL;
+	m_info->m_heapIndex = -1;
 
-	return list;
+	return getOpenListCell(0);
+}
+
+/// Number of cells on the "open" heap.
+Int PathfindCell::getOpenListCount( void )
+{
+	return PathfindCellInfo::s_openHeapCount;
 }
 
-/// remove all cells from "open" list
+/// Cell at ndx in the "open" heap, 0 is the lowest cost cell.
+PathfindCell *PathfindCell::getOpenListCell( Int ndx )
+{
+	if (ndx<0 || ndx>=PathfindCellInfo::s_openHeapCount) {
+		return NULL;
+	}
+	return PathfindCellInfo::s_openHeap[ndx]->m_cell;
+}
+
+/// remove all cells from "open" heap
 Int PathfindCell::releaseOpenList( PathfindCell *list )
 {
-	Int count = 0;
-	while (list) {
-		count++;
-		DEBUG_ASSERTCRASH(list->m_info, ("Has to have info."));
-		DEBUG_ASSERTCRASH(list->m_info->m_closed==FALSE && list->m_info->m_open==TRUE, ("Serious error - Invalid flags. jba"));
-		PathfindCell *cur = list;
-		PathfindCellInfo *curInfo = list->m_info;
-		if (curInfo->m_nextOpen) {
-			list = curInfo->m_nextOpen->m_cell;
-		}	else {
-			list = NULL;
-		}
-		DEBUG_ASSERTCRASH(cur == curInfo->m_cell, ("Bad backpointer in PathfindCellInfo"));
-		curInfo->m_nextOpen = NULL;
-		curInfo->m_prevOpen = NULL;
+	DEBUG_ASSERTCRASH(list==getOpenListCell(0), ("Open list out of sync with open heap."));
+	Int count = PathfindCellInfo::s_openHeapCount;
+	PathfindCellInfo::s_openHeapCount = 0;
+	for (Int i=0; i<count; i++) {
+		PathfindCellInfo *curInfo = PathfindCellInfo::s_openHeap[i];
+		PathfindCell *cur = curInfo->m_cell;
+		DEBUG_ASSERTCRASH(cur->m_info == curInfo, ("Bad backpointer in PathfindCellInfo"));
+		DEBUG_ASSERTCRASH(curInfo->m_closed==FALSE && curInfo->m_open==TRUE, ("Serious error - Invalid flags. jba"));
+		curInfo->m_heapIndex = -1;
 		curInfo->m_open = FALSE;
 		cur->releaseInfo();
 	}
@@ -2173,7 +2230,11 @@ m_crusherZones(NULL),
 m_hierarchicalZones(NULL), 
 m_blockOfZoneBlocks(NULL),
 m_zoneBlocks(NULL),
-m_zonesAllocated(0)
+m_zonesAllocated(0),
+m_corridorBits(NULL),
+m_corridorBytes(0),
+m_numCorridors(0),
+m_nextCorridor(0)
 {		
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
@@ -2185,6 +2246,104 @@ PathfindZoneManager::~PathfindZoneManager()
 	freeBlocks();
 }
 
+void PathfindZoneManager::freeCorridors() 
+{
+	if (m_corridorBits) {
+		delete [] m_corridorBits;
+		m_corridorBits = NULL;
+	}
+	m_corridorBytes = 0;
+	invalidateCorridors();
+}
+
+/* Allocate the corridor cache for the current zone block extent. */
+void PathfindZoneManager::allocateCorridors(void) 
+{
+	freeCorridors();
+	Int numBlocks = m_zoneBlockExtent.x*m_zoneBlockExtent.y;
+	if (numBlocks <= 0) {
+		return;
+	}
+	m_corridorBytes = (numBlocks+7)/8;
+	m_corridorBits = MSGNEW("PathfindZoneBlocks") UnsignedByte[CORRIDOR_CACHE_SIZE*m_corridorBytes];
+}
+
+/**
+ * Discards all cached corridors.  Block zone numbers are reassigned when zones are
+ * recalculated, so any zone change makes the cached keys meaningless.
+ */
+void PathfindZoneManager::invalidateCorridors(void) 
+{
+	m_numCorridors = 0;
+	m_nextCorridor = 0;
+}
+
+/**
+ * If a search was cached for this key, return whether it found a path and how many cells it
+ * examined, set the passable flags of all blocks to its corridor and return true.  Otherwise 
+ * leave the passable flags alone.
+ */
+Bool PathfindZoneManager::applyCachedCorridor(const HierarchicalCorridorKey &key, Bool &found, Int &cellCount) 
+{
+	Int i;
+	for (i=0; i<m_numCorridors; i++) {
+		const HierarchicalCorridorKey &cached = m_corridorKeys[i];
+		if (cached.m_startZone != key.m_startZone || cached.m_goalZone != key.m_goalZone) continue;
+		if (cached.m_startBlock.x != key.m_startBlock.x || cached.m_startBlock.y != key.m_startBlock.y) continue;
+		if (cached.m_goalBlock.x != key.m_goalBlock.x || cached.m_goalBlock.y != key.m_goalBlock.y) continue;
+		if (cached.m_surfaces != key.m_surfaces) continue;
+		if (cached.m_crusher != key.m_crusher || cached.m_isHuman != key.m_isHuman || cached.m_closestOK != key.m_closestOK) continue;
+
+		found = m_corridorFound[i];
+		cellCount = m_corridorCells[i];
+		if (!found) {
+			return true;
+		}
+		const UnsignedByte *bits = &m_corridorBits[i*m_corridorBytes];
+		Int blockX, blockY;
+		Int ndx = 0;
+		for (blockX = 0; blockX<m_zoneBlockExtent.x; blockX++) {
+			for (blockY = 0; blockY<m_zoneBlockExtent.y; blockY++) {
+				m_zoneBlocks[blockX][blockY].setPassable((bits[ndx>>3] & (1<<(ndx&7))) != 0);
+				ndx++;
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Cache the outcome of the search for this key, and the currently passable blocks as its corridor.
+ */
+void PathfindZoneManager::cacheCorridor(const HierarchicalCorridorKey &key, Bool found, Int cellCount) 
+{
+	if (m_corridorBits == NULL) {
+		return;
+	}
+	Int slot = m_nextCorridor;
+	m_nextCorridor = (m_nextCorridor+1)%CORRIDOR_CACHE_SIZE;
+	if (m_numCorridors < CORRIDOR_CACHE_SIZE) {
+		m_numCorridors++;
+	}
+	m_corridorKeys[slot] = key;
+	m_corridorFound[slot] = found;
+	m_corridorCells[slot] = cellCount;
+
+	UnsignedByte *bits = &m_corridorBits[slot*m_corridorBytes];
+	memset(bits, 0, m_corridorBytes);
+	Int blockX, blockY;
+	Int ndx = 0;
+	for (blockX = 0; blockX<m_zoneBlockExtent.x; blockX++) {
+		for (blockY = 0; blockY<m_zoneBlockExtent.y; blockY++) {
+			if (m_zoneBlocks[blockX][blockY].isPassable()) {
+				bits[ndx>>3] |= (1<<(ndx&7));
+			}
+			ndx++;
+		}
+	}
+}
+
 void PathfindZoneManager::freeZones() 
 {
 	if (m_groundCliffZones) {
@@ -2226,6 +2385,7 @@ void PathfindZoneManager::freeBlocks()
 	}
 	m_zoneBlockExtent.x = 0;
 	m_zoneBlockExtent.y = 0;
+	freeCorridors();
 }
 
 /* Allocate zone equivalency arrays large enough to hold m_maxZone entries.  If the arrays are already
@@ -2267,6 +2427,7 @@ void PathfindZoneManager::allocateBlocks(const IRegion2D &globalBounds)
 	for (i=0; i<m_zoneBlockExtent.x; i++) {
 		m_zoneBlocks[i] = &m_blockOfZoneBlocks[i*(m_zoneBlockExtent.y)];
 	}
+	allocateCorridors();
 }
 
 void PathfindZoneManager::reset(void)  ///< Called when the map is reset.
@@ -2278,6 +2439,7 @@ void PathfindZoneManager::reset(void)  ///< Called when the map is reset.
 
 void PathfindZoneManager::markZonesDirty( Bool insert )  ///< Called when the zones need to be recalculated.
 {
+	invalidateCorridors();
 
 	if (TheGameLogic->getFrame()<2) {
 		m_nextFrameToCalculateZones = 2;
@@ -2321,6 +2483,7 @@ void PathfindZoneManager::calculateZones( PathfindCell **map, PathfindLayer laye
 #endif
 
 
+	invalidateCorridors();
 	m_maxZone = 1;	// we start using zone 0 as a flag.
 	const Int maxZones=24000;
 	zoneStorageType zoneEquivalency[maxZones];
@@ -2856,6 +3019,7 @@ void PathfindZoneManager::updateZonesForModify(PathfindCell **map, PathfindLayer
 	QueryPerformanceCounter((LARGE_INTEGER *)&startTime64);
 #endif
 #endif
+	invalidateCorridors();
 	IRegion2D bounds = structureBounds;
 	bounds.hi.x++;
 	bounds.hi.y++;
@@ -4717,8 +4881,10 @@ void Pathfinder::debugShowSearch(  Bool pathFound  )
 		addIcon(NULL, 0, 0, color);	 // erase.
 	}
 
-	for( s = m_openList; s; s=s->getNextOpen() )
+	Int i;
+	for( i = 0; i < PathfindCell::getOpenListCount(); i++ )
 	{
+		s = PathfindCell::getOpenListCell(i);
 		// create objects to show path - they decay
 		RGBColor color;
 		color.red = color.green = 0;
@@ -5928,6 +6094,11 @@ void Pathfinder::processPathfindQueue(void)
 	bounds.hi.y = REAL_TO_INT_FLOOR(terrainExtent.hi.y / PATHFIND_CELL_SIZE_F);
 	bounds.hi.x--;
 	bounds.hi.y--;
+	if (bounds.lo.x != m_logicalExtent.lo.x || bounds.lo.y != m_logicalExtent.lo.y ||
+		bounds.hi.x != m_logicalExtent.hi.x || bounds.hi.y != m_logicalExtent.hi.y) {
+		// Human corridors are clipped to the logical extent.
+		m_zoneManager.invalidateCorridors();
+	}
 	m_logicalExtent = bounds;
 
 	m_cumulativeCellsAllocated = 0;	// Number of pathfind cells examined.
@@ -6406,13 +6577,7 @@ Path *Pathfinder::findPath( Object *obj, const LocomotorSet& locomotorSet, const
 		isHuman = false; // computer gets to cheat.
 	}
 
-	m_zoneManager.clearPassableFlags();
-	Path *hPat = findHierarchicalPath(isHuman, locomotorSet, from, rawTo, false);
-	if (hPat) {
-		hPat->deleteInstance();
-	}	else {
-		m_zoneManager.setAllPassable();
-	}
+	markHierarchicalCorridor(isHuman, locomotorSet.getValidSurfaces(), from, rawTo, false, false);
 
 	Path *pat = internalFindPath(obj, locomotorSet, from, rawTo);
 	if (pat!=NULL) {
@@ -6842,23 +7007,15 @@ Path *Pathfinder::buildGroundPath(Bool isCrusher, const Coord3D *fromPos, Pathfi
 }			 
 
 /**
- * Work backwards from goal cell to construct final path.
+ * Expand the hierarchical path around the starting point. jba [8/24/2003]
+ * This allows the unit to get around friendly units that may be near it.
  */
-Path *Pathfinder::buildHierachicalPath( const Coord3D *fromPos, PathfindCell *goalCell )
+void Pathfinder::markBlocksAroundStart( const Coord3D *pos )
 {
-	DEBUG_ASSERTCRASH( goalCell, ("Pathfinder::buildHierachicalPath: goalCell == NULL") );
-
-	Path *path = newInstance(Path);
-
-	prependCells(path, fromPos, goalCell, true);
-
-	// Expand the hierarchical path around the starting point. jba [8/24/2003]
-	// This allows the unit to get around friendly units that may be near it.
-	Coord3D pos = *path->getFirstNode()->getPosition();
-	Coord3D minPos = pos;
+	Coord3D minPos = *pos;
 	minPos.x -= PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
 	minPos.y -= PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
-	Coord3D maxPos = pos;
+	Coord3D maxPos = *pos;
 	maxPos.x += PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
 	maxPos.y += PathfindZoneManager::ZONE_BLOCK_SIZE*PATHFIND_CELL_SIZE_F;
 	ICoord2D cellNdxMin, cellNdxMax;
@@ -6870,6 +7027,18 @@ Path *Pathfinder::buildHierachicalPath( const Coord3D *fromPos, PathfindCell *go
 			m_zoneManager.setPassable(i, j, true);
 		}
 	}
+}
+
+/**
+ * Work backwards from goal cell to construct final path.
+ */
+Path *Pathfinder::buildHierachicalPath( const Coord3D *fromPos, PathfindCell *goalCell )
+{
+	DEBUG_ASSERTCRASH( goalCell, ("Pathfinder::buildHierachicalPath: goalCell == NULL") );
+
+	Path *path = newInstance(Path);
+
+	prependCells(path, fromPos, goalCell, true);
 
 #if defined _DEBUG || defined _INTERNAL
 	if (TheGlobalData->m_debugAI==AI_DEBUG_PATHS)
@@ -7023,15 +7192,9 @@ Path *Pathfinder::findGroundPath( const Coord3D *from,
 #endif	
 	Bool centerInCell = false;
 	
-	m_zoneManager.clearPassableFlags();
 	Bool isHuman = true;
 
-	Path *hPat = internal_findHierarchicalPath(isHuman, LOCOMOTORSURFACE_GROUND, from, rawTo, false, false);
-	if (hPat) {
-		hPat->deleteInstance();
-	}	else {
-		m_zoneManager.setAllPassable();
-	}
+	markHierarchicalCorridor(isHuman, LOCOMOTORSURFACE_GROUND, from, rawTo, false, false);
 
 	if (rawTo->x == 0.0f && rawTo->y == 0.0f) {
 		DEBUG_LOG(("Attempting pathfind to 0,0, generally a bug.\n"));
@@ -7445,7 +7608,11 @@ void Pathfinder::processHierarchicalCell( const ICoord2D &scanCell, const ICoord
 Path *Pathfinder::findHierarchicalPath( Bool isHuman, const LocomotorSet& locomotorSet, const Coord3D *from, 
 													 const Coord3D *to, Bool crusher)
 {
-	return internal_findHierarchicalPath(isHuman, locomotorSet.getValidSurfaces(), from, to, crusher, FALSE);
+	Path *path = internal_findHierarchicalPath(isHuman, locomotorSet.getValidSurfaces(), from, to, crusher, FALSE);
+	if (path) {
+		markBlocksAroundStart(path->getFirstNode()->getPosition());
+	}
+	return path;
 }
 
 
@@ -7456,11 +7623,119 @@ Path *Pathfinder::findHierarchicalPath( Bool isHuman, const LocomotorSet& locomo
 Path *Pathfinder::findClosestHierarchicalPath( Bool isHuman, const LocomotorSet& locomotorSet, const Coord3D *from, 
 													 const Coord3D *to, Bool crusher)
 {
-	return internal_findHierarchicalPath(isHuman, locomotorSet.getValidSurfaces(), from, to, crusher, TRUE);
+	Path *path = internal_findHierarchicalPath(isHuman, locomotorSet.getValidSurfaces(), from, to, crusher, TRUE);
+	if (path) {
+		markBlocksAroundStart(path->getFirstNode()->getPosition());
+	}
+	return path;
 }
 
 
 
+/**
+ * Find the first ground cell (in x, then y order) of the given block whose block zone is zone,
+ * and return its center.  Returns false if there isn't one.
+ */
+Bool Pathfinder::findCorridorCell( const ICoord2D &block, zoneStorageType zone, const LocomotorSurfaceTypeMask locomotorSurface,
+																	 Bool crusher, Coord3D *pos )
+{
+	Int loX = block.x*PathfindZoneManager::ZONE_BLOCK_SIZE;
+	Int loY = block.y*PathfindZoneManager::ZONE_BLOCK_SIZE;
+	Int hiX = MIN(loX+PathfindZoneManager::ZONE_BLOCK_SIZE-1, m_extent.hi.x);
+	Int hiY = MIN(loY+PathfindZoneManager::ZONE_BLOCK_SIZE-1, m_extent.hi.y);
+	Int i, j;
+	for (j=loY; j<=hiY; j++) {
+		for (i=loX; i<=hiX; i++) {
+			if (m_zoneManager.getBlockZone(locomotorSurface, crusher, i, j, m_map) != zone) {
+				continue;
+			}
+			adjustCoordToCell(i, j, true, *pos, LAYER_GROUND);
+			if (TheTerrainLogic->getLayerForDestination(pos) == LAYER_GROUND) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+ * Mark the zone blocks the low level search may expand, using the block corridor of a
+ * hierarchical path.  Units in a group move run the same hierarchical search many times, so
+ * between ground cells the search runs between the first cells of the start and goal block
+ * zones rather than the exact cells, and its outcome is cached until the zones or the logical
+ * extent change.  A hit charges the cells the search examined to the frame's pathfind budget,
+ * so whether a search was cached never changes which paths are found or when.
+ * Returns false if no hierarchical path was found, in which case all blocks are marked.
+ */
+Bool Pathfinder::markHierarchicalCorridor( Bool isHuman, const LocomotorSurfaceTypeMask locomotorSurface, const Coord3D *from, 
+													 const Coord3D *to, Bool crusher, Bool closestOK)
+{
+	m_zoneManager.clearPassableFlags();
+
+	// Only searches between ground cells are cached, as bridge searches depend on the exact cells.
+	HierarchicalCorridorKey key;
+	Bool canCache = false;
+	if (m_isMapReady && !m_zoneManager.needToCalculateZones() && (to->x != 0.0f || to->y != 0.0f)) {
+		Coord3D clipTo = *to;
+		Coord3D clipFrom = *from;
+		clip(&clipFrom, &clipTo);
+		if (TheTerrainLogic->getLayerForDestination(&clipTo) == LAYER_GROUND &&
+			TheTerrainLogic->getLayerForDestination(from) == LAYER_GROUND) {
+			ICoord2D startNdx, goalNdx;
+			worldToCell(&clipFrom, &startNdx);
+			worldToCell(&clipTo, &goalNdx);
+			key.m_startBlock.x = startNdx.x/PathfindZoneManager::ZONE_BLOCK_SIZE;
+			key.m_startBlock.y = startNdx.y/PathfindZoneManager::ZONE_BLOCK_SIZE;
+			key.m_goalBlock.x = goalNdx.x/PathfindZoneManager::ZONE_BLOCK_SIZE;
+			key.m_goalBlock.y = goalNdx.y/PathfindZoneManager::ZONE_BLOCK_SIZE;
+			key.m_startZone = m_zoneManager.getBlockZone(locomotorSurface, crusher, startNdx.x, startNdx.y, m_map);
+			key.m_goalZone = m_zoneManager.getBlockZone(locomotorSurface, crusher, goalNdx.x, goalNdx.y, m_map);
+			key.m_surfaces = locomotorSurface;
+			key.m_crusher = crusher;
+			key.m_isHuman = isHuman;
+			key.m_closestOK = closestOK;
+			canCache = true;
+		}
+	}
+
+	Coord3D searchFrom = *from;
+	Coord3D searchTo = *to;
+	if (canCache) {
+		Bool found;
+		Int cellCount;
+		if (m_zoneManager.applyCachedCorridor(key, found, cellCount)) {
+			// Leave the pathfinder as the search would have.
+			m_isTunneling = false;
+			m_cumulativeCellsAllocated += cellCount;
+			if (!found) {
+				m_zoneManager.setAllPassable();
+				return false;
+			}
+			markBlocksAroundStart(from);
+			return true;
+		}
+		canCache = findCorridorCell(key.m_startBlock, key.m_startZone, locomotorSurface, crusher, &searchFrom) &&
+			findCorridorCell(key.m_goalBlock, key.m_goalZone, locomotorSurface, crusher, &searchTo);
+		if (!canCache) {
+			searchFrom = *from;
+			searchTo = *to;
+		}
+	}
+
+	Int cellsBefore = m_cumulativeCellsAllocated;
+	Path *hPat = internal_findHierarchicalPath(isHuman, locomotorSurface, &searchFrom, &searchTo, crusher, closestOK);
+	if (canCache) {
+		m_zoneManager.cacheCorridor(key, hPat != NULL, m_cumulativeCellsAllocated - cellsBefore);
+	}
+	if (hPat == NULL) {
+		m_zoneManager.setAllPassable();
+		return false;
+	}
+	hPat->deleteInstance();
+	markBlocksAroundStart(from);
+	return true;
+}
+
 /**
  * Find a short, valid path between given locations.
  * Uses A* algorithm.
@@ -8775,14 +9050,7 @@ Path *Pathfinder::findClosestPath( Object *obj, const LocomotorSet& locomotorSet
 	if (m_isTunneling) {
 		m_zoneManager.setAllPassable(); // can't optimize.
 	}	else {
-		m_zoneManager.clearPassableFlags();
-		Path *hPat = findClosestHierarchicalPath(isHuman, locomotorSet, from, rawTo, false);
-		if (hPat) {
-			hPat->deleteInstance();
-			gotHierarchicalPath = true;
-		}	else {
-			m_zoneManager.setAllPassable();
-		}
+		gotHierarchicalPath = markHierarchicalCorridor(isHuman, locomotorSet.getValidSurfaces(), from, rawTo, false, true);
 	}
 	const Bool startedStuck = m_isTunneling;
 
@@ -10652,13 +10920,7 @@ Path *Pathfinder::findAttackPath( const Object *obj, const LocomotorSet& locomot
 	if (obj && obj->getControllingPlayer() && (obj->getControllingPlayer()->getPlayerType()==PLAYER_COMPUTER)) {
 		isHuman = false; // computer gets to cheat.
 	}
-	m_zoneManager.clearPassableFlags();
-	Path *hPat = findClosestHierarchicalPath(isHuman, locomotorSet, from, victimPos, isCrusher);
-	if (hPat) {
-		hPat->deleteInstance();
-	}	else {
-		m_zoneManager.setAllPassable();
-	}
+	markHierarchicalCorridor(isHuman, locomotorSet.getValidSurfaces(), from, victimPos, isCrusher, true);
 
 	Int cellCount = 0;
 
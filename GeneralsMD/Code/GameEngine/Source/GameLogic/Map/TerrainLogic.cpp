@@ -997,6 +997,15 @@ TerrainLogic::TerrainLogic()
 	m_bridgeDamageStatesChanged = FALSE;
 	m_mapDX = 0;
 	m_mapDY = 0;
+	m_mapBorder = 0;
+	m_maxMapHeight = 0.0f;
+
+	m_waterIndexDirty = TRUE;
+	m_waterIndexBounds.lo.x = m_waterIndexBounds.lo.y = 0;
+	m_waterIndexBounds.hi.x = m_waterIndexBounds.hi.y = -1;
+	m_waterIndexCellSize = 1;
+	m_waterIndexCellsX = 0;
+	m_waterIndexCellsY = 0;
 
 
 }  // end TerrainLogic
@@ -1028,6 +1037,11 @@ void TerrainLogic::reset( void )
 	deleteBridges();
 	PolygonTrigger::deleteTriggers();
 	m_numWaterToUpdate = 0;
+	freeHeightSamples();
+
+	m_waterIndexDirty = TRUE;
+	m_waterIndexCellStart.clear();
+	m_waterIndexTriggers.clear();
 
 }  // end reset
 
@@ -1154,6 +1168,9 @@ void TerrainLogic::newMap( Bool saveGame )
 		enable = TRUE;
 	enableWaterGrid( enable );
 
+	// the polygon triggers are all loaded now
+	rebuildWaterIndex();
+
 }  // end newMap
 
 // ------------------------------------------------------------------------------------------------
@@ -1435,11 +1452,127 @@ void TerrainLogic::deleteWaypoints(void)
 	m_waypointListHead = NULL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Bresenham walk over the height samples from pos to posOther. This is the same walk
+	* BaseHeightMapRenderObjClass::isClearLineOfSight does, so results don't change whether
+	* or not there is a renderer. */
 //-------------------------------------------------------------------------------------------------
 Bool TerrainLogic::isClearLineOfSight(const Coord3D& pos, const Coord3D& posOther) const
 {
-	DEBUG_CRASH(("implement ME"));
-	return false;
+	if (m_mapData == NULL)
+	{
+		DEBUG_CRASH(("no height samples"));
+		return false;
+	}
+
+	const Real MAP_XY_FACTOR_INV = 1.0f / MAP_XY_FACTOR;
+
+	Int start_x = REAL_TO_INT_FLOOR(pos.x * MAP_XY_FACTOR_INV) + m_mapBorder;
+	Int start_y = REAL_TO_INT_FLOOR(pos.y * MAP_XY_FACTOR_INV) + m_mapBorder;
+	Int end_x = REAL_TO_INT_FLOOR(posOther.x * MAP_XY_FACTOR_INV) + m_mapBorder;
+	Int end_y = REAL_TO_INT_FLOOR(posOther.y * MAP_XY_FACTOR_INV) + m_mapBorder;
+	Int delta_x = abs(end_x - start_x);			// The difference between the x's
+	Int delta_y = abs(end_y - start_y);			// The difference between the y's
+	Int x = start_x;												// Start x off at the first pixel
+	Int y = start_y;												// Start y off at the first pixel
+
+	Int xinc1, xinc2;
+	if (end_x >= start_x)								// The x-values are increasing
+	{
+		xinc1 = 1;
+		xinc2 = 1;
+	}
+	else																// The x-values are decreasing
+	{
+		xinc1 = -1;
+		xinc2 = -1;
+	}
+
+	Int yinc1, yinc2;
+	if (end_y >= start_y)               // The y-values are increasing
+	{
+		yinc1 = 1;
+		yinc2 = 1;
+	}
+	else																// The y-values are decreasing
+	{
+		yinc1 = -1;
+		yinc2 = -1;
+	}
+
+	Int den, num, numadd, numpixels;
+	if (delta_x >= delta_y)							// There is at least one x-value for every y-value
+	{
+		xinc1 = 0;												// Don't change the x when numerator >= denominator
+		yinc2 = 0;												// Don't change the y for every iteration
+		den = delta_x;
+		num = delta_x / 2;
+		numadd = delta_y;
+		numpixels = delta_x;							// There are more x-values than y-values
+	}
+	else																// There is at least one y-value for every x-value
+	{
+		xinc2 = 0;												// Don't change the x for every iteration
+		yinc1 = 0;												// Don't change the y when numerator >= denominator
+		den = delta_y;
+		num = delta_y / 2;
+		numadd = delta_x;
+		numpixels = delta_y;							// There are more y-values than x-values
+	}
+
+	Real nsInv = 1.0f / numpixels;
+	Real z = pos.z;
+	Real dz = posOther.z - z;
+	Real zinc = dz * nsInv;
+
+	Bool result = true;
+	for (Int curpixel = 0; curpixel < numpixels; curpixel++)
+	{
+		if (x < 0 || 
+				y < 0 ||
+				x >= m_mapDX-1 ||
+				y >= m_mapDY-1)
+		{
+			// once we go off the map, we're done
+			break;
+		}
+
+		Int idx = x + y*m_mapDX;
+		Real height = m_mapData[idx];
+		height = MAX(height, (Real)m_mapData[idx + 1]);
+		height = MAX(height, (Real)m_mapData[idx + m_mapDX]);
+		height = MAX(height, (Real)m_mapData[idx + m_mapDX + 1]);
+		height *= MAP_HEIGHT_SCALE;
+
+		// if terrainHeight > z, we can't see, so punt.
+		// add a little fudge to account for slop.
+		const Real LOS_FUDGE = 0.5f;
+		if (height > z + LOS_FUDGE)
+		{
+			result = false;
+			break;
+		}
+
+		// we're above the max height of the terrain and still looking up, so we're done.
+		if (z >= m_maxMapHeight && zinc > 0.0f)
+		{
+			break;
+		}
+
+		z += zinc;
+
+		num += numadd;										// Increase the numerator by the top of the fraction
+		if (num >= den)										// Check if numerator >= denominator
+		{
+			num -= den;											// Calculate the new numerator value
+			x += xinc1;											// Change the x as appropriate
+			y += yinc1;											// Change the y as appropriate
+		}
+		x += xinc2;												// Change the x as appropriate
+		y += yinc2;												// Change the y as appropriate
+	}
+
+	return result;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1447,6 +1580,9 @@ Bool TerrainLogic::isClearLineOfSight(const Coord3D& pos, const Coord3D& posOthe
 //-------------------------------------------------------------------------------------------------
 Real TerrainLogic::getGroundHeight( Real x, Real y, Coord3D* normal ) const
 {
+	if( m_mapData )
+		return sampleGroundHeight( x, y, normal );
+
 	if( normal )
 		normal->zero();
 
@@ -1454,6 +1590,258 @@ Real TerrainLogic::getGroundHeight( Real x, Real y, Coord3D* normal ) const
 
 }  // end getHight
 
+//-------------------------------------------------------------------------------------------------
+/** Batch version of getGroundHeight. When we own the height samples this is a tight loop
+	* over the grid with no virtual calls (except for points off the edge of the map), so
+	* callers with lots of points should prefer it. */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::getGroundHeights( Int count, const Coord2D *xy, Real *heights, Coord3D *normals ) const
+{
+	Int i;
+
+	if( m_mapData == NULL )
+	{
+		for( i = 0; i < count; ++i )
+			heights[ i ] = getGroundHeight( xy[ i ].x, xy[ i ].y, normals ? &normals[ i ] : NULL );
+		return;
+	}
+
+	if( normals == NULL )
+	{
+		for( i = 0; i < count; ++i )
+			heights[ i ] = sampleGroundHeight( xy[ i ].x, xy[ i ].y, NULL );
+	}
+	else
+	{
+		for( i = 0; i < count; ++i )
+			heights[ i ] = sampleGroundHeight( xy[ i ].x, xy[ i ].y, &normals[ i ] );
+	}
+
+}  // end getGroundHeights
+
+//-------------------------------------------------------------------------------------------------
+/** Take our own copy of the map height samples. The terrain render object keeps its own
+	* (possibly displaced) copy for drawing; this one is what the logic uses. */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::setHeightSamples( const UnsignedByte *data, Int dx, Int dy, Int border )
+{
+	freeHeightSamples();
+
+	if( data == NULL || dx <= 0 || dy <= 0 )
+		return;
+
+	m_mapData = NEW UnsignedByte[ dx * dy ];
+	memcpy( m_mapData, data, dx * dy );
+	m_mapDX = dx;
+	m_mapDY = dy;
+	m_mapBorder = border;
+
+	// samples only ever get lowered after this, so the load time max stays an upper bound
+	Int maxHt = 0;
+	for( Int i = 0; i < dx * dy; ++i )
+	{
+		if( m_mapData[ i ] > maxHt )
+			maxHt = m_mapData[ i ];
+	}
+	m_maxMapHeight = maxHt * MAP_HEIGHT_SCALE;
+
+}  // end setHeightSamples
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::freeHeightSamples( void )
+{
+
+	delete [] m_mapData;
+	m_mapData = NULL;
+	m_mapBorder = 0;
+	m_maxMapHeight = 0.0f;
+
+}  // end freeHeightSamples
+
+//-------------------------------------------------------------------------------------------------
+/** Height and smoothed normal of the triangle plane containing (x, y). This must match
+	* BaseHeightMapRenderObjClass::getHeightMapHeight bit for bit, since replays and net games
+	* recorded against that code have to play back the same. */
+//-------------------------------------------------------------------------------------------------
+Real TerrainLogic::sampleGroundHeight( Real x, Real y, Coord3D *normal ) const
+{
+	DEBUG_ASSERTCRASH( m_mapData, ("no height samples") );
+
+	//	3-----2
+	//  |    /|
+	//  |  /  |
+	//	|/    |
+	//  0-----1
+	//Find surrounding grid points
+	const Real MAP_XY_FACTOR_INV = 1.0f / MAP_XY_FACTOR;
+
+	Real xdiv = x * MAP_XY_FACTOR_INV;
+	Real ydiv = y * MAP_XY_FACTOR_INV;
+
+	Real ixf = FAST_REAL_FLOOR( xdiv );
+	Real iyf = FAST_REAL_FLOOR( ydiv );
+
+	Real fx = xdiv - ixf; //get fraction
+	Real fy = ydiv - iyf; //get fraction
+
+	// since ixf & iyf are already floor'ed, we can use the fastest f->i conversion we have...
+	Int ix = fast_float2long_round( ixf ) + m_mapBorder;
+	Int iy = fast_float2long_round( iyf ) + m_mapBorder;
+	const Int xExtent = m_mapDX;
+
+	// Check for extent-3, not extent-1: we go into the next row/column of data for smoothed 
+	// triangle points, so extent-1 goes off the end...
+	if( ix > (xExtent-3) || iy > (m_mapDY-3) || iy < 1 || ix < 1 )
+	{
+		// sample point is not on the heightmap, so use the nearest edge sample
+		if( normal )
+		{
+			normal->x = 0.0f;
+			normal->y = 0.0f;
+			normal->z = 1.0f;
+		}
+		return getClipHeight( ix, iy ) * MAP_HEIGHT_SCALE;
+	}
+
+	const UnsignedByte *data = m_mapData;
+	Int idx = ix + iy*xExtent;
+	Real height;
+	Real p0 = data[ idx ];
+	Real p2 = data[ idx + xExtent + 1 ];
+	if( fy > fx ) // test if we are in the upper triangle
+	{
+		Real p3 = data[ idx + xExtent ];
+		height = (p3 + (1.0f-fy)*(p0-p3) + fx*(p2-p3)) * MAP_HEIGHT_SCALE;
+	}
+	else
+	{
+		// we are in the lower triangle
+		Real p1 = data[ idx + 1 ];
+		height = (p1 + fy*(p2-p1) + (1.0f-fx)*(p0-p1)) * MAP_HEIGHT_SCALE;
+	}
+
+	if( normal )
+	{
+		//		9		  8
+		//
+		//10	3-----2		7
+		//	  |    /|
+		//	  |  /  |
+		//		|/    |
+		//11	0-----1		6
+		//
+		//		4			5
+		//Find surrounding grid points for smoothed normals.
+		Int idx4 = ix + (iy-1)*xExtent;
+		Int idx0 = ix + iy*xExtent;
+		Int idx3 = ix + iy*xExtent+xExtent;
+		Int idx9 = ix + (iy+2)*xExtent;
+		UnsignedByte d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11;
+		d0 = data[idx0];
+		d1 = data[idx0+1];
+		d2 = data[idx3+1];
+		d3 = data[idx3];
+		d4 = data[idx4];
+		d5 = data[idx4+1];
+		d6 = data[idx0+2];
+		d7 = data[idx3+2];
+		d8 = data[idx9+1];
+		d9 = data[idx9];
+		d10 = data[idx3-1];
+		d11 = data[idx0-1];
+
+		Real deltaZ_X0 = d1-d11;
+		Real deltaZ_X1 = d6-d0;
+		Real deltaZ_X2 = d7-d3;
+		Real deltaZ_X3 = d6-d0;
+
+		Real deltaZ_Y0 = d3-d4;
+		Real deltaZ_Y1 = d2-d5;
+		Real deltaZ_Y2 = d8-d1;
+		Real deltaZ_Y3 = d9-d0;
+
+		// Interpolate to get the smoothed valued.
+		Real deltaZ_X_Left = deltaZ_X0*(1.0f-fx) + fx*deltaZ_X3;
+		Real deltaZ_X_Right = deltaZ_X1*(1.0f-fx) + fx*deltaZ_X2;
+		Real deltaZ_X = deltaZ_X_Left*(1.0-fy) + fy*deltaZ_X_Right;
+
+		Real deltaZ_Y_Left = deltaZ_Y0*(1.0f-fx) + fx*deltaZ_Y3;
+		Real deltaZ_Y_Right = deltaZ_Y1*(1.0f-fx) + fx*deltaZ_Y2;
+		Real deltaZ_Y = deltaZ_Y_Left*(1.0-fy) + fy*deltaZ_Y_Right;
+
+		Vector3 l2r, n2f, normalAtTexel;
+		l2r.Set(2*MAP_XY_FACTOR/MAP_HEIGHT_SCALE, 0, deltaZ_X);
+		n2f.Set(0, 2*MAP_XY_FACTOR/MAP_HEIGHT_SCALE, deltaZ_Y);
+		Vector3::Normalized_Cross_Product(l2r,n2f, &normalAtTexel);
+		normal->x = normalAtTexel.X;
+		normal->y = normalAtTexel.Y;
+		normal->z = normalAtTexel.Z;
+	}
+
+	return height;
+
+}  // end sampleGroundHeight
+
+//-------------------------------------------------------------------------------------------------
+/** Nearest height sample to grid pos (x, y), counting the border. Same clamp as
+	* BaseHeightMapRenderObjClass::getClipHeight. */
+//-------------------------------------------------------------------------------------------------
+UnsignedByte TerrainLogic::getClipHeight( Int x, Int y ) const
+{
+	Int xextent = m_mapDX - 1;
+	Int yextent = m_mapDY - 1;
+
+	if( x < 0 ) 
+		x = 0; 
+	else if( x > xextent ) 
+		x = xextent;
+
+	if( y < 0 ) 
+		y = 0; 
+	else if( y > yextent ) 
+		y = yextent;
+
+	return m_mapData[ x + y*m_mapDX ];
+
+}  // end getClipHeight
+
+//-------------------------------------------------------------------------------------------------
+/** Raw height sample at the given grid position (not counting the border) */
+//-------------------------------------------------------------------------------------------------
+Int TerrainLogic::getRawMapHeight( const ICoord2D *gridPos ) const
+{
+
+	if( m_mapData == NULL )
+		return TheTerrainVisual ? TheTerrainVisual->getRawMapHeight( gridPos ) : 0;
+
+	Int ndx = (gridPos->y + m_mapBorder) * m_mapDX + (gridPos->x + m_mapBorder);
+	if( ndx >= 0 && ndx < m_mapDX * m_mapDY )
+		return m_mapData[ ndx ];
+	return 0;
+
+}  // end getRawMapHeight
+
+//-------------------------------------------------------------------------------------------------
+/** Lower the raw height sample at the given grid position. Like the terrain visual, this
+	* only ever lowers the terrain, so flattening doesn't scissor with roads. */
+//-------------------------------------------------------------------------------------------------
+void TerrainLogic::setRawMapHeight( const ICoord2D *gridPos, Int height )
+{
+
+	if( m_mapData )
+	{
+		Int ndx = (gridPos->y + m_mapBorder) * m_mapDX + (gridPos->x + m_mapBorder);
+		if( ndx >= 0 && ndx < m_mapDX * m_mapDY && m_mapData[ ndx ] > height )
+			m_mapData[ ndx ] = (UnsignedByte)height;
+	}
+
+	// the visual keeps its own copy for drawing
+	if( TheTerrainVisual )
+		TheTerrainVisual->setRawMapHeight( gridPos, height );
+
+}  // end setRawMapHeight
+
 //-------------------------------------------------------------------------------------------------
 /** default get height for terrain logic */
 //-------------------------------------------------------------------------------------------------
@@ -2201,14 +2589,25 @@ const WaterHandle* TerrainLogic::getWaterHandle( Real x, Real y )
 	iLoc.y = REAL_TO_INT_FLOOR( y + 0.5f );
 	iLoc.z = 0;
 
-	// Look for water areas in the polygon triggers
-	for( PolygonTrigger *pTrig = PolygonTrigger::getFirstPolygonTrigger(); 
-			 pTrig; 
-			 pTrig = pTrig->getNext() ) 
+	if( m_waterIndexDirty )
+		rebuildWaterIndex();
+
+	// Look for water areas in the polygon triggers. A point outside every water area's bounds
+	// can't be in any of them, otherwise only the triggers bucketed in its cell can contain it.
+	Int first = 0, last = 0;
+	if( iLoc.x >= m_waterIndexBounds.lo.x && iLoc.x <= m_waterIndexBounds.hi.x &&
+			iLoc.y >= m_waterIndexBounds.lo.y && iLoc.y <= m_waterIndexBounds.hi.y )
 	{
+		Int cellX = (iLoc.x - m_waterIndexBounds.lo.x) / m_waterIndexCellSize;
+		Int cellY = (iLoc.y - m_waterIndexBounds.lo.y) / m_waterIndexCellSize;
+		Int cell = cellY * m_waterIndexCellsX + cellX;
+		first = m_waterIndexCellStart[ cell ];
+		last = m_waterIndexCellStart[ cell + 1 ];
+	}
 
-		if( !pTrig->isWaterArea() ) 
-			continue;
+	for( Int i = first; i < last; ++i )
+	{
+		PolygonTrigger *pTrig = m_waterIndexTriggers[ i ];
 
 		// See if point is in a water area
 		if( pTrig->pointInTrigger( iLoc ) ) 
@@ -2250,6 +2649,115 @@ const WaterHandle* TerrainLogic::getWaterHandle( Real x, Real y )
 
 }  // end getWaterHandle
 
+// ------------------------------------------------------------------------------------------------
+/** Bucket the water polygon triggers into a coarse grid covering their bounding boxes. The 
+	* triggers in each cell stay in trigger list order, since getWaterHandle breaks ties between 
+	* equal water heights by that order. */
+// ------------------------------------------------------------------------------------------------
+void TerrainLogic::rebuildWaterIndex( void )
+{
+	const Int MIN_WATER_INDEX_CELL_SIZE = 50;	// in world units
+	const Int MAX_WATER_INDEX_CELLS = 64;			// per axis
+
+	m_waterIndexDirty = FALSE;
+	m_waterIndexCellStart.clear();
+	m_waterIndexTriggers.clear();
+	m_waterIndexCellsX = 0;
+	m_waterIndexCellsY = 0;
+	m_waterIndexCellSize = 1;
+
+	// find the union of the water areas' bounds (empty, if there aren't any)
+	IRegion2D total;
+	total.lo.x = total.lo.y = 0;
+	total.hi.x = total.hi.y = -1;
+	Bool any = FALSE;
+	PolygonTrigger *pTrig;
+	for( pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext() )
+	{
+		if( !pTrig->isWaterArea() )
+			continue;
+
+		const IRegion2D *b = pTrig->getBounds();
+		if( b->lo.x > b->hi.x || b->lo.y > b->hi.y )
+			continue;	// no points
+
+		if( !any )
+		{
+			total = *b;
+			any = TRUE;
+		}
+		else
+		{
+			if( b->lo.x < total.lo.x ) total.lo.x = b->lo.x;
+			if( b->lo.y < total.lo.y ) total.lo.y = b->lo.y;
+			if( b->hi.x > total.hi.x ) total.hi.x = b->hi.x;
+			if( b->hi.y > total.hi.y ) total.hi.y = b->hi.y;
+		}
+	}
+	m_waterIndexBounds = total;
+	if( !any )
+		return;
+
+	Int width = total.hi.x - total.lo.x + 1;
+	Int height = total.hi.y - total.lo.y + 1;
+	Int biggest = width > height ? width : height;
+	m_waterIndexCellSize = (biggest + MAX_WATER_INDEX_CELLS - 1) / MAX_WATER_INDEX_CELLS;
+	if( m_waterIndexCellSize < MIN_WATER_INDEX_CELL_SIZE )
+		m_waterIndexCellSize = MIN_WATER_INDEX_CELL_SIZE;
+	m_waterIndexCellsX = (width + m_waterIndexCellSize - 1) / m_waterIndexCellSize;
+	m_waterIndexCellsY = (height + m_waterIndexCellSize - 1) / m_waterIndexCellSize;
+
+	Int numCells = m_waterIndexCellsX * m_waterIndexCellsY;
+	m_waterIndexCellStart.resize( numCells + 1, 0 );
+
+	// two passes: count the entries per cell, then fill them in
+	Int pass, x, y;
+	std::vector<Int> fill;
+	for( pass = 0; pass < 2; ++pass )
+	{
+		if( pass == 1 )
+		{
+			// turn counts into offsets
+			Int offset = 0;
+			for( Int c = 0; c <= numCells; ++c )
+			{
+				Int count = m_waterIndexCellStart[ c ];
+				m_waterIndexCellStart[ c ] = offset;
+				offset += count;
+			}
+			m_waterIndexTriggers.resize( offset );
+			fill = m_waterIndexCellStart;
+		}
+
+		for( pTrig = PolygonTrigger::getFirstPolygonTrigger(); pTrig; pTrig = pTrig->getNext() )
+		{
+			if( !pTrig->isWaterArea() )
+				continue;
+
+			const IRegion2D *b = pTrig->getBounds();
+			if( b->lo.x > b->hi.x || b->lo.y > b->hi.y )
+				continue;
+
+			Int loX = (b->lo.x - total.lo.x) / m_waterIndexCellSize;
+			Int loY = (b->lo.y - total.lo.y) / m_waterIndexCellSize;
+			Int hiX = (b->hi.x - total.lo.x) / m_waterIndexCellSize;
+			Int hiY = (b->hi.y - total.lo.y) / m_waterIndexCellSize;
+			for( y = loY; y <= hiY; ++y )
+			{
+				for( x = loX; x <= hiX; ++x )
+				{
+					Int cell = y * m_waterIndexCellsX + x;
+					if( pass == 0 )
+						++m_waterIndexCellStart[ cell ];
+					else
+						m_waterIndexTriggers[ fill[ cell ]++ ] = pTrig;
+				}
+			}
+		}
+	}
+
+}  // end rebuildWaterIndex
+
 // ------------------------------------------------------------------------------------------------
 /** Get water handle by name assigned from the editor */
 // ------------------------------------------------------------------------------------------------
@@ -2744,33 +3252,33 @@ void TerrainLogic::flattenTerrain(Object *obj)
 						ICoord2D gridPos;
 						gridPos.x = i;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 						//Added the corners so it does a whole 3X3 square... ML
 						gridPos.x = i-1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 					}
 				}
@@ -2825,33 +3333,33 @@ void TerrainLogic::flattenTerrain(Object *obj)
 						ICoord2D gridPos;
 						gridPos.x = i;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 						//Added the corners so it does a whole 3X3 square... ML
 						gridPos.x = i-1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i+1;
 						gridPos.y = j-1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 						gridPos.x = i-1;
 						gridPos.y = j+1;
-						TheTerrainVisual->setRawMapHeight(&gridPos, rawDataHeight);
+						setRawMapHeight(&gridPos, rawDataHeight);
 
 
 					}
@@ -2906,9 +3414,9 @@ void TerrainLogic::createCraterInTerrain(Object *obj)
 
         Real displacementAmount = radius * (1.0f - distance / radius );
 
-        Int targetHeight = MAX( 1, TheTerrainVisual->getRawMapHeight( &gridPos ) - displacementAmount );
+        Int targetHeight = MAX( 1, getRawMapHeight( &gridPos ) - displacementAmount );
 
-				TheTerrainVisual->setRawMapHeight( &gridPos, targetHeight );
+				setRawMapHeight( &gridPos, targetHeight );
 			}
     } // next j
   } // next i
@@ -3027,6 +3535,10 @@ void TerrainLogic::xfer( Xfer *xfer )
 // ------------------------------------------------------------------------------------------------
 void TerrainLogic::loadPostProcess( void )
 {
+
+	// the polygon triggers' points have been restored now
+	rebuildWaterIndex();
+
 	Bridge* pBridge = getFirstBridge();
 	Bridge* pNext;
 	while (pBridge) 
@@ -619,11 +619,9 @@ void ActiveBody::attemptDamage( DamageInfo *damageInfo )
 		// if our health has gone down then do run the damage module callback
 		if( m_currentHealth < m_prevHealth )
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			for (DamageModuleInterface** m = obj->getDamageModules(); *m; ++m)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
+				DamageModuleInterface* d = *m;
 
 				d->onDamage( damageInfo );
 			}
@@ -631,11 +629,9 @@ void ActiveBody::attemptDamage( DamageInfo *damageInfo )
 
 		if (m_curDamageState != oldState)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			for (DamageModuleInterface** m = obj->getDamageModules(); *m; ++m)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
+				DamageModuleInterface* d = *m;
 
 				d->onBodyDamageStateChange( damageInfo, oldState, m_curDamageState );
 			}
@@ -856,11 +852,9 @@ void ActiveBody::attemptHealing( DamageInfo *damageInfo )
 		// if our health has gone UP then do run the damage module callback
 		if( m_currentHealth > m_prevHealth )
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			for (DamageModuleInterface** m = obj->getDamageModules(); *m; ++m)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
+				DamageModuleInterface* d = *m;
 
 				d->onHealing( damageInfo );
 			}
@@ -868,11 +862,9 @@ void ActiveBody::attemptHealing( DamageInfo *damageInfo )
 
 		if (m_curDamageState != oldState)
 		{
-			for (BehaviorModule** m = obj->getBehaviorModules(); *m; ++m)
+			for (DamageModuleInterface** m = obj->getDamageModules(); *m; ++m)
 			{
-				DamageModuleInterface* d = (*m)->getDamage();
-				if (!d)
-					continue;
+				DamageModuleInterface* d = *m;
 
 				d->onBodyDamageStateChange( damageInfo, oldState, m_curDamageState );
 			}
@@ -1237,6 +1229,8 @@ void ActiveBody::internalChangeHealth( Real delta )
 	if( m_currentHealth < lowEndCap )
 		m_currentHealth = lowEndCap;
 
+	getObject()->markCRCDirty();
+
 	// recalc the damage state
 	BodyDamageType oldState = m_curDamageState;
 	setCorrectDamageState();
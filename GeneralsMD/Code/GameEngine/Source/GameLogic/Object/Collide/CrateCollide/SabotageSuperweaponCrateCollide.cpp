@@ -149,13 +149,9 @@ Bool SabotageSuperweaponCrateCollide::executeCrateBehavior( Object *other )
 	}
 
 	//Reset ALL special powers!
-	for( BehaviorModule **m = other->getBehaviorModules(); *m; ++m )
+	for( SpecialPowerModuleInterface** m = other->getSpecialPowerModules(); *m; ++m )
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if( !sp )
-		{
-			continue;
-		}
+		SpecialPowerModuleInterface* sp = *m;
 		sp->startPowerRecharge();
 	}
 
@@ -72,11 +72,9 @@ void SpecialPowerCreate::onBuildComplete( void )
 
 	CreateModule::onBuildComplete(); // extend
 
-	for (BehaviorModule** m = getObject()->getBehaviorModules(); *m; ++m)
+	for (SpecialPowerModuleInterface** m = getObject()->getSpecialPowerModules(); *m; ++m)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		sp->onSpecialPowerCreation();
 	}
@@ -108,7 +108,10 @@ void ExperienceTracker::setMinVeterancyLevel( VeterancyLevel newLevel )
 		m_currentLevel = newLevel;
 		m_currentExperience = m_parent->getTemplate()->getExperienceRequired(m_currentLevel); //Minimum for this level
 		if (m_parent)
+		{
+			m_parent->markCRCDirty();
 			m_parent->onVeterancyLevelChanged( oldLevel, newLevel );
+		}
 	}
 }
 
@@ -124,7 +127,10 @@ void ExperienceTracker::setVeterancyLevel( VeterancyLevel newLevel, Bool provide
 		m_currentLevel = newLevel;
 		m_currentExperience = m_parent->getTemplate()->getExperienceRequired(m_currentLevel); //Minimum for this level
 		if (m_parent)
+		{
+			m_parent->markCRCDirty();
 			m_parent->onVeterancyLevelChanged( oldLevel, newLevel, provideFeedback );
+		}
 	}
 }
 
@@ -191,6 +197,8 @@ void ExperienceTracker::addExperiencePoints( Int experienceGain, Bool canScaleFo
 	}
 
 	m_currentLevel = (VeterancyLevel)levelIndex;
+	if (m_parent)
+		m_parent->markCRCDirty();
 
 	if( oldLevel != m_currentLevel )
 	{
@@ -231,6 +239,8 @@ void ExperienceTracker::setExperienceAndLevel( Int experienceIn, Bool provideFee
 	}
 
 	m_currentLevel = (VeterancyLevel)levelIndex;
+	if (m_parent)
+		m_parent->markCRCDirty();
 
 	if( oldLevel != m_currentLevel )
 	{
@@ -546,11 +546,7 @@ LocomotorTemplate* LocomotorStore::findLocomotorTemplate(NameKeyType namekey)
 	if (namekey == NAMEKEY_INVALID)
 		return NULL;
 
-  LocomotorTemplateMap::iterator it = m_locomotorTemplates.find(namekey);
-  if (it == m_locomotorTemplates.end()) 
-		return NULL;
-	else
-		return (*it).second;
+	return m_locomotorTemplates.find(namekey);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -559,15 +555,7 @@ const LocomotorTemplate* LocomotorStore::findLocomotorTemplate(NameKeyType namek
 	if (namekey == NAMEKEY_INVALID)
 		return NULL;
 
-  LocomotorTemplateMap::const_iterator it = m_locomotorTemplates.find(namekey);
-  if (it == m_locomotorTemplates.end()) 
-	{
-		return NULL;
-	}
-	else
-	{
-		return (*it).second;
-	}
+	return m_locomotorTemplates.find(namekey);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -584,7 +572,9 @@ void LocomotorStore::reset()
 		Overridable *locoTemp = it->second->deleteOverrides();
 		if (!locoTemp)
 		{
-			m_locomotorTemplates.erase(it);
+			// step past the entry before erasing it, erase invalidates the iterator
+			LocomotorTemplateMap::iterator doomed = it++;
+			m_locomotorTemplates.erase(doomed);
 		}
 		else
 		{
@@ -644,7 +634,7 @@ LocomotorTemplate *LocomotorStore::newOverride( LocomotorTemplate *locoTemplate
 	// if this is an override, then we want the pointer on the existing named locomotor to point us 
 	// to the override, so don't add it to the map.
 	if (!isOverride)
-		TheLocomotorStore->m_locomotorTemplates[namekey] = loco;
+		TheLocomotorStore->m_locomotorTemplates.add(namekey, loco);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -201,6 +201,11 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_xferContainedByID(INVALID_ID),
 	m_containedByFrame(0),
 	m_behaviors(NULL),
+	m_damageModules(NULL),
+	m_dieModules(NULL),
+	m_upgradeModules(NULL),
+	m_collideModules(NULL),
+	m_specialPowerModules(NULL),
 	m_body(NULL),
 	m_contain(NULL),
   m_stealth(NULL),
@@ -226,6 +231,7 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 	m_partitionLastValue(NULL),
 	m_smcUntil(NEVER),
 	m_privateStatus(0),
+	m_crcCacheCount(-1),
 	m_formationID(NO_FORMATION_ID),
 	m_isReceivingDifficultyBonus(FALSE),
 	m_singleUseCommandUsed(FALSE),
@@ -470,6 +476,8 @@ Object::Object( const ThingTemplate *tt, const ObjectStatusMaskType &objectStatu
 
 	*curB = NULL;
 
+	buildModuleInterfaceLists();
+
 	AIUpdateInterface *ai = getAIUpdateInterface();
 	if (ai) {
 		ai->setAttitude(getTeam()->getPrototype()->getTemplateInfo()->m_initialTeamAttitude);
@@ -566,11 +574,9 @@ void Object::initObject()
 
 	//For each special power module that we have, add it's type to the specialpower bits. This is
 	//for optimal access later.
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	for (SpecialPowerModuleInterface** m = m_specialPowerModules; *m; ++m)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if( spTemplate )
@@ -664,6 +670,16 @@ Object::~Object()
 	m_ai = NULL;
 	m_physics = NULL;
 
+	// empty the per-interface lists first, nobody should be notifying modules we're deleting
+	if (m_damageModules)
+	{
+		m_damageModules[0] = NULL;
+		m_dieModules[0] = NULL;
+		m_upgradeModules[0] = NULL;
+		m_collideModules[0] = NULL;
+		m_specialPowerModules[0] = NULL;
+	}
+
 	// delete any modules present
 	for (BehaviorModule** b = m_behaviors; *b; ++b)
 	{
@@ -674,6 +690,17 @@ Object::~Object()
 	delete [] m_behaviors;		
 	m_behaviors = NULL;
 
+	delete [] m_damageModules;
+	delete [] m_dieModules;
+	delete [] m_upgradeModules;
+	delete [] m_collideModules;
+	delete [] m_specialPowerModules;
+	m_damageModules = NULL;
+	m_dieModules = NULL;
+	m_upgradeModules = NULL;
+	m_collideModules = NULL;
+	m_specialPowerModules = NULL;
+
 	if( m_experienceTracker )
 		m_experienceTracker->deleteInstance();
 
@@ -750,6 +777,60 @@ Int Object::getTransportSlotCount() const
 	return count;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Build the per-interface module lists from the (complete) module array. Each list keeps the
+	* order of m_behaviors, so notifications go out in exactly the order they always did. */
+//-------------------------------------------------------------------------------------------------
+void Object::buildModuleInterfaceLists()
+{
+	Int numDamage = 0, numDie = 0, numUpgrade = 0, numCollide = 0, numSpecialPower = 0;
+	BehaviorModule** b;
+
+	for (b = m_behaviors; *b; ++b)
+	{
+		if ((*b)->getDamage())
+			++numDamage;
+		if ((*b)->getDie())
+			++numDie;
+		if ((*b)->getUpgrade())
+			++numUpgrade;
+		if ((*b)->getCollide())
+			++numCollide;
+		if ((*b)->getSpecialPower())
+			++numSpecialPower;
+	}
+
+	m_damageModules = MSGNEW("ModulePtrs") DamageModuleInterface*[numDamage + 1];
+	m_dieModules = MSGNEW("ModulePtrs") DieModuleInterface*[numDie + 1];
+	m_upgradeModules = MSGNEW("ModulePtrs") UpgradeModuleInterface*[numUpgrade + 1];
+	m_collideModules = MSGNEW("ModulePtrs") CollideModuleInterface*[numCollide + 1];
+	m_specialPowerModules = MSGNEW("ModulePtrs") SpecialPowerModuleInterface*[numSpecialPower + 1];
+
+	DamageModuleInterface** damage = m_damageModules;
+	DieModuleInterface** die = m_dieModules;
+	UpgradeModuleInterface** upgrade = m_upgradeModules;
+	CollideModuleInterface** collide = m_collideModules;
+	SpecialPowerModuleInterface** sp = m_specialPowerModules;
+	for (b = m_behaviors; *b; ++b)
+	{
+		if ((*b)->getDamage())
+			*damage++ = (*b)->getDamage();
+		if ((*b)->getDie())
+			*die++ = (*b)->getDie();
+		if ((*b)->getUpgrade())
+			*upgrade++ = (*b)->getUpgrade();
+		if ((*b)->getCollide())
+			*collide++ = (*b)->getCollide();
+		if ((*b)->getSpecialPower())
+			*sp++ = (*b)->getSpecialPower();
+	}
+	*damage = NULL;
+	*die = NULL;
+	*upgrade = NULL;
+	*collide = NULL;
+	*sp = NULL;
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Run from GameLogic::destroyObject */
 //-------------------------------------------------------------------------------------------------
@@ -800,6 +881,10 @@ void Object::setGeometryInfoZ( Real newZ )
 	// A Z change only does not need to un/register with the PartitionManager
 	m_geometryInfo.setMaxHeightAbovePosition( newZ );
 
+	// the bounding sphere may have changed, so keep the partition's query copy honest
+	if( m_partitionData )
+		m_partitionData->refreshQueryEntries();
+
 	if (m_drawable)
 		m_drawable->reactToGeometryChange();
 }
@@ -811,6 +896,11 @@ void Object::friend_setUndetectedDefector( Bool status )
 		m_privateStatus |= UNDETECTED_DEFECTOR;
 	else
 		m_privateStatus &= ~UNDETECTED_DEFECTOR;
+	markCRCDirty();
+
+	// the partition's query copy caches this for relationship tests
+	if( m_partitionData )
+		m_partitionData->refreshQueryEntries();
 }
 
 //=============================================================================
@@ -878,6 +968,12 @@ void Object::setOrRestoreTeam( Team* team, Bool restoring )
 		
 	// Switch //////////////////////////
 	m_team = team;
+	if (TheScriptEngine)
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
+
+	// the partition's query copy caches the team for player and relationship tests
+	if( m_partitionData )
+		m_partitionData->refreshQueryEntries();
 
 	// After Switch //////////////////////////
 	if (m_team)
@@ -1774,6 +1870,8 @@ void Object::reactToTurretChange( WhichTurretType turret, Real oldRotation, Real
 void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPos, Real oldAngle)
 {
 	//USE_PERF_TIMER(Object_reactToTransformChange)
+	markCRCDirty();
+
 	if(_isnan(getPosition()->x) || _isnan(getPosition()->y) || _isnan(getPosition()->z)) {
 		DEBUG_CRASH(("Object pos is nan."));
 		TheGameLogic->destroyObject(this);
@@ -1786,6 +1884,11 @@ void Object::reactToTransformChange(const Matrix3D* oldMtx, const Coord3D* oldPo
 	Bool posDiff = isPosDifferent(oldPos, getPosition());
 	Bool angDiff = isAngleDifferent(oldAngle, getOrientation());
 
+	// the partition only recomputes cells for real moves, but its per-cell query copy of
+	// our position must always be exact, so write it through every time.
+	if (m_partitionData)
+		m_partitionData->refreshQueryEntries();
+
 	if (posDiff || angDiff)
 	{
 		if (m_partitionData)
@@ -1993,6 +2096,10 @@ void Object::setEffectivelyDead(Bool dead)
 		BitSet(m_privateStatus, EFFECTIVELY_DEAD);
 	else
 		BitClear(m_privateStatus, EFFECTIVELY_DEAD);
+	markCRCDirty();
+
+	if (TheScriptEngine)
+		TheScriptEngine->invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 
 	if (dead)
 	{
@@ -2011,6 +2118,7 @@ void Object::setCaptured(Bool isCaptured)
 		DEBUG_LOG(("Clearing Captured Status. This should never happen. jkmcd"));
 		BitClear(m_privateStatus, CAPTURED);
 	}
+	markCRCDirty();
 
 	// No need to see if we should skip updates, this flag has no effect on skipping updates.
 }
@@ -2368,11 +2476,9 @@ void Object::checkDisabledStatus()
 //-------------------------------------------------------------------------------------------------
 void Object::pauseAllSpecialPowers( const Bool disabling ) const
 { 
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	for (SpecialPowerModuleInterface** m = m_specialPowerModules; *m; ++m)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		sp->pauseCountdown( disabling );// So it will pause if we are disabling.
 	}
@@ -2402,11 +2508,9 @@ void Object::updateTriggerAreaFlags()
 //-------------------------------------------------------------------------------------------------
 void Object::onCollide( Object *other, const Coord3D *loc, const Coord3D *normal )
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	for (CollideModuleInterface** m = m_collideModules; *m; ++m)
 	{
-		CollideModuleInterface* collide = (*m)->getCollide();
-		if (!collide)
-			continue;
+		CollideModuleInterface* collide = *m;
 
 		// check each time thru the loop, in case a collide module sets it
 		if( getStatusBits().test( OBJECT_STATUS_NO_COLLISIONS ) )
@@ -2426,9 +2530,9 @@ void Object::onCollide( Object *other, const Coord3D *loc, const Coord3D *normal
 //-------------------------------------------------------------------------------------------------
 Bool Object::isSalvageCrate() const
 {
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	for( CollideModuleInterface** m = m_collideModules; *m; ++m )
 	{
-		CollideModuleInterface* collide = (*m)->getCollide();
+		CollideModuleInterface* collide = *m;
 		if( collide && collide->isSalvageCrateCollide() )
 		{
 			return true;
@@ -2459,11 +2563,9 @@ void Object::updateUpgradeModules()
 	// We need to add in all of the already owned upgrades to handle "AND" requiring upgrades.
 	// We combine all the masks in case someone has a Object AND Player combination
 
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	for (UpgradeModuleInterface** module = m_upgradeModules; *module; ++module)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = *module;
 
 		if( !upgrade->isAlreadyUpgraded() )
 		{
@@ -2482,11 +2584,9 @@ void Object::updateUpgradeModules()
 //-------------------------------------------------------------------------------------------------
 void Object::forceRefreshSubObjectUpgradeStatus()
 {
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	for (UpgradeModuleInterface** module = m_upgradeModules; *module; ++module)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = *module;
 
 		if( upgrade->isSubObjectsUpgrade() )
 		{
@@ -2845,6 +2945,7 @@ void Object::friend_notifyOfNewMapBoundary(void)
 		m_privateStatus &= ~OFF_MAP;
 	else
 		m_privateStatus |= OFF_MAP;
+	markCRCDirty();
 }
 
 
@@ -3893,6 +3994,45 @@ void Object::onDisabledEdge(Bool becomingDisabled)
 /** Object CRC implemtation */
 //-------------------------------------------------------------------------------------------------
 void Object::crc( Xfer *xfer )
+{
+	crcState( xfer );
+	crcWeapons( xfer );
+}  // end crc
+
+//-------------------------------------------------------------------------------------------------
+/** Same result as crc(), but replays the words crcState() gave last time if nothing it covers
+	* has been changed since.  Everything crcState() reads must call markCRCDirty() when it
+	* changes; -VerifyIncrementalCRC checks this against the full walk. */
+//-------------------------------------------------------------------------------------------------
+void Object::friend_xferIncrementalCRC( XferCRC *xfer )
+{
+	if( m_crcCacheCount < 0 )
+	{
+		xfer->beginCapture( m_crcCache, CRC_CACHE_WORDS );
+		crcState( xfer );
+		m_crcCacheCount = xfer->endCapture();
+		DEBUG_ASSERTCRASH( m_crcCacheCount >= 0, ("Object::friend_xferIncrementalCRC - CRC_CACHE_WORDS is too small") );
+	}
+	else
+	{
+		xfer->addCapturedCRC( m_crcCache, m_crcCacheCount );
+	}
+
+	// each weapon keeps its own cache
+	for (Int i=0; i<WEAPONSLOT_COUNT; ++i)
+	{
+		Weapon *thisWeapon = getWeaponInWeaponSlot((WeaponSlotType)i);
+		if (thisWeapon)
+		{
+			thisWeapon->friend_xferIncrementalCRC( xfer );
+		}
+	}
+
+}  // end friend_xferIncrementalCRC
+
+//-------------------------------------------------------------------------------------------------
+//-------------------------------------------------------------------------------------------------
+void Object::crcState( Xfer *xfer )
 {
 	// This is evil - we cast the const Matrix3D * to a Matrix3D * because the XferCRC class must use
 	// the same interface as the XferLoad class for save game restore.  This only works because
@@ -4014,6 +4154,14 @@ void Object::crc( Xfer *xfer )
 	}
 #endif DEBUG_CRC
 
+}  // end crcState
+
+//-------------------------------------------------------------------------------------------------
+/** The weapons' part of crc(). Weapons cache their words themselves, see friend_xferIncrementalCRC */
+//-------------------------------------------------------------------------------------------------
+void Object::crcWeapons( Xfer *xfer )
+{
+
 	for (Int i=0; i<WEAPONSLOT_COUNT; ++i)
 	{
 		Weapon *thisWeapon = getWeaponInWeaponSlot((WeaponSlotType)i);
@@ -4023,7 +4171,7 @@ void Object::crc( Xfer *xfer )
 		}
 	}
 	
-}  // end crc
+}  // end crcWeapons
 
 //-------------------------------------------------------------------------------------------------
 /** Object xfer implemtation
@@ -4458,6 +4606,12 @@ void Object::loadPostProcess()
 	else
 		m_containedBy = NULL;
 
+	markCRCDirty();
+
+	// our private status was xferred straight in, so the partition's query copy may be stale
+	if( m_partitionData )
+		m_partitionData->refreshQueryEntries();
+
 }  // end loadPostProcess
 
 //-------------------------------------------------------------------------------------------------
@@ -4486,11 +4640,9 @@ Bool Object::affectedByUpgrade( const UpgradeTemplate *upgradeT ) const
 	// We need to add in all of the already owned upgrades to handle "AND" requiring upgrades.
 	// We combine all the masks in case someone has a Object AND Player combination
 
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	for (UpgradeModuleInterface** module = m_upgradeModules; *module; ++module)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = *module;
 
 		if( upgrade->wouldUpgrade( maskToCheck ) )
 		{
@@ -4510,6 +4662,7 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 	if (upgradeT)
 	{
 		m_objectUpgradesCompleted.set( upgradeT->getUpgradeMask() );
+		markCRCDirty();
 
 		//
 		// iterate through all the upgrade modules of this object and call the method to
@@ -4525,11 +4678,10 @@ void Object::giveUpgrade( const UpgradeTemplate *upgradeT )
 void Object::removeUpgrade( const UpgradeTemplate *upgradeT )
 {
 	m_objectUpgradesCompleted.clear( upgradeT->getUpgradeMask() );
-	for (BehaviorModule** module = m_behaviors; *module; ++module)
+	markCRCDirty();
+	for (UpgradeModuleInterface** module = m_upgradeModules; *module; ++module)
 	{
-		UpgradeModuleInterface* upgrade = (*module)->getUpgrade();
-		if (!upgrade)
-			continue;
+		UpgradeModuleInterface* upgrade = *module;
 
 		// Whoa, please note that while the function is called Object::RemoveUpgrade, it is not removing anything
 		// in the sense of undoing the effects.  It is just resetting the upgrade so it may be run again.
@@ -4592,9 +4744,9 @@ void Object::onDie( DamageInfo *damageInfo )
 	Bool selfInflicted = (damageInfo->in.m_sourceID == getID());
 
 	// FIRST, call our die modules.
-	for (BehaviorModule** d = m_behaviors; *d; ++d)
+	for (DieModuleInterface** d = m_dieModules; *d; ++d)
 	{
-		DieModuleInterface* die = (*d)->getDie();
+		DieModuleInterface* die = *d;
 		if (die)
 			die->onDie(damageInfo);
 	}
@@ -4690,6 +4842,7 @@ void Object::setWeaponBonusCondition(WeaponBonusConditionType wst)
 	{
 		// Our weapon bonus just changed, so we need to immediately update our weapons
 		m_weaponSet.weaponSetOnWeaponBonusChange(this);
+		markCRCDirty();
 	}
 }
 
@@ -4703,6 +4856,7 @@ void Object::clearWeaponBonusCondition(WeaponBonusConditionType wst)
 	{
 		// Our weapon bonus just changed, so we need to immediately update our weapons
 		m_weaponSet.weaponSetOnWeaponBonusChange(this);
+		markCRCDirty();
 	}
 }
 
@@ -5329,11 +5483,9 @@ SpecialPowerModuleInterface *Object::getSpecialPowerModule( const SpecialPowerTe
 		return NULL;
 
 	// search the modules for the one with the matching template
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	for( SpecialPowerModuleInterface** m = m_specialPowerModules; *m; ++m )
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		if( sp->isModuleForPower( specialPowerTemplate ) )
 			return sp;
@@ -5881,11 +6033,9 @@ DockUpdateInterface *Object::getDockUpdateInterface( void )
 // ------------------------------------------------------------------------------------------------
 SpecialPowerModuleInterface* Object::findSpecialPowerModuleInterface( SpecialPowerType type ) const
 {
-	for (BehaviorModule** m = m_behaviors; *m; ++m)
+	for (SpecialPowerModuleInterface** m = m_specialPowerModules; *m; ++m)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if (spTemplate && spTemplate->getSpecialPowerType() == type || type == SPECIAL_INVALID )
@@ -5901,11 +6051,9 @@ SpecialPowerModuleInterface* Object::findSpecialPowerModuleInterface( SpecialPow
 // ------------------------------------------------------------------------------------------------
 SpecialPowerModuleInterface* Object::findAnyShortcutSpecialPowerModuleInterface() const
 {
-	for( BehaviorModule** m = m_behaviors; *m; ++m )
+	for( SpecialPowerModuleInterface** m = m_specialPowerModules; *m; ++m )
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		const SpecialPowerTemplate *spTemplate = sp->getSpecialPowerTemplate();
 		if( spTemplate && spTemplate->isShortcutPower() )
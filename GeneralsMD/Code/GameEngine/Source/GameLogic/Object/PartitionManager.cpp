@@ -1140,6 +1140,7 @@ CellAndObjectIntersection::CellAndObjectIntersection()
 	m_module = NULL;
 	m_prevCoi = NULL;
 	m_nextCoi = NULL;
+	m_queryIndex = -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -1204,11 +1205,15 @@ void CellAndObjectIntersection::addCoverage(PartitionCell *cell, PartitionData *
 		return;
 	}
 
-	if (m_cell == NULL)
-		cell->friend_addToCellList(this);
+	Bool isNew = (m_cell == NULL);
 
 	m_cell = cell;
 	m_module = module;
+
+	if (isNew)
+		cell->friend_addToCellList(this);
+	else
+		cell->friend_refreshQueryEntry(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -1467,6 +1472,46 @@ void PartitionCell::removeCashValue( Int playerIndex, UnsignedInt cashValue )
 	}
 }
 
+//-----------------------------------------------------------------------------
+void PartitionCell::setQueryEntry(Int i, const PartitionData *module)
+{
+	const Object *obj = module->getObject();
+	if (obj)
+	{
+		const GeometryInfo& geom = obj->getGeometryInfo();
+		m_queryPosX[i] = obj->getPosition()->x;
+		m_queryPosY[i] = obj->getPosition()->y;
+		m_queryRadius[i] = maxReal(geom.getBoundingCircleRadius(), geom.getBoundingSphereRadius());
+		m_queryKindOf[i] = obj->getTemplate()->getKindOfMask();
+		m_queryTeam[i] = obj->getTeam();
+		m_queryDefector[i] = obj->getIsUndetectedDefector() ? 1 : 0;
+	}
+	else
+	{
+		// ghost-only modules are never returned by queries, so the values don't matter.
+		m_queryPosX[i] = 0.0f;
+		m_queryPosY[i] = 0.0f;
+		m_queryRadius[i] = 0.0f;
+		m_queryKindOf[i] = KINDOFMASK_NONE;
+		m_queryTeam[i] = NULL;
+		m_queryDefector[i] = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void PartitionCell::moveQueryEntry(Int dst, Int src)
+{
+	m_queryCoi[dst] = m_queryCoi[src];
+	m_queryModule[dst] = m_queryModule[src];
+	m_queryPosX[dst] = m_queryPosX[src];
+	m_queryPosY[dst] = m_queryPosY[src];
+	m_queryRadius[dst] = m_queryRadius[src];
+	m_queryKindOf[dst] = m_queryKindOf[src];
+	m_queryTeam[dst] = m_queryTeam[src];
+	m_queryDefector[dst] = m_queryDefector[src];
+	m_queryCoi[dst]->friend_setQueryIndex(dst);
+}
+
 //-----------------------------------------------------------------------------
 void PartitionCell::friend_addToCellList(CellAndObjectIntersection *coi)
 {
@@ -1474,6 +1519,18 @@ void PartitionCell::friend_addToCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_addToCellList(&m_firstCoiInCell);
 		++m_coiCount;
+
+		Int i = m_queryCoi.size();
+		m_queryCoi.push_back(coi);
+		m_queryModule.push_back(coi->getModule());
+		m_queryPosX.push_back(0.0f);
+		m_queryPosY.push_back(0.0f);
+		m_queryRadius.push_back(0.0f);
+		m_queryKindOf.push_back(KINDOFMASK_NONE);
+		m_queryTeam.push_back(NULL);
+		m_queryDefector.push_back(0);
+		coi->friend_setQueryIndex(i);
+		setQueryEntry(i, coi->getModule());
 	}
 }
 
@@ -1484,9 +1541,34 @@ void PartitionCell::friend_removeFromCellList(CellAndObjectIntersection *coi)
 	{
 		coi->friend_removeFromCellList(&m_firstCoiInCell);
 		--m_coiCount;
+
+		// fill the hole with the last entry, so removal doesn't shift the whole array.
+		Int i = coi->friend_getQueryIndex();
+		DEBUG_ASSERTCRASH(i >= 0 && i < (Int)m_queryCoi.size() && m_queryCoi[i] == coi, ("query index mismatch"));
+		Int last = m_queryCoi.size() - 1;
+		if (i != last)
+			moveQueryEntry(i, last);
+		m_queryCoi.pop_back();
+		m_queryModule.pop_back();
+		m_queryPosX.pop_back();
+		m_queryPosY.pop_back();
+		m_queryRadius.pop_back();
+		m_queryKindOf.pop_back();
+		m_queryTeam.pop_back();
+		m_queryDefector.pop_back();
+		coi->friend_setQueryIndex(-1);
 	}
 }
 
+//-----------------------------------------------------------------------------
+void PartitionCell::friend_refreshQueryEntry(CellAndObjectIntersection *coi)
+{
+	Int i = coi->friend_getQueryIndex();
+	DEBUG_ASSERTCRASH(i >= 0 && i < (Int)m_queryCoi.size() && m_queryCoi[i] == coi, ("query index mismatch"));
+	m_queryModule[i] = coi->getModule();
+	setQueryEntry(i, coi->getModule());
+}
+
 //-----------------------------------------------------------------------------
 void PartitionCell::getCellCenterPos(Real& x, Real& y)
 {
@@ -1562,7 +1644,8 @@ PartitionData::PartitionData()
 	m_coiArrayCount = 0;
 	m_coiArray = NULL;
 	m_coiInUseCount = 0;
-	m_doneFlag = 0;
+	for (Int slot = 0; slot < WorkerThreadPool::MAX_THREAD_SLOTS; ++slot)
+		m_doneFlag[slot] = 0;
 	m_dirtyStatus = NOT_DIRTY;
 	m_lastCell = NULL;
 	for (int i = 0; i < MAX_PLAYER_COUNT; ++i)
@@ -2201,6 +2284,17 @@ theObjName = obj->getTemplate()->getName();
 	return calcMaxCoiForShape(geom, majorRadius, minorRadius, isSmall);
 }
 
+//-----------------------------------------------------------------------------
+void PartitionData::refreshQueryEntries()
+{
+	CellAndObjectIntersection *coi = m_coiArray;
+	for (Int i = m_coiInUseCount; i > 0; --i, ++coi)
+	{
+		if (coi->getCell())
+			coi->getCell()->friend_refreshQueryEntry(coi);
+	}
+}
+
 //-----------------------------------------------------------------------------
 void PartitionData::makeDirty(Bool needToUpdateCells)
 {
@@ -2591,11 +2685,28 @@ static void calcHeights(const Region3D& world, Real cellSize, Int x, Int y, Real
 	Real step = cellSize / numSteps;
 	loZ = HUGE_DIST;		// huge positive
 	hiZ = -HUGE_DIST;		// huge negative
+
+	// gather a row of sample points at a time and fetch their heights in one batch.
+	static std::vector<Coord2D> rowPts;
+	static std::vector<Real> rowHeights;
 	for (Real yy = 0; yy <= cellSize; yy += step) 
 	{
+		rowPts.clear();
 		for (Real xx = 0; xx <= cellSize; xx += step) 
 		{
-			Real h = TheTerrainLogic->getGroundHeight( xbase + xx, ybase + yy );
+			Coord2D pt;
+			pt.x = xbase + xx;
+			pt.y = ybase + yy;
+			rowPts.push_back(pt);
+		}
+		if (rowPts.empty())
+			continue;
+
+		rowHeights.resize(rowPts.size());
+		TheTerrainLogic->getGroundHeights((Int)rowPts.size(), &rowPts[0], &rowHeights[0], NULL);
+		for (UnsignedInt i = 0; i < rowHeights.size(); ++i)
+		{
+			Real h = rowHeights[i];
 			if (h < loZ) loZ = h;
 			if (h > hiZ) hiZ = h;
 		}
@@ -3238,10 +3349,14 @@ Object *PartitionManager::getClosestObjects(
 	GetPrecisionTimer(&startTime64);
 #endif
 	
+	// phase-parallel updates may search from several threads at once, so each thread
+	// gets its own done flags
+	const Int slot = WorkerThreadPool::getThreadSlot();
+
 #ifdef _DEBUG
-	static Int theEntrancyCount = 0;
-	DEBUG_ASSERTCRASH(theEntrancyCount == 0, ("sorry, this routine is not reentrant"));
-	++theEntrancyCount;
+	static Int theEntrancyCount[WorkerThreadPool::MAX_THREAD_SLOTS] = { 0 };
+	DEBUG_ASSERTCRASH(theEntrancyCount[slot] == 0, ("sorry, this routine is not reentrant"));
+	++theEntrancyCount[slot];
 #endif
 
 	DEBUG_ASSERTCRASH((obj==NULL) != (pos == NULL), ("either obj or pos must be null"));
@@ -3288,8 +3403,33 @@ Object *PartitionManager::getClosestObjects(
 
 	Bool foundAny = false;
 
-	static Int theIterFlag = 1;	// nonzero, thanks
-	++theIterFlag;
+	static Int theIterFlags[WorkerThreadPool::MAX_THREAD_SLOTS] = { 1 };	// nonzero, thanks
+	Int theIterFlag = ++theIterFlags[slot];
+
+	/*
+		Before touching a COI's module or Object, we reject it against the cell's compact
+		query arrays using the 2d center distance, which is never larger than what distProc 
+		measures. For the boundary modes we widen the reach by both radii (the stored radius
+		is the larger of circle and sphere), and we pad a little for roundoff, so this can 
+		only discard objects that distProc would discard anyway. Skipping the done flag for 
+		those is fine too: closestDistSqr never grows, so they'd be rejected again in any 
+		other cell.
+
+		After that we reject on whatever kindof, player and relationship tests the filters 
+		could hand us. Those only demand what the filters' allow() would demand anyway, and 
+		they give the same answer in every cell, so the done flag can be skipped for them too.
+	*/
+	const Bool useRadius = (dc == FROM_BOUNDINGSPHERE_2D || dc == FROM_BOUNDINGSPHERE_3D);
+	const Real QUERY_REACH_SLOP = 1.0f;
+	Real objRadius = 0.0f;
+	if (useRadius && objToUse)
+		objRadius = maxReal(objToUse->getGeometryInfo().getBoundingCircleRadius(), objToUse->getGeometryInfo().getBoundingSphereRadius());
+	Real queryReach = sqrtf(closestDistSqr) + objRadius + QUERY_REACH_SLOP;
+
+	PartitionQueryPrefilter prefilter;
+	for (PartitionFilter **fp = filters; fp && *fp; fp++)
+		(*fp)->addToPrefilter(prefilter);
+	const Bool usePrefilter = prefilter.hasTests();
 
 	/*
 		m_radiusVec[curRadius] contains a list of the cells (foo) that could
@@ -3303,12 +3443,28 @@ Object *PartitionManager::getClosestObjects(
     for (OffsetVec::const_iterator it = offsets.begin(); it != offsets.end(); ++it)
 		{
 			PartitionCell* thisCell = getCellAt(cellCenterX + it->x, cellCenterY + it->y);
-			if (thisCell == NULL)
+			if (thisCell == NULL || thisCell->getCoiCount() == 0)
 				continue;
 
-			for (CellAndObjectIntersection *thisCoi = thisCell->getFirstCoiInCell(); thisCoi; thisCoi = thisCoi->getNextCoi())
+			PartitionData* const* cellMods = thisCell->getQueryModules();
+			const Real* cellX = thisCell->getQueryPosX();
+			const Real* cellY = thisCell->getQueryPosY();
+			const Real* cellRadius = thisCell->getQueryRadius();
+			const KindOfMaskType* cellKindOf = thisCell->getQueryKindOf();
+			const Team* const* cellTeam = thisCell->getQueryTeams();
+			const UnsignedByte* cellDefector = thisCell->getQueryDefector();
+
+			// walk back-to-front. (the order only matters for ties, and it's the same on every machine.)
+			for (Int i = thisCell->getCoiCount() - 1; i >= 0; --i)
 			{
-				PartitionData *thisMod = thisCoi->getModule();
+				Real reach = useRadius ? (queryReach + cellRadius[i]) : queryReach;
+				if (sqr(cellX[i] - objPos->x) + sqr(cellY[i] - objPos->y) > sqr(reach))
+					continue;
+
+				if (usePrefilter && !prefilter.allowEntry(cellKindOf[i], cellTeam[i], cellDefector[i] != 0))
+					continue;
+
+				PartitionData *thisMod = cellMods[i];
 				Object *thisObj = thisMod->getObject();
 
 				// never compare against ourself.
@@ -3317,9 +3473,9 @@ Object *PartitionManager::getClosestObjects(
 
 				// since an object can exist in multiple COIs, we use this to avoid processing
 				// the same one more than once.
-				if (thisMod->friend_getDoneFlag() == theIterFlag)
+				if (thisMod->friend_getDoneFlag(slot) == theIterFlag)
 					continue;
-				thisMod->friend_setDoneFlag(theIterFlag);
+				thisMod->friend_setDoneFlag(slot, theIterFlag);
 			
 				Real thisDistSqr;
 				Coord3D distVec;
@@ -3343,6 +3499,7 @@ Object *PartitionManager::getClosestObjects(
 					closestObj = thisObj;
 					closestDistSqr = thisDistSqr;
 					closestVec = distVec;
+					queryReach = sqrtf(closestDistSqr) + objRadius + QUERY_REACH_SLOP;
 
 					if (!foundAny)
 					{
@@ -3371,8 +3528,8 @@ Object *PartitionManager::getClosestObjects(
 
 	Bool foundAny = false;
 
-	static Int theIterFlag = 1;	// nonzero, thanks
-	++theIterFlag;
+	static Int theIterFlags[WorkerThreadPool::MAX_THREAD_SLOTS] = { 1 };	// nonzero, thanks
+	Int theIterFlag = ++theIterFlags[slot];
 
 	PartitionCell *thisCell;
 	while ((thisCell = iter.nextNonEmpty()) != NULL)
@@ -3390,10 +3547,10 @@ Object *PartitionManager::getClosestObjects(
 			if (thisObj == obj) 
 				continue;
 
-			if (thisMod->friend_getDoneFlag() == theIterFlag)
+			if (thisMod->friend_getDoneFlag(slot) == theIterFlag)
 				continue;
 
-			thisMod->friend_setDoneFlag(theIterFlag);
+			thisMod->friend_setDoneFlag(slot, theIterFlag);
 		
 			// hmm, ok, calc the distance.
 			Real thisDistSqr;
@@ -3442,7 +3599,7 @@ Object *PartitionManager::getClosestObjects(
 	}
 
 #ifdef _DEBUG
-	--theEntrancyCount;
+	--theEntrancyCount[slot];
 #endif
 #ifdef DUMP_PERF_STATS
 	Int64 endTime64;
@@ -4924,6 +5081,107 @@ void PartitionManager::restoreFoggedCells(const ShroudStatusStoreRestore &inPart
 }
 
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+PartitionQueryPrefilter::PartitionQueryPrefilter() :
+	m_kindOfMustBeSet(KINDOFMASK_NONE),
+	m_kindOfMustBeClear(KINDOFMASK_NONE),
+	m_player(NULL),
+	m_relationshipTeam(NULL),
+	m_relationshipFlags(0),
+	m_testKindOf(false),
+	m_testPlayer(false),
+	m_playerMatch(false),
+	m_testRelationship(false),
+	m_relationshipNeutralOnly(false),
+	m_lastTeam(NULL),
+	m_lastTeamValid(false),
+	m_lastTeamPlayerOK(false),
+	m_lastTeamRelationship(NEUTRAL)
+{
+}
+
+//-----------------------------------------------------------------------------
+void PartitionQueryPrefilter::addKindOf(const KindOfMaskType& mustBeSet, const KindOfMaskType& mustBeClear)
+{
+	// the filters are ANDed, so the masks just accumulate.
+	m_kindOfMustBeSet.set(mustBeSet);
+	m_kindOfMustBeClear.set(mustBeClear);
+	m_testKindOf = true;
+}
+
+//-----------------------------------------------------------------------------
+void PartitionQueryPrefilter::addPlayer(const Player *player, Bool match)
+{
+	// we only keep the first one; any others are still checked by their allow().
+	if (m_testPlayer)
+		return;
+
+	m_player = player;
+	m_playerMatch = match;
+	m_testPlayer = true;
+}
+
+//-----------------------------------------------------------------------------
+void PartitionQueryPrefilter::addRelationship(const Object *obj, Int allowFlags)
+{
+	// we only keep the first one; any others are still checked by their allow().
+	if (m_testRelationship)
+		return;
+
+	// this mirrors Object::getRelationship(), with the parts that depend on obj worked out up front.
+	m_relationshipTeam = obj->getTeam();
+	m_relationshipNeutralOnly = (m_relationshipTeam == NULL || obj->getIsUndetectedDefector());
+	m_relationshipFlags = allowFlags;
+	m_testRelationship = true;
+}
+
+//-----------------------------------------------------------------------------
+Bool PartitionQueryPrefilter::allowEntry(const KindOfMaskType& kindOf, const Team *team, Bool undetectedDefector)
+{
+	if (m_testKindOf && !TEST_KINDOFMASK_MULTI(kindOf, m_kindOfMustBeSet, m_kindOfMustBeClear))
+		return false;
+
+	const Bool needTeamRelationship = m_testRelationship && !m_relationshipNeutralOnly;
+	if (m_testPlayer || needTeamRelationship)
+	{
+		if (!m_lastTeamValid || team != m_lastTeam)
+		{
+			m_lastTeam = team;
+			m_lastTeamValid = true;
+			if (m_testPlayer)
+			{
+				const Player *player = team ? team->getControllingPlayer() : NULL;
+				m_lastTeamPlayerOK = ((player == m_player) == m_playerMatch);
+			}
+			if (needTeamRelationship)
+				m_lastTeamRelationship = m_relationshipTeam->getRelationship(team);
+		}
+
+		if (m_testPlayer && !m_lastTeamPlayerOK)
+			return false;
+	}
+
+	if (m_testRelationship)
+	{
+		Relationship r;
+		if (m_relationshipNeutralOnly)
+			r = NEUTRAL;
+		else if (undetectedDefector)
+			r = ALLIES;
+		else
+			r = m_lastTeamRelationship;
+
+		if ((m_relationshipFlags & (1<<r)) == 0)
+			return false;
+	}
+
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
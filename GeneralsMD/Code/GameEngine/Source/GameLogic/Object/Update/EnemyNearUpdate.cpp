@@ -44,6 +44,7 @@
 #include "Common/ThingTemplate.h"
 #include "Common/Xfer.h"
 #include "GameClient/Drawable.h"
+#include "GameLogic/GameLogic.h"
 #include "GameLogic/Module/EnemyNearUpdate.h"
 #include "GameLogic/Object.h"
 #include "GameLogic/AI.h"
@@ -55,7 +56,9 @@
 //-------------------------------------------------------------------------------------------------
 EnemyNearUpdate::EnemyNearUpdate( Thing *thing, const ModuleData* moduleData ) : UpdateModule( thing, moduleData ),
 	m_enemyNear(false),
-	m_enemyScanDelay(0)
+	m_enemyScanDelay(0),
+	m_gatheredFrame(0xffffffff),
+	m_gatheredEnemyNear(false)
 {
 	// bias a random amount so everyone doesn't spike at once
 	m_enemyScanDelay += GameLogicRandomValue(0, getEnemyNearUpdateModuleData()->m_enemyScanDelayTime);
@@ -79,9 +82,16 @@ void EnemyNearUpdate::checkForEnemies( void )
 	{
 		m_enemyScanDelay = getEnemyNearUpdateModuleData()->m_enemyScanDelayTime;
 
-		Real visionRange = getObject()->getVisionRange();
-		Object* enemy = TheAI->findClosestEnemy( getObject(), visionRange, AI::CAN_SEE );
-		m_enemyNear = (enemy != NULL);
+		if (m_gatheredFrame == TheGameLogic->getFrame())
+		{
+			m_enemyNear = m_gatheredEnemyNear;
+		}
+		else
+		{
+			Real visionRange = getObject()->getVisionRange();
+			Object* enemy = TheAI->findClosestEnemy( getObject(), visionRange, AI::CAN_SEE );
+			m_enemyNear = (enemy != NULL);
+		}
 	}
 	else
 	{
@@ -89,6 +99,22 @@ void EnemyNearUpdate::checkForEnemies( void )
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** 
+ * Do the expensive scan ahead of time, possibly on a worker thread. Only touches our own
+ * members; update() picks up the result.
+ */
+void EnemyNearUpdate::gatherPhaseParallel()
+{
+	if (m_enemyScanDelay != 0)
+		return;
+
+	Real visionRange = getObject()->getVisionRange();
+	Object* enemy = TheAI->findClosestEnemy( getObject(), visionRange, AI::CAN_SEE );
+	m_gatheredEnemyNear = (enemy != NULL);
+	m_gatheredFrame = TheGameLogic->getFrame();
+}
+
 //-------------------------------------------------------------------------------------------------
 ///< Sit around until an enemy gets near.
 //-------------------------------------------------------------------------------------------------
@@ -176,11 +176,9 @@ Object* PilotFindVehicleUpdate::scanClosestTarget()
 			continue;
 		}
 		// first, see if we'd like to collide with 'other'
-		for (BehaviorModule** m = me->getBehaviorModules(); *m; ++m)
+		for (CollideModuleInterface** m = me->getCollideModules(); *m; ++m)
 		{
-			CollideModuleInterface* collide = (*m)->getCollide();
-			if (!collide)
-				continue;
+			CollideModuleInterface* collide = *m;
 
 			if( collide->wouldLikeToCollideWith( other ) )
 			{
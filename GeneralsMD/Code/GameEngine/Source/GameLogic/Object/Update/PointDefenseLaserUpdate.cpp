@@ -92,6 +92,9 @@ PointDefenseLaserUpdate::PointDefenseLaserUpdate( Thing *thing, const ModuleData
 	m_nextScanFrames = 0;
 	m_nextShotAvailableInFrames = 0;
 	m_inRange  					= false;
+	m_gatheredFrame			= 0xffffffff;
+	m_gatheredTargetID	= INVALID_ID;
+	m_gatheredInRange		= false;
 	setWakeFrame(getObject(), UPDATE_SLEEP_NONE);// No starting sleep, but we want to sleep later.
 } 
 
@@ -155,8 +158,21 @@ UpdateSleepTime PointDefenseLaserUpdate::update()
 	}
 	m_nextScanFrames = data->m_scanFrames;
 
-	//Periodic scanning (expensive)
-	if( scanClosestTarget() )
+	//Periodic scanning (expensive), unless it was already done for this frame in gatherPhaseParallel()
+	Object *target;
+	if( m_gatheredFrame == TheGameLogic->getFrame() )
+	{
+		m_gatheredFrame = 0xffffffff;
+		target = TheGameLogic->findObjectByID( m_gatheredTargetID );
+		m_bestTargetID = target ? m_gatheredTargetID : INVALID_ID;
+		m_inRange = target ? m_gatheredInRange : false;
+	}
+	else
+	{
+		target = scanClosestTarget();
+	}
+
+	if( target )
 	{
 		//1 frame can make a big difference so fire ASAP!
 		fireWhenReady();
@@ -247,11 +263,37 @@ void PointDefenseLaserUpdate::fireWhenReady()
 
 }
 
+//-------------------------------------------------------------------------------------------------
+/** 
+ * Do the periodic scan ahead of time, possibly on a worker thread. Only touches our own
+ * members; update() picks up the result.
+ */
+//-------------------------------------------------------------------------------------------------
+void PointDefenseLaserUpdate::gatherPhaseParallel()
+{
+	if( m_nextScanFrames > 0 || getObject()->isEffectivelyDead() )
+		return;
+
+	Object *target = findClosestTarget( &m_gatheredInRange );
+	m_gatheredTargetID = target ? target->getID() : INVALID_ID;
+	m_gatheredFrame = TheGameLogic->getFrame();
+}
+
 //-------------------------------------------------------------------------------------------------
 Object* PointDefenseLaserUpdate::scanClosestTarget()
+{
+	Object *target = findClosestTarget( &m_inRange );
+	m_bestTargetID = target ? target->getID() : INVALID_ID;
+	return target;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Find the best target in scan range without changing any state. */
+//-------------------------------------------------------------------------------------------------
+Object* PointDefenseLaserUpdate::findClosestTarget( Bool *inRange ) const
 {
 	const PointDefenseLaserUpdateModuleData *data = getPointDefenseLaserUpdateModuleData();
-	Object *me = getObject();
+	const Object *me = getObject();
 	Object *bestTargetOutOfRange[2] = { NULL, NULL };
 	Object *bestTargetInRange[2] = { NULL, NULL };
 	Real closestDist[2];
@@ -343,38 +385,33 @@ Object* PointDefenseLaserUpdate::scanClosestTarget()
 	if( bestTargetInRange[ 0 ] )
 	{
 		//This is the best primary target in range.
-		m_bestTargetID = bestTargetInRange[ 0 ]->getID();
-		m_inRange = true;
+		*inRange = true;
 		return bestTargetInRange[ 0 ];
 	}
 
 	if( bestTargetInRange[ 1 ] )
 	{
 		//This is the best secondary target in range.
-		m_bestTargetID = bestTargetInRange[ 1 ]->getID();
-		m_inRange = true;
+		*inRange = true;
 		return bestTargetInRange[ 1 ];
 	}
 
 	if( bestTargetOutOfRange[ 0 ] )
 	{
 		//This is the best primary target out of range.
-		m_bestTargetID = bestTargetOutOfRange[ 0 ]->getID();
-		m_inRange = false;
+		*inRange = false;
 		return bestTargetOutOfRange[ 0 ];
 	}
 
 	if( bestTargetOutOfRange[ 1 ] )
 	{
 		//This is the best secondary target out of range.
-		m_bestTargetID = bestTargetOutOfRange[ 1 ]->getID();
-		m_inRange = false;
+		*inRange = false;
 		return bestTargetOutOfRange[ 1 ];
 	}
 	
 	//Utter failure -- nothing on the scope.
-	m_bestTargetID = INVALID_ID;
-	m_inRange = false;
+	*inRange = false;
 	return NULL;
 }
 
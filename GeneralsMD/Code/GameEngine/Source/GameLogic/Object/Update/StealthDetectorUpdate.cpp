@@ -52,6 +52,7 @@
 #include "GameClient/InGameUI.h"
 #include "GameClient/ParticleSys.h"
 #include "GameLogic/Damage.h"
+#include "GameLogic/GameLogic.h"
 #include "GameLogic/Object.h"
 #include "GameLogic/PartitionManager.h"
 #include "GameLogic/Module/ContainModule.h"
@@ -99,6 +100,7 @@ StealthDetectorUpdate::StealthDetectorUpdate( Thing *thing, const ModuleData* mo
 {
 	const StealthDetectorUpdateModuleData *data = getStealthDetectorUpdateModuleData();
 	m_enabled = !data->m_initiallyDisabled;
+	m_gatheredFrame = 0xffffffff;
 	// start these guys with random phasings so that we don't
 	// have all of 'em check on the same frame.
 	setWakeFrame(getObject(), m_enabled ? UPDATE_SLEEP(GameLogicRandomValue(1, data->m_updateRate)) : UPDATE_SLEEP_FOREVER);
@@ -152,55 +154,48 @@ Bool PartitionFilterStealthedOrStealthGarrisoned::allow( Object *objOther)
 }
 
 //-------------------------------------------------------------------------------------------------
-/** The update callback. */
+/** Is our container (if any) one we're allowed to detect from? */
 //-------------------------------------------------------------------------------------------------
-UpdateSleepTime StealthDetectorUpdate::update( void )
+Bool StealthDetectorUpdate::canDetectFromContainer() const
 {
 	const StealthDetectorUpdateModuleData *data = getStealthDetectorUpdateModuleData();
-	Object* self = getObject();
-
-	if (self->isEffectivelyDead())
-		return UPDATE_SLEEP_FOREVER; 
-	
-	// We have to wait until we are fully constructed, but we will detect the moment we finish
-	if( self->testStatus(OBJECT_STATUS_UNDER_CONSTRUCTION) )
-		return UPDATE_SLEEP_NONE;
-
-	// We turn off forever the moment we are sold.
-	if( self->testStatus(OBJECT_STATUS_SOLD) )
-		return UPDATE_SLEEP_FOREVER;
 
 	//Are we contained by anything?
-	Object *containedBy = self->getContainedBy();
+	const Object *containedBy = getObject()->getContainedBy();
 	if( containedBy )
 	{
 		ContainModuleInterface *contain = containedBy->getContain();
 		if( contain )
 		{
-			//Are we eligible to detect stealth while in a container?
 			if( contain->isGarrisonable() )
 			{
-				//We are in a garrisonable structure.
-				if( !data->m_canDetectWhileGarrisoned )
-				{
-					//But we can't detect stuff while inside.
-					return UPDATE_SLEEP(data->m_updateRate);
-				}
-			}
-			else if( !data->m_canDetectWhileTransported )
-			{
-				//We are in a normal container and can't detect!
-				return UPDATE_SLEEP(data->m_updateRate);	
+				//We are in a garrisonable structure, but we might not be able to detect stuff while inside.
+				return data->m_canDetectWhileGarrisoned;
 			}
+			//We are in a normal container.
+			return data->m_canDetectWhileTransported;
 		}
 	}
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Collect everything in detection range that is stealthed or hides stealthed riders, without
+	* changing any state. */
+//-------------------------------------------------------------------------------------------------
+void StealthDetectorUpdate::findStealthed( std::vector<ObjectID>& found ) const
+{
+	const StealthDetectorUpdateModuleData *data = getStealthDetectorUpdateModuleData();
+	const Object* self = getObject();
+
+	found.clear();
 
 	// only consider items that are currently stealthed.
 	PartitionFilterStealthedOrStealthGarrisoned		filterStealthOrStealthGarrisoned;
 	//PartitionFilterAcceptByObjectStatus		filterStatus(OBJECT_STATUS_STEALTHED, 0);
 	PartitionFilterRelationship						filterTeam(self, PartitionFilterRelationship::ALLOW_ENEMIES | PartitionFilterRelationship::ALLOW_NEUTRAL );
 	PartitionFilterAcceptByKindOf					filterKindof(data->m_extraDetectKindof, data->m_extraDetectKindofNot);
-	PartitionFilterSameMapStatus					filterMapStatus(getObject());
+	PartitionFilterSameMapStatus					filterMapStatus(self);
 	PartitionFilter*											filters[] = { &filterStealthOrStealthGarrisoned, &filterTeam, &filterKindof, &filterMapStatus, NULL };
 
 	Real visionRange = self->getVisionRange();
@@ -208,14 +203,68 @@ UpdateSleepTime StealthDetectorUpdate::update( void )
 	{
 		visionRange = data->m_detectionRange;
 	}
-	Bool foundSomeone = FALSE;
 
 	SimpleObjectIterator *iter = ThePartitionManager->iterateObjectsInRange(
 								self, visionRange, FROM_CENTER_2D, filters); 
 	MemoryPoolObjectHolder hold(iter);
 	for (Object *them = iter->first(); them; them = iter->next())
 	{
-		if ( them->isEffectivelyDead() )
+		if ( !them->isEffectivelyDead() )
+			found.push_back( them->getID() );
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** 
+ * Do the range scan ahead of time, possibly on a worker thread. Only touches our own
+ * members; update() picks up the result.
+ */
+//-------------------------------------------------------------------------------------------------
+void StealthDetectorUpdate::gatherPhaseParallel()
+{
+	const Object* self = getObject();
+	if( self->isEffectivelyDead() || self->testStatus(OBJECT_STATUS_UNDER_CONSTRUCTION) || 
+			self->testStatus(OBJECT_STATUS_SOLD) || !canDetectFromContainer() )
+		return;
+
+	findStealthed( m_stealthed );
+	m_gatheredFrame = TheGameLogic->getFrame();
+}
+
+//-------------------------------------------------------------------------------------------------
+/** The update callback. */
+//-------------------------------------------------------------------------------------------------
+UpdateSleepTime StealthDetectorUpdate::update( void )
+{
+	const StealthDetectorUpdateModuleData *data = getStealthDetectorUpdateModuleData();
+	Object* self = getObject();
+
+	if (self->isEffectivelyDead())
+		return UPDATE_SLEEP_FOREVER; 
+	
+	// We have to wait until we are fully constructed, but we will detect the moment we finish
+	if( self->testStatus(OBJECT_STATUS_UNDER_CONSTRUCTION) )
+		return UPDATE_SLEEP_NONE;
+
+	// We turn off forever the moment we are sold.
+	if( self->testStatus(OBJECT_STATUS_SOLD) )
+		return UPDATE_SLEEP_FOREVER;
+
+	//Are we eligible to detect stealth while in a container?
+	if( !canDetectFromContainer() )
+		return UPDATE_SLEEP(data->m_updateRate);
+
+	// scan now, unless it was already done for this frame in gatherPhaseParallel()
+	if( m_gatheredFrame != TheGameLogic->getFrame() )
+		findStealthed( m_stealthed );
+	m_gatheredFrame = 0xffffffff;
+
+	Bool foundSomeone = FALSE;
+
+	for( std::vector<ObjectID>::const_iterator idIt = m_stealthed.begin(); idIt != m_stealthed.end(); ++idIt )
+	{
+		Object *them = TheGameLogic->findObjectByID( *idIt );
+		if ( them == NULL || them->isEffectivelyDead() )
 			continue;
 
 		StealthUpdate* stealth = them->getStealth();
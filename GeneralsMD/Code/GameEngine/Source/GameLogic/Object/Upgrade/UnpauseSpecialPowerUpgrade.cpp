@@ -92,11 +92,9 @@ UnpauseSpecialPowerUpgrade::~UnpauseSpecialPowerUpgrade( void )
 //-------------------------------------------------------------------------------------------------
 void UnpauseSpecialPowerUpgrade::upgradeImplementation( void )
 {
-	for (BehaviorModule** m = getObject()->getBehaviorModules(); *m; ++m)
+	for (SpecialPowerModuleInterface** m = getObject()->getSpecialPowerModules(); *m; ++m)
 	{
-		SpecialPowerModuleInterface* sp = (*m)->getSpecialPower();
-		if (!sp)
-			continue;
+		SpecialPowerModuleInterface* sp = *m;
 
 		if( sp->getSpecialPowerTemplate() == getUnpauseSpecialPowerUpgradeModuleData()->m_specialPower )
 			sp->pauseCountdown( FALSE );
@@ -58,6 +58,7 @@
 #include "Common/ThingFactory.h"
 #include "Common/ThingTemplate.h"
 #include "Common/Xfer.h"
+#include "Common/XferCRC.h"
  
 #include "GameClient/Drawable.h"
 #include "GameClient/FXList.h"
@@ -1518,6 +1519,8 @@ void WeaponTemplate::dealDamageInternal(ObjectID sourceID, ObjectID victimID, co
 //-------------------------------------------------------------------------------------------------
 WeaponStore::WeaponStore()
 {
+	m_weaponDDIPending = 0;
+	m_weaponDDINextFrame = 0;
 } 
 
 //-------------------------------------------------------------------------------------------------
@@ -1532,6 +1535,7 @@ WeaponStore::~WeaponStore()
 			wt->deleteInstance();
 	}
 	m_weaponTemplateVector.clear();
+	m_weaponTemplateIndex.clear();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1569,22 +1573,20 @@ void WeaponStore::createAndFireTempWeapon(const WeaponTemplate* wt, const Object
 //-------------------------------------------------------------------------------------------------
 const WeaponTemplate *WeaponStore::findWeaponTemplate( AsciiString name ) const 
 { 
-	if (stricmp(name.str(), "None") == 0)
+	static const NameKeyType key_None = NAMEKEY("None");
+	NameKeyType key = TheNameKeyGenerator->nameToKey( name );
+	if (key == key_None)
 		return NULL;
-	const WeaponTemplate * wt = findWeaponTemplatePrivate( TheNameKeyGenerator->nameToKey( name ) );
-	DEBUG_ASSERTCRASH(wt != NULL, ("Weapon %s not found!\n",name.str()));
+	const WeaponTemplate * wt = findWeaponTemplatePrivate( key );
+	// other spellings of "None" just aren't found, which is the same answer
+	DEBUG_ASSERTCRASH(wt != NULL || stricmp(name.str(), "None") == 0, ("Weapon %s not found!\n",name.str()));
 	return wt;
 }
 
 //-------------------------------------------------------------------------------------------------
 WeaponTemplate *WeaponStore::findWeaponTemplatePrivate( NameKeyType key ) const
 {
-	// search weapon list for name
-	for (Int i = 0; i < m_weaponTemplateVector.size(); i++)
-		if( m_weaponTemplateVector[ i ]->getNameKey() == key )
-			return m_weaponTemplateVector[i];
-
-	return NULL;
+	return m_weaponTemplateIndex.find( key );
 
 }
 
@@ -1601,6 +1603,7 @@ WeaponTemplate *WeaponStore::newWeaponTemplate(AsciiString name)
 	wt->m_name = name;
 	wt->m_nameKey = TheNameKeyGenerator->nameToKey( name );
 	m_weaponTemplateVector.push_back(wt);
+	m_weaponTemplateIndex.add(wt->m_nameKey, wt);
 
 	return wt;
 } 
@@ -1622,27 +1625,68 @@ WeaponTemplate *WeaponStore::newOverride(WeaponTemplate *weaponTemplate)
 //-------------------------------------------------------------------------------------------------
 void WeaponStore::update()
 {
-	for (std::list<WeaponDelayedDamageInfo>::iterator ddi = m_weaponDDI.begin(); ddi != m_weaponDDI.end(); )
+	UnsignedInt curFrame = TheGameLogic->getFrame();
+
+	// with nothing pending there is nothing to catch up on either
+	if (m_weaponDDIPending == 0)
 	{
-		UnsignedInt curFrame = TheGameLogic->getFrame();
-		if (curFrame >= ddi->m_delayDamageFrame)
-		{
-			// we never do projectile-detonation-damage via this code path.
-			const isProjectileDetonation = false;
-			ddi->m_delayedWeapon->dealDamageInternal(ddi->m_delaySourceID, ddi->m_delayIntendedVictimID, &ddi->m_delayDamagePos, ddi->m_bonus, isProjectileDetonation);
-			ddi = m_weaponDDI.erase(ddi);
-		}
-		else
+		m_weaponDDINextFrame = curFrame + 1;
+		return;
+	}
+
+	// one full turn of the wheel visits every bucket, there's never a reason to go back further
+	if (curFrame >= DDI_WHEEL_SIZE && m_weaponDDINextFrame < curFrame - DDI_WHEEL_SIZE + 1)
+		m_weaponDDINextFrame = curFrame - DDI_WHEEL_SIZE + 1;
+
+	// normally this is exactly one bucket, the one for this frame
+	while (m_weaponDDINextFrame <= curFrame)
+	{
+		processDelayedDamage(m_weaponDDINextFrame);
+		++m_weaponDDINextFrame;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Deal all the delayed damage that is due by 'frame' in that frame's wheel bucket, in the order
+	* it was set. Entries for a later turn of the wheel stay where they are. */
+//-------------------------------------------------------------------------------------------------
+void WeaponStore::processDelayedDamage(UnsignedInt frame)
+{
+	std::vector<Int> &bucket = m_weaponDDIWheel[frame % DDI_WHEEL_SIZE];
+
+	// dealing damage can set more delayed damage, and anything already due is appended to this
+	// very bucket, so walk it by index and pick up the new entries in the same pass
+	Int keep = 0;
+	for (Int i = 0; i < bucket.size(); ++i)
+	{
+		Int index = bucket[i];
+		if (m_weaponDDI[index].m_delayDamageFrame > frame)
 		{
-			++ddi;
+			bucket[keep++] = index;
+			continue;
 		}
+
+		// copy it out and free the slot first, the pool may grow while the damage is dealt
+		WeaponDelayedDamageInfo ddi = m_weaponDDI[index];
+		m_weaponDDIFree.push_back(index);
+		--m_weaponDDIPending;
+
+		// we never do projectile-detonation-damage via this code path.
+		const isProjectileDetonation = false;
+		ddi.m_delayedWeapon->dealDamageInternal(ddi.m_delaySourceID, ddi.m_delayIntendedVictimID, &ddi.m_delayDamagePos, ddi.m_bonus, isProjectileDetonation);
 	}
+	bucket.resize(keep);
 }
 
 //-------------------------------------------------------------------------------------------------
 void WeaponStore::deleteAllDelayedDamage()
 {
 	m_weaponDDI.clear();
+	m_weaponDDIFree.clear();
+	for (Int i = 0; i < DDI_WHEEL_SIZE; ++i)
+		m_weaponDDIWheel[i].clear();
+	m_weaponDDIPending = 0;
+	m_weaponDDINextFrame = 0;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1686,7 +1730,25 @@ void WeaponStore::setDelayedDamage(const WeaponTemplate *weapon, const Coord3D*
 	wi.m_delaySourceID = sourceID;
 	wi.m_delayIntendedVictimID = victimID;
 	wi.m_bonus = bonus;
-	m_weaponDDI.push_back(wi);
+
+	Int index;
+	if (!m_weaponDDIFree.empty())
+	{
+		index = m_weaponDDIFree.back();
+		m_weaponDDIFree.pop_back();
+		m_weaponDDI[index] = wi;
+	}
+	else
+	{
+		index = m_weaponDDI.size();
+		m_weaponDDI.push_back(wi);
+	}
+
+	// damage that is already due goes in the next bucket to be processed, which is the current
+	// frame's bucket if we're in the middle of processing it
+	UnsignedInt bucketFrame = (whichFrame < m_weaponDDINextFrame) ? m_weaponDDINextFrame : whichFrame;
+	m_weaponDDIWheel[bucketFrame % DDI_WHEEL_SIZE].push_back(index);
+	++m_weaponDDIPending;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1774,6 +1836,7 @@ Weapon::Weapon(const WeaponTemplate* tmpl, WeaponSlotType wslot)
 	m_numShotsForCurBarrel = 	m_template->getShotsPerBarrel();
 	m_lastFireFrame = 0;
 	m_suspendFXFrame = TheGameLogic->getFrame() + m_template->getSuspendFXDelay();
+	m_crcCacheCount = -1;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1795,6 +1858,7 @@ Weapon::Weapon(const Weapon& that)
 	this->m_numShotsForCurBarrel = m_template->getShotsPerBarrel();
 	this->m_lastFireFrame = 0;
 	this->m_suspendFXFrame = that.getSuspendFXFrame();
+	this->m_crcCacheCount = -1;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1818,6 +1882,7 @@ Weapon& Weapon::operator=(const Weapon& that)
 		this->m_suspendFXFrame = that.getSuspendFXFrame();
 		this->m_numShotsForCurBarrel = m_template->getShotsPerBarrel();
 		this->m_projectileStreamID = INVALID_ID;
+		this->m_crcCacheCount = -1;
 	}
 	return *this;
 }
@@ -1890,6 +1955,7 @@ void Weapon::setClipPercentFull(Real percent, Bool allowReduction)
 		m_whenLastReloadStarted = TheGameLogic->getFrame();
 		m_whenWeCanFireAgain = m_whenLastReloadStarted;		
 		//CRCDEBUG_LOG(("Just set m_whenWeCanFireAgain to %d in Weapon::setClipPercentFull\n", m_whenWeCanFireAgain));
+		markCRCDirty();
 		rebuildScatterTargets();
 	}
 }
@@ -1897,6 +1963,7 @@ void Weapon::setClipPercentFull(Real percent, Bool allowReduction)
 //-------------------------------------------------------------------------------------------------
 void Weapon::rebuildScatterTargets()
 {
+	markCRCDirty();
 	m_scatterTargetsUnused.clear();
 	Int scatterTargetsCount = m_template->getScatterTargetsVector().size();
 	if (scatterTargetsCount)
@@ -1924,6 +1991,7 @@ void Weapon::reloadWithBonus(const Object *sourceObj, const WeaponBonus& bonus,
 	m_whenLastReloadStarted = TheGameLogic->getFrame();
 	m_whenWeCanFireAgain = m_whenLastReloadStarted + reloadTime;			
 	//CRCDEBUG_LOG(("Just set m_whenWeCanFireAgain to %d in Weapon::reloadWithBonus 1\n", m_whenWeCanFireAgain));
+	markCRCDirty();
 
 			// if we are sharing reload times
 			// go through other weapons in weapon set
@@ -1991,6 +2059,7 @@ void Weapon::onWeaponBonusChange(const Object *source)
 	{
 		m_whenLastReloadStarted = TheGameLogic->getFrame();
 		m_whenWeCanFireAgain = m_whenLastReloadStarted + newDelay;	
+		markCRCDirty();
 		
 		if (source->isReloadTimeShared())
 		{	
@@ -2434,6 +2503,7 @@ void Weapon::newProjectileFired(const Object *sourceObj, const Object *projectil
 		if( projectileStream == NULL )
 			return;
 		m_projectileStreamID = projectileStream->getID();
+		markCRCDirty();
 	}
 
 	//Check for projectile stream update
@@ -2575,6 +2645,7 @@ Bool Weapon::privateFireWeapon(
 
 			--m_maxShotCount;
 			--m_ammoInClip;	// so we can use the delay between shots on the mine clearing weapon
+			markCRCDirty();
 			if (m_ammoInClip <= 0 && m_template->getAutoReloadsClip())
 			{
 				reloadAmmo(sourceObj);
@@ -2608,6 +2679,9 @@ Bool Weapon::privateFireWeapon(
 	Bool reloaded = false;
 	if (m_ammoInClip > 0)
 	{
+		// everything below changes state crc() covers
+		markCRCDirty();
+
 		Int barrelCount = sourceObj->getDrawable()->getBarrelCount(m_wslot);
 		if (m_curBarrel >= barrelCount)
 		{
@@ -3163,9 +3237,30 @@ void Weapon::transferNextShotStatsFrom( const Weapon &weapon )
 	m_whenWeCanFireAgain = weapon.getPossibleNextShotFrame();
 	m_whenLastReloadStarted = weapon.getLastReloadStartedFrame();
 	m_status = weapon.getStatus();
+	markCRCDirty();
 }
 
 
+//-------------------------------------------------------------------------------------------------
+/** Same result as crc(), but replays the words crc() gave last time if nothing it covers has
+	* been changed since.  Everything crc() reads must call markCRCDirty() when it changes;
+	* -VerifyIncrementalCRC checks this against the full walk. */
+//-------------------------------------------------------------------------------------------------
+void Weapon::friend_xferIncrementalCRC( XferCRC *xfer )
+{
+	if( m_crcCacheCount >= 0 )
+	{
+		xfer->addCapturedCRC( m_crcCache, m_crcCacheCount );
+		return;
+	}
+
+	// a long scatter list can overflow the cache; then we just stay dirty and xfer every time
+	xfer->beginCapture( m_crcCache, CRC_CACHE_WORDS );
+	crc( xfer );
+	m_crcCacheCount = xfer->endCapture();
+
+}  // end friend_xferIncrementalCRC
+
 // ------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------
 void Weapon::crc( Xfer *xfer )
@@ -3473,6 +3568,9 @@ void Weapon::xfer( Xfer *xfer )
 	// leech weapon range active
 	xfer->xferBool( &m_leechWeaponRangeActive );
 
+	if( xfer->getXferMode() == XFER_LOAD )
+		markCRCDirty();
+
 }  // end xfer
 
 // ------------------------------------------------------------------------------------------------
@@ -3486,6 +3584,7 @@ void Weapon::loadPostProcess( void )
 		if( projectileStream == NULL )
 		{
 			m_projectileStreamID = INVALID_ID;
+			markCRCDirty();
 		}
 	}
 }
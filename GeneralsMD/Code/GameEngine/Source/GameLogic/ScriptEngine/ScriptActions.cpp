@@ -3837,7 +3837,8 @@ void ScriptActions::doSkyBox(Bool startDraw)
 
 void ScriptActions::doWeather(Bool showWeather)
 {
-	TheSnowManager->setVisible(showWeather);
+	if (TheSnowManager)
+		TheSnowManager->setVisible(showWeather);
 }
 
 //-------------------------------------------------------------------------------------------------
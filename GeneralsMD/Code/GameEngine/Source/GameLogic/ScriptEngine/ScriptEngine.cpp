@@ -481,9 +481,14 @@ m_minFade(0.0f),
 m_numAttackInfo(0),
 m_shownMPLocalDefeatWindow(FALSE),
 m_objectsShouldReceiveDifficultyBonus(TRUE),
-m_ChooseVictimAlwaysUsesNormal(false)
+m_ChooseVictimAlwaysUsesNormal(false),
+m_dependencyStamp(1),
+m_conditionDependencies(0)
 //
 {
+	for (Int i=0; i<SCRIPT_DEP_COUNT; ++i) {
+		m_dependencyStamps[i] = 0;
+	}
 	st_CanAppCont = true;
 	st_LastCurrentFrame = st_CurrentFrame = 0;
 	// By default, difficulty should be normal.
@@ -5311,6 +5316,8 @@ void ScriptEngine::reset( void )
 
 	m_shownMPLocalDefeatWindow = FALSE;
 
+	invalidateAllScriptDependencies();
+
 	Int i;
 	for (i=0; i<MAX_COUNTERS; i++) {
 		m_counters[i].value = 0;
@@ -5408,6 +5415,8 @@ void ScriptEngine::reset( void )
 	
 	// Clear the named objects list.
  	m_namedObjects.clear();
+	m_namedObjectIndex.clear();
+	m_namedObjectIDIndex.clear();
 
 	m_completedVideo.clear();
 	m_testingSpeech.clear();
@@ -5442,6 +5451,7 @@ void ScriptEngine::reset( void )
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::newMap( void )
 {
+	invalidateAllScriptDependencies();
 	m_numCounters = 1;
 	Int i;
 	for (i=0; i<MAX_COUNTERS; i++) {
@@ -5786,6 +5796,7 @@ void ScriptEngine::clearFlag(const AsciiString &name)
 		for (i=1; i<m_numFlags; i++) {
 			if ((modName==m_flags[i].name)) {
 				m_flags[i].value = FALSE;
+				invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 			}
 		}
 	}
@@ -5966,24 +5977,50 @@ PolygonTrigger *ScriptEngine::getQualifiedTriggerAreaByName( AsciiString name )
 //-------------------------------------------------------------------------------------------------
 Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 {
-	Bool is_GeneralsChallengeContext = TheCampaignManager->getCurrentCampaign() && TheCampaignManager->getCurrentCampaign()->m_isChallengeCampaign;
-	if (teamName == TEAM_THE_PLAYER && is_GeneralsChallengeContext)
-		// Designers have built their Generals' Challenge maps, referencing "teamThePlayer" meaning the local player's default (parent) team.
-		// However, they've also built many of their single player maps with this string, where "teamThePlayer" is not intended as an alias.
-		return ThePlayerList->getLocalPlayer()->getDefaultTeam();
-	if (teamName == THIS_TEAM) {
+	return getTeamNamedKey(NAMEKEY(teamName), teamName);
+}  // end getTeamNamed
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamed - Uses the parameter's name key, so no string compares are needed. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamed(const Parameter *pTeamParm)
+{
+	NameKeyType teamKey = pTeamParm->getNameKey();
+	if (teamKey == NAMEKEY_INVALID) {
+		return getTeamNamed(pTeamParm->getString());
+	}
+	return getTeamNamedKey(teamKey, pTeamParm->getString());
+}  // end getTeamNamed
+
+//-------------------------------------------------------------------------------------------------
+/** getTeamNamedKey - teamName is only used for debug messages. */
+//-------------------------------------------------------------------------------------------------
+Team * ScriptEngine::getTeamNamedKey(NameKeyType teamKey, const AsciiString& teamName)
+{
+	static const NameKeyType key_teamThePlayer = NAMEKEY(TEAM_THE_PLAYER);
+	static const NameKeyType key_thisTeam = NAMEKEY(THIS_TEAM);
+
+	if (teamKey == key_teamThePlayer) {
+		Bool is_GeneralsChallengeContext = TheCampaignManager->getCurrentCampaign() && TheCampaignManager->getCurrentCampaign()->m_isChallengeCampaign;
+		if (is_GeneralsChallengeContext)
+			// Designers have built their Generals' Challenge maps, referencing "teamThePlayer" meaning the local player's default (parent) team.
+			// However, they've also built many of their single player maps with this string, where "teamThePlayer" is not intended as an alias.
+			return ThePlayerList->getLocalPlayer()->getDefaultTeam();
+	}
+	if (teamKey == key_thisTeam) {
 		if (m_callingTeam) 
 			return m_callingTeam;
 		return m_conditionTeam;
 	}
-	if (m_callingTeam && m_callingTeam->getName() == teamName) {
+	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototypeByNameKey( teamKey );
+	if (theTeamProto == NULL) return NULL;
+	// Team names are the prototype names, so matching prototypes means matching names.
+	if (m_callingTeam && m_callingTeam->getPrototype() == theTeamProto) {
 		return m_callingTeam;
 	}
-	if (m_conditionTeam && m_conditionTeam->getName() == teamName) {
+	if (m_conditionTeam && m_conditionTeam->getPrototype() == theTeamProto) {
 		return m_conditionTeam;
 	}
-	TeamPrototype *theTeamProto = TheTeamFactory->findTeamPrototype( teamName );
-	if (theTeamProto == NULL) return NULL;
 	if (theTeamProto->getIsSingleton()) {
 		Team *theTeam = theTeamProto->getFirstItemIn_TeamInstanceList();
 		if (theTeam && theTeam->isActive()) {
@@ -6001,26 +6038,46 @@ Team * ScriptEngine::getTeamNamed(const AsciiString& teamName)
 		}
 	}
 	return theTeamProto->getFirstItemIn_TeamInstanceList();
-}  // end getTeamNamed
+}  // end getTeamNamedKey
 
 //-------------------------------------------------------------------------------------------------
 /** getUnitNamed */
 //-------------------------------------------------------------------------------------------------
 Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 {
-	if (unitName == THIS_OBJECT) {
+	if (unitName.isEmpty()) {
+		return NULL; // unnamed objects are never cached.
+	}
+	return getUnitNamedKey(NAMEKEY(unitName));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getUnitNamed - Uses the parameter's name key, so no string compares are needed. */
+//-------------------------------------------------------------------------------------------------
+Object * ScriptEngine::getUnitNamed(const Parameter *pUnitParm)
+{
+	return getUnitNamedKey(pUnitParm->getNameKey());
+}
+
+//-------------------------------------------------------------------------------------------------
+/** getUnitNamedKey */
+//-------------------------------------------------------------------------------------------------
+Object * ScriptEngine::getUnitNamedKey(NameKeyType nameKey)
+{
+	static const NameKeyType key_thisObject = NAMEKEY(THIS_OBJECT);
+
+	if (nameKey == key_thisObject) {
 		if (m_callingObject) {
 			return m_callingObject;
 		}
 		return m_conditionObject;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return it->second;
-		}
+	Int index = findNamedObjectIndex(nameKey);
+	if (index < 0) {
+		return NULL;
 	}
-	return NULL;
+	return m_namedObjects[index].second;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6028,12 +6085,30 @@ Object * ScriptEngine::getUnitNamed(const AsciiString& unitName)
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::didUnitExist(const AsciiString& unitName)
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (unitName == (it->first)) {
-			return (it->second == NULL);
-		}
+	if (unitName.isEmpty()) {
+		return false;
 	}
-	return false;
+	return didUnitExistKey(NAMEKEY(unitName));
+}
+
+//-------------------------------------------------------------------------------------------------
+/** didUnitExist - Uses the parameter's name key, so no string compares are needed. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::didUnitExist(const Parameter *pUnitParm)
+{
+	return didUnitExistKey(pUnitParm->getNameKey());
+}
+
+//-------------------------------------------------------------------------------------------------
+/** didUnitExistKey */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::didUnitExistKey(NameKeyType nameKey)
+{
+	Int index = findNamedObjectIndex(nameKey);
+	if (index < 0) {
+		return false;
+	}
+	return (m_namedObjects[index].second == NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6355,6 +6430,9 @@ Bool ScriptEngine::evaluateCounter( Condition *pCondition )
 		counterNdx = allocateCounter(pCondition->getParameter(0)->getString());
 		pCondition->getParameter(0)->friend_setInt(counterNdx);
 	}
+	if (m_counters[counterNdx].isCountdownTimer) {
+		noteConditionDependency(SCRIPT_DEP_VOLATILE); // running timers change every frame.
+	}
 	Int value = pCondition->getParameter(2)->getInt();
 	switch (pCondition->getParameter(1)->getInt()) {
 		case Parameter::LESS_THAN: return m_counters[counterNdx].value < value;
@@ -6380,6 +6458,7 @@ void ScriptEngine::setCounter( ScriptAction *pAction )
 	}
 	Int value = pAction->getParameter(1)->getInt();
 	m_counters[counterNdx].value = value;
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6448,6 +6527,7 @@ void ScriptEngine::addCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value += value;
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6463,6 +6543,7 @@ void ScriptEngine::subCounter( ScriptAction *pAction )
 		pAction->getParameter(1)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].value -= value;
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6507,6 +6588,7 @@ void ScriptEngine::setFlag( ScriptAction *pAction )
 	}
 	Bool value = pAction->getParameter(1)->getInt();
 	m_flags[flagNdx].value = value;
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 
@@ -6769,6 +6851,7 @@ void ScriptEngine::setTimer( ScriptAction *pAction, Bool millisecondTimer, Bool
 		m_counters[counterNdx].value = value;
 	}
 	m_counters[counterNdx].isCountdownTimer = true;
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6783,6 +6866,7 @@ void ScriptEngine::pauseTimer( ScriptAction *pAction )
 		pAction->getParameter(0)->friend_setInt(counterNdx);
 	}
 	m_counters[counterNdx].isCountdownTimer = false;
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6798,6 +6882,7 @@ void ScriptEngine::restartTimer( ScriptAction *pAction )
 	}
 	if (m_counters[counterNdx].value > 0) {
 		m_counters[counterNdx].isCountdownTimer = true;
+		invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 	}
 }
 
@@ -6823,6 +6908,7 @@ void ScriptEngine::adjustTimer( ScriptAction *pAction, Bool millisecondTimer, Bo
 			value = -value;
 		m_counters[counterNdx].value += value;
 	}
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7029,8 +7115,20 @@ void ScriptEngine::executeScript( Script *pScript )
 
 	} else {
 		m_conditionTeam = NULL;
+		Bool conditionsTrue;
+		if (canReuseFalseConditions(pScript)) {
+			// Nothing the conditions looked at has changed since they were last false.
+			conditionsTrue = false;
+#ifdef _DEBUG
+			DEBUG_ASSERTCRASH(!evaluateConditions(pScript), ("Script '%s' has an untracked condition dependency.", pScript->getName().str()));
+#endif
+		} else {
+			UnsignedInt stamp = m_dependencyStamp;
+			conditionsTrue = evaluateConditions(pScript);
+			recordConditionResult(pScript, conditionsTrue, stamp);
+		}
 		// If conditions evaluate to true, execute actions.
-		if (evaluateConditions(pScript)) {
+		if (conditionsTrue) {
 			if (pScript->getAction()) {
 				// Script Debug window
 				_appendMessage(pScript->getName());
@@ -7063,11 +7161,44 @@ void ScriptEngine::executeScript( Script *pScript )
 	m_conditionTeam = pSavConditionTeam;
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Returns the ScriptDependency bits a condition type's result depends on.  Anything not listed 
+		here reads game state we don't track, and is always re-evaluated. */
+//-------------------------------------------------------------------------------------------------
+static UnsignedInt getConditionDependencies( Condition::ConditionType type )
+{
+	switch (type) {
+		case Condition::CONDITION_FALSE:
+		case Condition::CONDITION_TRUE:
+			return 0;
+
+		case Condition::COUNTER:	// running timers add SCRIPT_DEP_VOLATILE in evaluateCounter.
+		case Condition::FLAG:
+			return (1 << SCRIPT_DEP_VARIABLES);
+
+		case Condition::PLAYER_HAS_CREDITS:
+			return (1 << SCRIPT_DEP_MONEY);
+
+		case Condition::PLAYER_ALL_DESTROYED:
+		case Condition::TEAM_DESTROYED:
+		case Condition::TEAM_HAS_UNITS:
+		case Condition::TEAM_CREATED:
+		case Condition::NAMED_DESTROYED:
+		case Condition::NAMED_NOT_DESTROYED:
+		case Condition::NAMED_CREATED:
+			return (1 << SCRIPT_DEP_OBJECTS);
+
+		default:
+			return (1 << SCRIPT_DEP_VOLATILE);
+	}
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Evaluates a condition */
 //-------------------------------------------------------------------------------------------------
 Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 {
+	m_conditionDependencies |= getConditionDependencies(pCondition->getConditionType());
 	switch (pCondition->getConditionType()) {
 		default: 
 			return TheScriptConditions->evaluateCondition(pCondition);
@@ -7079,6 +7210,61 @@ Bool ScriptEngine::evaluateCondition( Condition *pCondition )
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Invalidates every dependency, so all scripts get evaluated on their next pass. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::invalidateAllScriptDependencies( void )
+{
+	++m_dependencyStamp;
+	for (Int i=0; i<SCRIPT_DEP_COUNT; ++i) {
+		m_dependencyStamps[i] = m_dependencyStamp;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** True if the script's conditions were last false, and nothing they depended on has changed 
+		since, so they would still be false. */
+//-------------------------------------------------------------------------------------------------
+Bool ScriptEngine::canReuseFalseConditions( Script *pScript )
+{
+	if (TheGlobalData->m_scriptConditionPolling) {
+		return false;
+	}
+	UnsignedInt stamp = pScript->getFalseStamp();
+	if (stamp == 0 || pScript->getFalsePlayer() != m_currentPlayer) {
+		return false;
+	}
+	// <This Team> conditions read the calling team, so the result only holds for the same one.
+	TeamID callingTeamID = m_callingTeam ? m_callingTeam->getID() : TEAM_ID_INVALID;
+	if (pScript->getFalseTeamID() != callingTeamID) {
+		return false;
+	}
+	// <This Object> conditions read the calling object, which we don't track.
+	if (m_callingObject || m_conditionObject) {
+		return false;
+	}
+	UnsignedInt dependencies = pScript->getFalseDependencies();
+	for (Int i=0; i<SCRIPT_DEP_COUNT; ++i) {
+		if ((dependencies & (1 << i)) && m_dependencyStamps[i] > stamp) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Remembers a false result, if everything the conditions looked at is tracked.  stamp is 
+		m_dependencyStamp from before the conditions were evaluated. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::recordConditionResult( Script *pScript, Bool result, UnsignedInt stamp )
+{
+	if (result || (m_conditionDependencies & (1 << SCRIPT_DEP_VOLATILE)) || m_callingObject || m_conditionObject) {
+		pScript->clearFalseResult();
+		return;
+	}
+	pScript->setFalseResult(stamp, m_conditionDependencies, m_currentPlayer, m_callingTeam ? m_callingTeam->getID() : TEAM_ID_INVALID);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** Execute an action specified by pActionHead */
 //-------------------------------------------------------------------------------------------------
@@ -7111,35 +7297,52 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 		return;
 	}
 
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (it->first == objName) {
-			if (it->second == NULL) {
-				AsciiString newNameForDead;
-				newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'\n", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
-				TheScriptEngine->AppendDebugMessage(newNameForDead, FALSE);
-				DEBUG_LOG((newNameForDead.str()));
-				it->second = pNewObject;
-				return;
-			} else {
-				DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s'," 
-										 " but object (%d) of type '%s' already has that name\n",
-										 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(), 
-										 it->second->getID(), it->second->getTemplate()->getName().str()));
-				return;
-			}
-		}
-
-		if (pNewObject == (it->second)) {
-			it->first = objName;
+	NameKeyType nameKey = NAMEKEY(objName);
+	Int index = findNamedObjectIndex(nameKey);
+	if (index >= 0) {
+		NamedRequest &req = m_namedObjects[index];
+		if (req.second == NULL) {
+			AsciiString newNameForDead;
+			newNameForDead.format("Reassigning dead object's name '%s' to object (%d) of type '%s'\n", objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str());
+			TheScriptEngine->AppendDebugMessage(newNameForDead, FALSE);
+			DEBUG_LOG((newNameForDead.str()));
+			req.second = pNewObject;
+			m_namedObjectIDIndex[pNewObject->getID()] = index;
+			invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
+			return;
+		} else {
+			DEBUG_CRASH(("Attempting to assign the name '%s' to object (%d) of type '%s'," 
+									 " but object (%d) of type '%s' already has that name\n",
+									 objName.str(), pNewObject->getID(), pNewObject->getTemplate()->getName().str(), 
+									 req.second->getID(), req.second->getTemplate()->getName().str()));
 			return;
 		}
 	}
 
-	NamedRequest req;
-	req.first = objName;
-	req.second = pNewObject;
+	NamedObjectIDIndexMapIt idIt = m_namedObjectIDIndex.find(pNewObject->getID());
+	if (idIt != m_namedObjectIDIndex.end()) {
+		// The object has been renamed, so move its entry over to the new name.
+		index = idIt->second;
+		NamedRequest &req = m_namedObjects[index];
+		NamedObjectIndexMapIt nameIt = m_namedObjectIndex.find(NAMEKEY(req.first));
+		if (nameIt != m_namedObjectIndex.end() && nameIt->second == index) {
+			m_namedObjectIndex.erase(nameIt);
+			// If another entry shares the old name, it is now the one found by lookups.
+			for (Int i = index + 1; i < m_namedObjects.size(); ++i) {
+				if (m_namedObjects[i].first == req.first) {
+					m_namedObjectIndex[NAMEKEY(req.first)] = i;
+					break;
+				}
+			}
+		}
+		req.first = objName;
+		m_namedObjectIndex[nameKey] = index;
+		invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
+		return;
+	}
 
-	m_namedObjects.push_back(req);
+	addNamedRequest(objName, pNewObject);
+	invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7147,11 +7350,12 @@ void ScriptEngine::addObjectToCache(Object* pNewObject)
 //-------------------------------------------------------------------------------------------------
 void ScriptEngine::removeObjectFromCache( Object* pDeadObject )
 {
-	for (VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it) {
-		if (pDeadObject == (it->second)) {
-			it->second = NULL;	// Don't remove it, cause we want to check whether we ever knew a name later
-			break;
-		}
+	NamedObjectIDIndexMapIt it = m_namedObjectIDIndex.find(pDeadObject->getID());
+	if (it != m_namedObjectIDIndex.end()) {
+		DEBUG_ASSERTCRASH(m_namedObjects[it->second].second == pDeadObject, ("Named object index is out of date"));
+		m_namedObjects[it->second].second = NULL;	// Don't remove it, cause we want to check whether we ever knew a name later
+		m_namedObjectIDIndex.erase(it);
+		invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 	}
 }
 
@@ -7180,26 +7384,28 @@ void ScriptEngine::transferObjectName( const AsciiString& unitName, Object *pNew
 
 	pNewObject->setName(unitName); // make sure it's named the name.
 
-	//Loop through the cached list and find the string entry. If found, change the object
-	//so it's pointing to the new one.
-	for( VecNamedRequestsIt it = m_namedObjects.begin(); it != m_namedObjects.end(); ++it )
+	//Find the cached entry for the name. If found, change the object so it's pointing to the new one.
+	Int index = findNamedObjectIndex( NAMEKEY( unitName ) );
+	if( index >= 0 )
 	{
-		if( !unitName.compare( it->first ) )
+		NamedRequest &req = m_namedObjects[ index ];
+		Object* pOldObj = req.second;
+		if( pOldObj )
 		{
-			Object* pOldObj = it->second;
-			if( pOldObj )
-			{
-				// if you are transferring your name, you should also transfer any custom indicator color you have.
-				if (pOldObj->hasCustomIndicatorColor())
-					pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
-				else
-					pNewObject->removeCustomIndicatorColor();
-			}
-
-			it->second = pNewObject;
+			// if you are transferring your name, you should also transfer any custom indicator color you have.
+			if (pOldObj->hasCustomIndicatorColor())
+				pNewObject->setCustomIndicatorColor(pOldObj->getIndicatorColor());
+			else
+				pNewObject->removeCustomIndicatorColor();
 
-			return;
+			m_namedObjectIDIndex.erase( pOldObj->getID() );
 		}
+
+		req.second = pNewObject;
+		m_namedObjectIDIndex[ pNewObject->getID() ] = index;
+		invalidateScriptDependency( SCRIPT_DEP_OBJECTS );
+
+		return;
 	}
 
 }
@@ -7276,6 +7482,7 @@ void ScriptEngine::notifyOfAcquiredScience( Int playerIndex, ScienceType science
 void ScriptEngine::signalUIInteract(const AsciiString& hookName)
 {
 	m_uiInteractions.push_front(hookName);
+	invalidateScriptDependency(SCRIPT_DEP_VARIABLES);	// flags can read as set while the hook is pending.
 #ifdef DEBUG_LOGGING
 	AppendDebugMessage(hookName, false); // don't bother in Release
 #endif
@@ -7597,6 +7804,7 @@ Bool ScriptEngine::evaluateConditions( Script *pScript, Team *thisTeam, Player *
 	LatchRestore<Player*> latch2(m_currentPlayer, player);
 	OrCondition *pConditionHead = pScript->getOrCondition();
 	Bool testValue = false;
+	m_conditionDependencies = 0;
 
 #ifdef DEBUG_LOGGING
 #define COLLECT_CONDITION_EVAL_TIMES
@@ -7727,6 +7935,9 @@ const ConditionTemplate * ScriptEngine::getConditionTemplate( Int ndx )
 void ScriptEngine::createNamedCache( void )
 {
 	m_namedObjects.clear();
+	m_namedObjectIndex.clear();
+	m_namedObjectIDIndex.clear();
+	invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
 
 	if( !TheGameLogic )
 	{
@@ -7736,15 +7947,64 @@ void ScriptEngine::createNamedCache( void )
 
 	while (pObj) {
 		if (!pObj->getName().isEmpty()) {
-			NamedRequest req;
-			req.first = pObj->getName();
-			req.second = pObj;
-			m_namedObjects.push_back(req);
+			addNamedRequest(pObj->getName(), pObj);
 		}
 		pObj = pObj->getNextObject();
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Returns the index in m_namedObjects of the entry with the given name, or -1. */
+//-------------------------------------------------------------------------------------------------
+Int ScriptEngine::findNamedObjectIndex( NameKeyType nameKey )
+{
+	NamedObjectIndexMapIt it = m_namedObjectIndex.find(nameKey);
+	if (it == m_namedObjectIndex.end()) {
+		return -1;
+	}
+	return it->second;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Appends an entry to the named object cache, and indexes it by name & object id.  If the name 
+		is already present, the earlier entry keeps the name index, same as a front to back search. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::addNamedRequest( const AsciiString& name, Object *obj )
+{
+	NamedRequest req;
+	req.first = name;
+	req.second = obj;
+	m_namedObjects.push_back(req);
+
+	Int index = m_namedObjects.size() - 1;
+	NameKeyType nameKey = NAMEKEY(name);
+	if (m_namedObjectIndex.find(nameKey) == m_namedObjectIndex.end()) {
+		m_namedObjectIndex[nameKey] = index;
+	}
+	if (obj) {
+		m_namedObjectIDIndex[obj->getID()] = index;
+	}
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Rebuilds the name & object id indices from m_namedObjects. */
+//-------------------------------------------------------------------------------------------------
+void ScriptEngine::rebuildNamedObjectIndex( void )
+{
+	m_namedObjectIndex.clear();
+	m_namedObjectIDIndex.clear();
+
+	for (Int i = 0; i < m_namedObjects.size(); ++i) {
+		NameKeyType nameKey = NAMEKEY(m_namedObjects[i].first);
+		if (m_namedObjectIndex.find(nameKey) == m_namedObjectIndex.end()) {
+			m_namedObjectIndex[nameKey] = i;
+		}
+		if (m_namedObjects[i].second) {
+			m_namedObjectIDIndex[m_namedObjects[i].second->getID()] = i;
+		}
+	}
+}
+
 void ScriptEngine::appendSequentialScript(const SequentialScript *scriptToSequence)
 {
 	SequentialScript *newSequentialScript = newInstance( SequentialScript );	
@@ -7827,6 +8087,8 @@ void ScriptEngine::notifyOfTeamDestruction(Team *teamDestroyed)
 		return;		
 	}
 
+	invalidateScriptDependency(SCRIPT_DEP_OBJECTS);
+
 	VecSequentialScriptPtrIt it;
 	for (it = m_sequentialScripts.begin(); it != m_sequentialScripts.end(); /* empty */) {
 		SequentialScript *seqScript = (*it);
@@ -9039,6 +9301,8 @@ void ScriptEngine::xfer( Xfer *xfer )
 
 		}  // end for, i
 
+		rebuildNamedObjectIndex();
+
 	}  // end else, load
 
 	// first update
@@ -9328,6 +9592,9 @@ void ScriptEngine::xfer( Xfer *xfer )
 void ScriptEngine::loadPostProcess( void )
 {
 
+	// Nothing evaluated before the load can be trusted.
+	invalidateAllScriptDependencies();
+
 	// Now that we've loaded everything, go through and set them all back in sync with what we
 	// currently think they should be.
 	TheScriptActions->doEnableOrDisableObjectDifficultyBonuses(m_objectsShouldReceiveDifficultyBonus);
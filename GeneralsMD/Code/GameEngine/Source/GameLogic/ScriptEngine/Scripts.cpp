@@ -927,6 +927,10 @@ m_hard(true),
 m_delayEvaluationSeconds(0),
 m_conditionTime(0),
 m_conditionExecutedCount(0),
+m_falseStamp(0),
+m_falseDependencies(0),
+m_falsePlayer(NULL),
+m_falseTeamID(0),
 m_frameToEvaluateAt(0),
 m_isSubroutine(false),
 m_hasWarnings(false),
@@ -1116,6 +1120,7 @@ void Script::updateFrom(Script *pSrc)
 	}
 	this->m_actionFalse = pSrc->m_actionFalse;
 	pSrc->m_actionFalse = NULL;
+	this->m_falseStamp = 0;
 }
 
 /**
@@ -1854,6 +1859,22 @@ void Parameter::qualify(const AsciiString& qualifier,
 		case SCRIPT_SUBROUTINE: m_string.concat(qualifier); break;
 		default: break;
 	}
+	// The string may have changed, so re-resolve the key.
+	m_nameKey = NAMEKEY_INVALID;
+	if (m_paramType == TEAM) {
+		getNameKey();
+	}
+}
+
+/** Returns the name key for the string, resolving it the first time through.  Unit & team
+		parameters are resolved when the map loads, so the script conditions can look up named
+		units & teams without touching the string. */
+NameKeyType Parameter::getNameKey(void) const
+{
+	if (m_nameKey == NAMEKEY_INVALID && m_string.isNotEmpty()) {
+		m_nameKey = NAMEKEY(m_string);
+	}
+	return m_nameKey;
 }
 
 AsciiString Parameter::getUiText(void) const
@@ -2275,6 +2296,13 @@ Parameter *Parameter::ReadParameter(DataChunkInput &file)
 		}
 	}
 
+	// Resolve named references up front, so condition evaluation doesn't have to.
+	if (pParm->getParameterType() == TEAM || pParm->getParameterType() == UNIT || 
+			pParm->getParameterType() == BRIDGE) 
+	{
+		pParm->getNameKey();
+	}
+
 	return pParm;
 }
 
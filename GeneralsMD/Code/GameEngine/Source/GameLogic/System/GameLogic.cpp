@@ -63,6 +63,7 @@
 #include "Common/ThingFactory.h"
 #include "Common/Team.h"
 #include "Common/ThingTemplate.h"
+#include "Common/WorkerThreadPool.h"
 #include "GameClient/Water.h"
 #include "GameClient/Snow.h"
 #include "Common/WellKnownKeys.h"
@@ -123,6 +124,7 @@
 #include <rts/profile.h>
 
 DECLARE_PERF_TIMER(SleepyMaintenance)
+DECLARE_PERF_TIMER(GameLogic_gatherPhaseParallel)
 
 #include "Common/UnitTimings.h" //Contains the DO_UNIT_TIMINGS define jba.		 
 // If defined, the game times various units.
@@ -257,6 +259,7 @@ GameLogic::GameLogic( void )
 	m_height = 0;
 	m_objList = NULL;
 	m_curUpdateModule = NULL;
+	m_workerThreadPool = NULL;
 	m_nextObjID = INVALID_ID;
 	m_startNewGame = FALSE;
 	m_gameMode = GAME_NONE;
@@ -353,6 +356,9 @@ GameLogic::~GameLogic()
 	// destroy all remaining objects
 	destroyAllObjectsImmediate();
 
+	delete m_workerThreadPool;
+	m_workerThreadPool = NULL;
+
 	// delete the logical terrain
 	delete TheTerrainLogic;
 	TheTerrainLogic = NULL;
@@ -394,6 +400,10 @@ void GameLogic::init( void )
 	ThePartitionManager->init();
 	ThePartitionManager->setName("ThePartitionManager");
 
+	// optional helper threads for phase-parallel update gathers
+	if (m_workerThreadPool == NULL && TheGlobalData->m_logicWorkerThreads > 0)
+		m_workerThreadPool = NEW WorkerThreadPool(TheGlobalData->m_logicWorkerThreads);
+
 
 	// Create system for holding deleted objects that are
 	// still in the partition manager because player has a fogged
@@ -2937,6 +2947,71 @@ void GameLogic::remakeSleepyUpdate()
 	validateSleepyUpdate();
 }
 
+// ------------------------------------------------------------------------------------------------
+static void gatherPhaseParallelJob(void *userData, Int i)
+{
+	UpdateModulePtr *updates = (UpdateModulePtr *)userData;
+	updates[i]->gatherPhaseParallel();
+}
+
+// ------------------------------------------------------------------------------------------------
+/** Run the read-only gather half of every phase-parallel module due this frame in the given
+	* phase. The due modules all sit at the top of the heap, so we only walk the part of the
+	* tree whose priority is <= the limit. The gathers can't see each other's results, so the
+	* order they run in (and the number of threads they run on) doesn't matter; the updates
+	* themselves still run in heap order on this thread. */
+// ------------------------------------------------------------------------------------------------
+void GameLogic::gatherPhaseParallelUpdates(UnsignedInt now, SleepyUpdatePhase phase)
+{
+	USE_PERF_TIMER(GameLogic_gatherPhaseParallel)
+
+	const UnsignedInt limit = (now << 2) | phase;
+	const Int sz = m_sleepyUpdates.size();
+
+	m_phaseParallelUpdates.clear();
+	m_phaseParallelSearch.clear();
+	if (sz > 0)
+		m_phaseParallelSearch.push_back(0);
+
+	while (!m_phaseParallelSearch.empty())
+	{
+		Int i = m_phaseParallelSearch.back();
+		m_phaseParallelSearch.pop_back();
+
+		UpdateModulePtr u = m_sleepyUpdates[i];
+		if (u->friend_getPriority() > limit)
+			continue;	// nor will any of its children be due
+
+		if (u->friend_getNextCallPhase() == phase && u->isPhaseParallel())
+		{
+			DisabledMaskType dis = u->friend_getObject()->getDisabledFlags();
+			if (!dis.any() || dis.anyIntersectionWith(u->getDisabledTypesToProcess()))
+				m_phaseParallelUpdates.push_back(u);
+		}
+
+		Int i1 = 2*(i+1)-1;
+		Int i2 = 2*(i+1);
+		if (i1 < sz)
+			m_phaseParallelSearch.push_back(i1);
+		if (i2 < sz)
+			m_phaseParallelSearch.push_back(i2);
+	}
+
+	Int count = m_phaseParallelUpdates.size();
+	if (count == 0)
+		return;
+
+	if (m_workerThreadPool)
+	{
+		m_workerThreadPool->run(gatherPhaseParallelJob, &m_phaseParallelUpdates[0], count);
+	}
+	else
+	{
+		for (Int i = 0; i < count; ++i)
+			m_phaseParallelUpdates[i]->gatherPhaseParallel();
+	}
+}
+
 // ------------------------------------------------------------------------------------------------
 void GameLogic::pushSleepyUpdate(UpdateModulePtr u)
 {
@@ -3729,6 +3804,7 @@ void GameLogic::update( void )
 #endif
 
 	{
+		Int gatheredPhase = -1;
 		while (!m_sleepyUpdates.empty())
 		{
 			UpdateModulePtr u = peekSleepyUpdate();
@@ -3746,6 +3822,14 @@ void GameLogic::update( void )
 				break;
 			}
 
+			// entering a new phase: let the phase-parallel modules do their read-only work first.
+			// this happens in every game, whatever the thread count, so it's part of the simulation.
+			if (u->friend_getNextCallPhase() != gatheredPhase)
+			{
+				gatheredPhase = u->friend_getNextCallPhase();
+				gatherPhaseParallelUpdates(now, (SleepyUpdatePhase)gatheredPhase);
+			}
+
 			UpdateSleepTime sleepLen = UPDATE_SLEEP_NONE;	// default, if it is disabled.
 
 			DisabledMaskType dis = u->friend_getObject()->getDisabledFlags();
@@ -3984,6 +4068,8 @@ void GameLogic::destroyObject( Object *obj )
 
 	// mark object as destroyed
 	obj->setStatus( MAKE_OBJECT_STATUS_MASK( OBJECT_STATUS_DESTROYED ) );
+	if( TheScriptEngine )
+		TheScriptEngine->invalidateScriptDependency( SCRIPT_DEP_OBJECTS );
 
 	// We desperately need to stop here, or else the destructor of the statemachine will try to do
 	// stopping logic, which uses virtual functions and deleted modules, which will crash us.
@@ -4063,9 +4149,48 @@ UnsignedInt GameLogic::getCRC( Int mode, AsciiString deepCRCFileName )
 
 	marker = "MARKER:Objects";
 	xferCRC->xferAsciiString(&marker);
-	for( obj = m_objList; obj; obj=obj->getNextObject() )
+
+	// a plain CRC can reuse the words each object (and each of its weapons) gave us last time if
+	// it hasn't changed since; deep CRCs write everything out, and object logging needs Object::crc
+	// to actually run. the partition manager, player list and AI below are always walked in full:
+	// the cells are raw shroud arrays, so replaying cached words would cost as much as hashing them,
+	// and the players and AI only add a few small fixed records each.
+	Bool incremental = (xferCRC->getXferMode() == XFER_CRC);
+#ifdef DEBUG_CRC
+	if (g_logObjectCRCs)
+		incremental = FALSE;
+#endif
+
+	if (incremental)
 	{
-		xferCRC->xferSnapshot( obj );
+		for( obj = m_objList; obj; obj=obj->getNextObject() )
+		{
+			obj->friend_xferIncrementalCRC( xferCRC );
+		}
+
+#ifdef DEBUG_CRC
+		if (g_verifyIncrementalCRC)
+		{
+			XferCRC verifyCRC;
+			verifyCRC.open("verifyCRC");
+			verifyCRC.xferAsciiString(&marker);
+			for( obj = m_objList; obj; obj=obj->getNextObject() )
+			{
+				verifyCRC.xferSnapshot( obj );
+			}
+			verifyCRC.close();
+			DEBUG_ASSERTCRASH(verifyCRC.getCRC() == xferCRC->getCRC(),
+				("Incremental object CRC 0x%8.8X doesn't match full CRC 0x%8.8X on frame %d - something crc() covers isn't calling markCRCDirty()",
+				xferCRC->getCRC(), verifyCRC.getCRC(), m_frame));
+		}
+#endif
+	}
+	else
+	{
+		for( obj = m_objList; obj; obj=obj->getNextObject() )
+		{
+			xferCRC->xferSnapshot( obj );
+		}
 	}
 	UnsignedInt seed = GetGameLogicRandomSeedCRC();
 	if (isInGameLogicUpdate())
@@ -48,11 +48,14 @@ Connection::Connection() {
 	m_transport = NULL;
 	m_user = NULL;
 	m_netCommandList = NULL;
+	m_fitPacket = NULL;
 	m_retryTime = 2000; // set retry time to 2 seconds.
 	m_lastTimeSent = 0;
 	m_frameGrouping = 1;
 	m_isQuitting = false;
 	m_quitTime = 0;
+	m_numRetries = 0;
+	m_totalRetries = 0;
 	// Added By Sadullah Nader
 	// clearing out the latency tracker
 	m_averageLatency = 0.0f;
@@ -77,6 +80,11 @@ Connection::~Connection() {
 		m_netCommandList->deleteInstance();
 		m_netCommandList = NULL;
 	}
+
+	if (m_fitPacket != NULL) {
+		m_fitPacket->deleteInstance();
+		m_fitPacket = NULL;
+	}
 }
 
 /**
@@ -99,6 +107,7 @@ void Connection::init() {
 	m_lastTimeSent = 0;
 	m_frameGrouping = 1;
 	m_numRetries = 0;
+	m_totalRetries = 0;
 	m_retryMetricsTime = 0;
 
 	for (Int i = 0; i < CONNECTION_LATENCY_HISTORY_LENGTH; ++i) {
@@ -153,12 +162,13 @@ User * Connection::getUser() {
  * The relay mostly has to do with the packet router.
  */
 void Connection::sendNetCommandMsg(NetCommandMsg *msg, UnsignedByte relay) {
-	static NetPacket *packet = NULL;
-
 	// this is done so we don't have to allocate and delete a packet every time we send a message.
-	if (packet == NULL) {
-		packet = newInstance(NetPacket);
+	// It's per connection rather than static so that connections on different threads (the relay
+	// server runs one event loop per core) don't share it.
+	if (m_fitPacket == NULL) {
+		m_fitPacket = newInstance(NetPacket);
 	}
+	NetPacket *packet = m_fitPacket;
 
 
 	if (m_isQuitting)
@@ -310,6 +320,7 @@ UnsignedInt Connection::doSend() {
 					if (CommandRequiresAck(msg->getCommand())) {
 						if (timeLastSent != -1) {
 							++m_numRetries;
+							++m_totalRetries;
 						}
 						doRetryMetrics();
 						msg->setTimeLastSent(curtime);
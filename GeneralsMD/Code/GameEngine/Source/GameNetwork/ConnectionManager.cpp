@@ -61,7 +61,10 @@
 #include "GameLogic/ScriptEngine.h"
 #include "GameLogic/VictoryConditions.h"
 #include "GameClient/DisconnectMenu.h"
+#include "GameClient/Display.h"
+#include "GameClient/GameWindowManager.h"
 #include "GameClient/InGameUI.h"
+#include "GameNetwork/NetworkInterface.h"
 
 #ifdef _INTERNAL
 // for occasional debugging...
@@ -149,6 +152,11 @@ ConnectionManager::ConnectionManager(void)
 	m_netCommandWrapperList = NULL;
 	m_localUser = NULL;
 	m_localUser = newInstance(User);
+	m_lastRunAheadMetricsTime = 0;
+	m_keepAliveIndex = 0;
+	m_keepAliveStartTime = 0;
+	m_frameResendRequests = 0;
+	m_frameResendsServed = 0;
 }
 
 /**
@@ -181,6 +189,7 @@ void ConnectionManager::init()
 #ifdef MEMORYPOOL_DEBUG
 	TheMemoryPoolFactory->debugSetInitFillerIndex(m_localSlot);
 #endif
+	NetPacket::SetCompactGameCommands(FALSE);
 	m_packetRouterSlot = 0; /// @todo The LAN/WOL interface should be telling us who the packet router is based on machine specs passed around through game options.
 	for (i = 0; i < MAX_SLOTS; ++i) {
 		m_packetRouterFallback[i] = -1;
@@ -205,15 +214,25 @@ void ConnectionManager::init()
 	m_smallestPacketArrivalCushion = -1;
 
 	m_frameMetrics.init();
+	m_lastRunAheadMetricsTime = 0;
+	m_keepAliveIndex = 0;
+	m_keepAliveStartTime = 0;
+	m_frameResendRequests = 0;
+	m_frameResendsServed = 0;
 
-	TheDisconnectMenu = NEW DisconnectMenu;
-	TheDisconnectMenu->init();
+	// No window manager means no GUI to put the disconnect screen on (a tool driving us directly).
+	if (TheWindowManager != NULL) {
+		TheDisconnectMenu = NEW DisconnectMenu;
+		TheDisconnectMenu->init();
+	}
 
 	m_disconnectManager = NEW DisconnectManager;
 	m_disconnectManager->init();
 
-	TheDisconnectMenu->attachDisconnectManager(m_disconnectManager);
-	TheDisconnectMenu->hideScreen();
+	if (TheDisconnectMenu != NULL) {
+		TheDisconnectMenu->attachDisconnectManager(m_disconnectManager);
+		TheDisconnectMenu->hideScreen();
+	}
 
 	m_netCommandWrapperList = newInstance(NetCommandWrapperList);
 	m_netCommandWrapperList->init();
@@ -276,12 +295,13 @@ void ConnectionManager::reset()
 #ifdef MEMORYPOOL_DEBUG
 	TheMemoryPoolFactory->debugSetInitFillerIndex(m_localSlot);
 #endif
+	NetPacket::SetCompactGameCommands(FALSE);
 	m_packetRouterSlot = -1;
 
-	for (i = 0; i < TheGlobalData->m_networkFPSHistoryLength; ++i) {
+	for (i = 0; i < MAX_SLOTS; ++i) {
 		m_fpsAverages[i] = -1;
 	}
-	for (i = 0; i < TheGlobalData->m_networkLatencyHistoryLength; ++i) {
+	for (i = 0; i < MAX_SLOTS; ++i) {
 		m_latencyAverages[i] = 0.0;
 	}
 
@@ -290,6 +310,26 @@ void ConnectionManager::reset()
 	}
 
 	m_frameMetrics.reset();
+	m_lastRunAheadMetricsTime = 0;
+	m_keepAliveIndex = 0;
+	m_keepAliveStartTime = 0;
+	m_frameResendRequests = 0;
+	m_frameResendsServed = 0;
+}
+
+UnsignedInt ConnectionManager::getLogicFrame()
+{
+	return TheGameLogic->getFrame();
+}
+
+Int ConnectionManager::getExecutionFrame()
+{
+	return TheNetwork->getExecutionFrame();
+}
+
+Real ConnectionManager::getLocalFps()
+{
+	return TheDisplay->getAverageFPS();
 }
 
 UnsignedInt ConnectionManager::getPingFrame()
@@ -463,7 +503,7 @@ Bool ConnectionManager::processNetCommand(NetCommandRef *ref) {
 	// FrameData for that frame + 256, and would screw up the command count.
 
 	if (IsCommandSynchronized(msg->getNetCommandType())) {
-		if (ref->getCommand()->getExecutionFrame() < TheGameLogic->getFrame()) {
+		if (ref->getCommand()->getExecutionFrame() < getLogicFrame()) {
 			return TRUE;
 		}
 	}
@@ -562,6 +602,7 @@ void ConnectionManager::processFrameResendRequest(NetFrameResendRequestCommandMs
 		return;
 	}
 
+	++m_frameResendsServed;
 	sendFrameDataToPlayer(playerID, msg->getFrameToResend());
 }
 
@@ -643,7 +684,9 @@ void ConnectionManager::processDisconnectChat(NetDisconnectChatCommandMsg *msg)
 	}
 	unitext.format(L"[%ls] %ls", name.str(), msg->getText().str());
 //	DEBUG_LOG(("ConnectionManager::processDisconnectChat - got message from player %d, message is %ls\n", playerID, unitext.str()));
-	TheDisconnectMenu->showChat(unitext); // <-- need to implement this
+	if (TheDisconnectMenu != NULL) {
+		TheDisconnectMenu->showChat(unitext); // <-- need to implement this
+	}
 }
 
 void ConnectionManager::processChat(NetChatCommandMsg *msg) 
@@ -823,7 +866,7 @@ void ConnectionManager::processFrameInfo(NetFrameCommandMsg *msg) {
 
 	if ((playerID >= 0) && (playerID < MAX_SLOTS)) {
 		if (m_frameData[playerID] != NULL) {
-//			DEBUG_LOG(("ConnectionManager::processFrameInfo - player %d, frame %d, command count %d, received on frame %d\n", playerID, msg->getExecutionFrame(), msg->getCommandCount(), TheGameLogic->getFrame()));
+//			DEBUG_LOG(("ConnectionManager::processFrameInfo - player %d, frame %d, command count %d, received on frame %d\n", playerID, msg->getExecutionFrame(), msg->getCommandCount(), getLogicFrame()));
 			m_frameData[playerID]->setFrameCommandCount(msg->getExecutionFrame(), msg->getCommandCount());
 		}
 	}
@@ -941,13 +984,13 @@ void ConnectionManager::processAck(NetCommandMsg *msg) {
 PlayerLeaveCode ConnectionManager::processPlayerLeave(NetPlayerLeaveCommandMsg *msg) {
 	UnsignedByte playerID = msg->getLeavingPlayerID();
 	if ((playerID != m_localSlot) && (m_connections[playerID] != NULL)) {
-		DEBUG_LOG(("ConnectionManager::processPlayerLeave() - setQuitting() on player %d on frame %d\n", playerID, TheGameLogic->getFrame()));
+		DEBUG_LOG(("ConnectionManager::processPlayerLeave() - setQuitting() on player %d on frame %d\n", playerID, getLogicFrame()));
 		m_connections[playerID]->setQuitting();
 	}
 	DEBUG_ASSERTCRASH(m_frameData[playerID]->getIsQuitting() == FALSE, ("Player %d is already quitting", playerID));
 	if ((playerID != m_localSlot) && (m_frameData[playerID] != NULL) && (m_frameData[playerID]->getIsQuitting() == FALSE)) {
-		DEBUG_LOG(("ConnectionManager::processPlayerLeave - setQuitFrame on player %d for frame %d\n", playerID, TheGameLogic->getFrame()+1));
-		m_frameData[playerID]->setQuitFrame(TheGameLogic->getFrame() + FRAMES_TO_KEEP + 1);
+		DEBUG_LOG(("ConnectionManager::processPlayerLeave - setQuitFrame on player %d for frame %d\n", playerID, getLogicFrame()+1));
+		m_frameData[playerID]->setQuitFrame(getLogicFrame() + FRAMES_TO_KEEP + 1);
 	}
 
 	if (playerID == m_localSlot)
@@ -1148,7 +1191,7 @@ void ConnectionManager::sendRemoteCommand(NetCommandRef *msg) {
 	if (IsCommandSynchronized(msg->getCommand()->getNetCommandType())) {
 //		DEBUG_LOG(("ConnectionManager::sendRemoteCommand - about to call allCommandsReady\n"));
 		if (allCommandsReady(msg->getCommand()->getExecutionFrame(), TRUE)) {
-			UnsignedInt cushion = msg->getCommand()->getExecutionFrame() - TheGameLogic->getFrame();
+			UnsignedInt cushion = msg->getCommand()->getExecutionFrame() - getLogicFrame();
 			if ((cushion < m_smallestPacketArrivalCushion) || (m_smallestPacketArrivalCushion == -1)) {
 				m_smallestPacketArrivalCushion = cushion;
 			}
@@ -1209,7 +1252,7 @@ void ConnectionManager::update(Bool isInGame) {
 		}
 
 		if ((m_frameData[i] != NULL) && (m_frameData[i]->getIsQuitting() == TRUE)) {
-			if (m_frameData[i]->getQuitFrame() == TheGameLogic->getFrame()) {
+			if (m_frameData[i]->getQuitFrame() == getLogicFrame()) {
 				DEBUG_LOG(("ConnectionManager::update - deleting frame data for slot %d on quitting frame %d\n", i, m_frameData[i]->getQuitFrame()));
 				m_frameData[i]->deleteInstance();
 				m_frameData[i] = NULL;
@@ -1221,10 +1264,9 @@ void ConnectionManager::update(Bool isInGame) {
 }
 
 void ConnectionManager::updateRunAhead(Int oldRunAhead, Int frameRate, Bool didSelfSlug, Int nextExecutionFrame) {
-	static time_t lasttimesent = 0;
 	time_t curTime = timeGetTime();
 
-	if ((lasttimesent == 0) || ((curTime - lasttimesent) > TheGlobalData->m_networkRunAheadMetricsTime)) {
+	if ((m_lastRunAheadMetricsTime == 0) || ((curTime - m_lastRunAheadMetricsTime) > TheGlobalData->m_networkRunAheadMetricsTime)) {
 		if (m_localSlot == m_packetRouterSlot) {
 			// We are the packet router, time to compute a new run ahead for this game.
 			m_latencyAverages[m_localSlot] = m_frameMetrics.getAverageLatency();
@@ -1245,26 +1287,8 @@ void ConnectionManager::updateRunAhead(Int oldRunAhead, Int frameRate, Bool didS
 			Int minFpsPlayer;
 			getMinimumFps(minFps, minFpsPlayer);
 			DEBUG_LOG(("ConnectionManager::updateRunAhead - max latency = %f, min fps = %d, min fps player = %d old FPS = %d\n", getMaximumLatency(), minFps, minFpsPlayer, frameRate));
-			if ((minFps >= ((frameRate * 9) / 10)) && (minFps < frameRate)) {
-				// if the minimum fps is within 10% of the desired framerate, then keep the current minimum fps.
-				minFps = frameRate;
-			}
-			if (minFps < 5) {
-				minFps = 5; // Absolutely do not run below 5 fps.
-			}
-			if (minFps > TheGlobalData->m_framesPerSecondLimit) {
-				minFps = TheGlobalData->m_framesPerSecondLimit; // Cap to 30 FPS.
-			}
-			DEBUG_LOG(("ConnectionManager::updateRunAhead - minFps after adjustment is %d\n", minFps));
-			Int newRunAhead = (Int)((getMaximumLatency() / 2.0) * (Real)minFps);
-			newRunAhead += (newRunAhead * TheGlobalData->m_networkRunAheadSlack) / 100; // Add in 10% of slack to the run ahead in case of network hiccups.
-			if (newRunAhead < MIN_RUNAHEAD) {
-				newRunAhead = MIN_RUNAHEAD; // make sure its at least MIN_RUNAHEAD.
-			}
-
-			if (newRunAhead > (MAX_FRAMES_AHEAD / 2)) {
-				newRunAhead = MAX_FRAMES_AHEAD / 2; // dont let run ahead get out of hand.
-			}
+			Int newRunAhead;
+			ComputeRunAhead(getMaximumLatency(), minFps, frameRate, TheGlobalData->m_framesPerSecondLimit, TheGlobalData->m_networkRunAheadSlack, newRunAhead, minFps);
 
 			NetRunAheadCommandMsg *msg = newInstance(NetRunAheadCommandMsg);
 			msg->setPlayerID(m_localSlot);
@@ -1272,7 +1296,7 @@ void ConnectionManager::updateRunAhead(Int oldRunAhead, Int frameRate, Bool didS
 				msg->setID(GenerateNextCommandID());
 			}
 
-			// needs to be set to the greater of getExecutionFrame and TheGameLogic->getFrame() + oldRunAhead
+			// needs to be set to the greater of getExecutionFrame and getLogicFrame() + oldRunAhead
 			// This prevents the case of...
 			// run ahead starts at 30
 			// run ahead changes to 10 at frame 31 (the command was created on frame 1)
@@ -1282,10 +1306,10 @@ void ConnectionManager::updateRunAhead(Int oldRunAhead, Int frameRate, Bool didS
 			// didn't change for the first time till frame 31.  This creates an extra command
 			// for frame 56 that isn't accounted for in the frame command count that is sent
 			// out in the NetFrameCommandMsg.  sheesh.
-			if (nextExecutionFrame > (TheGameLogic->getFrame() + oldRunAhead)) {
+			if (nextExecutionFrame > (getLogicFrame() + oldRunAhead)) {
 				msg->setExecutionFrame(nextExecutionFrame);
 			} else {
-				msg->setExecutionFrame(TheGameLogic->getFrame() + oldRunAhead);
+				msg->setExecutionFrame(getLogicFrame() + oldRunAhead);
 			}
 
 			msg->setRunAhead(newRunAhead);
@@ -1314,10 +1338,10 @@ void ConnectionManager::updateRunAhead(Int oldRunAhead, Int frameRate, Bool didS
 //				msg2->setID(GenerateNextCommandID());
 				msg2->setID(msg->getID());
 			}
-			if (nextExecutionFrame > (TheGameLogic->getFrame() + oldRunAhead)) {
+			if (nextExecutionFrame > (getLogicFrame() + oldRunAhead)) {
 				msg2->setExecutionFrame(nextExecutionFrame);
 			} else {
-				msg2->setExecutionFrame(TheGameLogic->getFrame() + oldRunAhead);
+				msg2->setExecutionFrame(getLogicFrame() + oldRunAhead);
 			}
 
 			// Let the player with the slowest FPS run a little faster than the other computers...
@@ -1359,7 +1383,7 @@ void ConnectionManager::updateRunAhead(Int oldRunAhead, Int frameRate, Bool didS
 			m_connections[m_packetRouterSlot]->sendNetCommandMsg(msg, 1 << m_packetRouterSlot);
 			msg->detach();
 		}
-		lasttimesent = curTime;
+		m_lastRunAheadMetricsTime = curTime;
 	}
 }
 
@@ -1406,6 +1430,20 @@ UnsignedInt ConnectionManager::getMinimumCushion() {
 	return m_frameMetrics.getMinimumCushion();
 }
 
+Real ConnectionManager::getAverageLatency() {
+	return m_frameMetrics.getAverageLatency();
+}
+
+Int ConnectionManager::getTotalRetries() {
+	Int retries = 0;
+	for (Int i = 0; i < NUM_CONNECTIONS; ++i) {
+		if (m_connections[i] != NULL) {
+			retries += m_connections[i]->getTotalRetries();
+		}
+	}
+	return retries;
+}
+
 /**
  * The commands for the given frame are all ready, time to send out our command count for that frame.
  */
@@ -1423,7 +1461,7 @@ void ConnectionManager::processFrameTick(UnsignedInt frame) {
 	}
 	msg->setPlayerID(m_localSlot);
 
-	m_frameMetrics.doPerFrameMetrics(frame);
+	m_frameMetrics.doPerFrameMetrics(frame, getLocalFps());
 
 	DEBUG_LOG(("ConnectionManager::processFrameTick - sending frame info for frame %d, ID %d, command count %d\n", frame, msg->getID(), commandCount));
 
@@ -1597,7 +1635,7 @@ Bool ConnectionManager::allCommandsReady(UnsignedInt frame, Bool justTesting /*
 	}
 
 	if ((retval == TRUE) && (justTesting == FALSE)) {
-		m_disconnectManager->allCommandsReady(TheGameLogic->getFrame(), this);
+		m_disconnectManager->allCommandsReady(getLogicFrame(), this);
 		retval = m_disconnectManager->allowedToContinue(); // allow the disconnect manager to keep us on this frame
 																											// in case we are waiting for a new packet router or something.
 	}
@@ -1607,7 +1645,7 @@ Bool ConnectionManager::allCommandsReady(UnsignedInt frame, Bool justTesting /*
 
 void ConnectionManager::handleAllCommandsReady(void)
 {
-	m_disconnectManager->allCommandsReady(TheGameLogic->getFrame(), this, FALSE);
+	m_disconnectManager->allCommandsReady(getLogicFrame(), this, FALSE);
 }
 
 
@@ -1672,42 +1710,39 @@ void ConnectionManager::determineRouterFallbackPlan() {
 */
 
 void ConnectionManager::doKeepAlive() {
-	static Int nextIndex = 0;
-	static time_t startTime = 0;
-
 	time_t curTime = timeGetTime();
 
-	if (startTime == 0) {
-		startTime = curTime;
+	if (m_keepAliveStartTime == 0) {
+		m_keepAliveStartTime = curTime;
 		return;
 	}
 
-	time_t numSeconds = (curTime - startTime) / 1000;
+	time_t numSeconds = (curTime - m_keepAliveStartTime) / 1000;
 
-	while ((nextIndex <= numSeconds) && (nextIndex < MAX_SLOTS)) {
+	while ((m_keepAliveIndex <= numSeconds) && (m_keepAliveIndex < MAX_SLOTS)) {
 //		DEBUG_LOG(("ConnectionManager::doKeepAlive - trying to send keep alive message to player %d\n", nextIndex));
-		if (m_connections[nextIndex] != NULL) {
+		if (m_connections[m_keepAliveIndex] != NULL) {
 			NetKeepAliveCommandMsg *msg = newInstance(NetKeepAliveCommandMsg);
 			msg->setPlayerID(m_localSlot);
 			if (DoesCommandRequireACommandID(msg->getNetCommandType()) == TRUE) {
 				msg->setID(GenerateNextCommandID());
 			}
 //			DEBUG_LOG(("ConnectionManager::doKeepAlive - sending keep alive message to player %d\n", nextIndex));
-			sendLocalCommandDirect(msg, 1 << nextIndex);
+			sendLocalCommandDirect(msg, 1 << m_keepAliveIndex);
 			msg->detach();
 		}
-		++nextIndex;
+		++m_keepAliveIndex;
 	}
-	if (nextIndex == MAX_SLOTS) {
-		nextIndex = 0;
-		startTime = curTime;
+	if (m_keepAliveIndex == MAX_SLOTS) {
+		m_keepAliveIndex = 0;
+		m_keepAliveStartTime = curTime;
 	}
 }
 
 PlayerLeaveCode ConnectionManager::disconnectPlayer(Int slot) {
 	// Need to do the deletion of the slot's connection and frame data here.
 	PlayerLeaveCode retval = PLAYERLEAVECODE_CLIENT;
-	DEBUG_LOG(("ConnectionManager::disconnectPlayer - disconnecting slot %d on frame %d\n", slot, TheGameLogic->getFrame()));
+	DEBUG_LOG(("ConnectionManager::disconnectPlayer - disconnecting slot %d on frame %d\n", slot, getLogicFrame()));
 
 	if ((slot < 0) || (slot >= MAX_SLOTS)) {
 		return PLAYERLEAVECODE_UNKNOWN;
@@ -1719,14 +1754,14 @@ PlayerLeaveCode ConnectionManager::disconnectPlayer(Int slot) {
 		if (gSlot && !gSlot->lastFrameInGame())
 		{
 			DEBUG_LOG(("ConnectionManager::disconnectPlayer(%d) - slot is last in the game on frame %d\n",
-				slot, TheGameLogic->getFrame()));
-			gSlot->setLastFrameInGame(TheGameLogic->getFrame());
+				slot, getLogicFrame()));
+			gSlot->setLastFrameInGame(getLogicFrame());
 		}
 	}
 
 	UnicodeString unicodeName;
 	unicodeName = getPlayerName(slot);
-	if (unicodeName.getLength() > 0 && m_connections[slot]) {
+	if (unicodeName.getLength() > 0 && m_connections[slot] && TheInGameUI != NULL) {
 		TheInGameUI->message("Network:PlayerLeftGame", unicodeName.str());
 
 		// People are boneheads. Also play a sound
@@ -1888,10 +1923,17 @@ void ConnectionManager::parseUserList(const GameInfo *game)
 				m_connections[i]->init();
 				m_connections[i]->attachTransport(m_transport);
 //				UnsignedShort port = (TheNAT)?TheNAT->getSlotPort(i):8088;
+				UnsignedInt ip = slot->getIP();
 				UnsignedShort port = slot->getPort();
-				m_connections[i]->setUser(newInstance(User)(slot->getName(), slot->getIP(), port));
+				if (TheGlobalData->m_networkRelayIP != 0) {
+					// Everything goes through the relay server, which acks and forwards by relay mask.
+					// Commands say who they're from, so nothing else cares that every connection has the same address.
+					ip = TheGlobalData->m_networkRelayIP;
+					port = TheGlobalData->m_networkRelayPort;
+				}
+				m_connections[i]->setUser(newInstance(User)(slot->getName(), ip, port));
 				m_frameData[i] = newInstance(FrameDataManager)(FALSE);
-				DEBUG_LOG(("Remote user is at %X:%d\n", slot->getIP(), slot->getPort()));
+				DEBUG_LOG(("Remote user is at %X:%d, sending to %X:%d\n", slot->getIP(), slot->getPort(), ip, port));
 			}
 			else
 			{
@@ -1911,6 +1953,11 @@ void ConnectionManager::parseUserList(const GameInfo *game)
 	TheMemoryPoolFactory->debugSetInitFillerIndex(m_localSlot);
 #endif
 
+	// The game options are the same for everyone, so this is where all of us
+	// agree on how game commands go on the wire.
+	NetPacket::SetCompactGameCommands(game->getCompactGameCommands());
+	DEBUG_LOG(("Compact game commands are %s\n", game->getCompactGameCommands() ? "on" : "off"));
+
 	/*
 	if ( numUsers < 2 || m_localSlot == -1 )
 	{
@@ -2071,6 +2118,28 @@ Real ConnectionManager::getUnknownPacketsPerSecond( void )
 	  return 0.0;
 }
 
+/**
+ * Return the average number of packets read per transport receive call that read any.
+ */
+Real ConnectionManager::getIncomingPacketsPerCall( void )
+{
+	if (m_transport)
+		return m_transport->getIncomingPacketsPerCall();
+	else
+	  return 0.0;
+}
+
+/**
+ * Return the average number of packets written per transport send call that wrote any.
+ */
+Real ConnectionManager::getOutgoingPacketsPerCall( void )
+{
+	if (m_transport)
+		return m_transport->getOutgoingPacketsPerCall();
+	else
+	  return 0.0;
+}
+
 /**
  * Return the smallest packet arrival cushion since this was last called.
  */
@@ -2378,15 +2447,15 @@ void ConnectionManager::notifyOthersOfNewFrame(UnsignedInt frame) {
 
 void ConnectionManager::sendFrameDataToPlayer(UnsignedInt playerID, UnsignedInt startingFrame) {
 	DEBUG_LOG(("ConnectionManager::sendFrameDataToPlayer - sending frame data to player %d starting with frame %d\n", playerID, startingFrame));
-	for (UnsignedInt frame = startingFrame; frame < TheGameLogic->getFrame(); ++frame) {
+	for (UnsignedInt frame = startingFrame; frame < getLogicFrame(); ++frame) {
 		sendSingleFrameToPlayer(playerID, frame);
 	}
 	DEBUG_LOG(("ConnectionManager::sendFrameDataToPlayer - done sending commands to player %d\n", playerID));
 }
 
 void ConnectionManager::sendSingleFrameToPlayer(UnsignedInt playerID, UnsignedInt frame) {
-	if ((TheGameLogic->getFrame() - FRAMES_TO_KEEP) > frame) {
-		DEBUG_LOG(("ConnectionManager::sendSingleFrameToPlayer - player %d requested frame %d when we are on frame %d, this is too far in the past.\n", playerID, frame, TheGameLogic->getFrame()));
+	if ((getLogicFrame() - FRAMES_TO_KEEP) > frame) {
+		DEBUG_LOG(("ConnectionManager::sendSingleFrameToPlayer - player %d requested frame %d when we are on frame %d, this is too far in the past.\n", playerID, frame, getLogicFrame()));
 		return;
 	}
 
@@ -2444,6 +2513,7 @@ void ConnectionManager::requestFrameDataResend(Int playerID, UnsignedInt frame)
 	}
 
 	if (playerID < MAX_SLOTS) {
+		++m_frameResendRequests;
 		sendLocalCommandDirect(msg, 1 << playerID);
 	}
 
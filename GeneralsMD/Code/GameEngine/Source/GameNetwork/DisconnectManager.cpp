@@ -84,7 +84,9 @@ DisconnectManager::~DisconnectManager() {
 }
 
 void DisconnectManager::init() {
-	TheDisconnectMenu->hideScreen(); // make sure the screen starts out hidden.
+	if (TheDisconnectMenu != NULL) {
+		TheDisconnectMenu->hideScreen(); // make sure the screen starts out hidden.
+	}
 	m_lastFrame = 0;
 	m_lastFrameTime = -1;
 	m_lastKeepAliveSendTime = -1;
@@ -117,7 +119,7 @@ void DisconnectManager::update(ConnectionManager *conMgr) {
 	// The game logic stalls on the frame we are currently waiting for commands on,
 	// so we have to check for the current logic frame being one higher than
 	// the last one we had the commands ready for.
-	if (TheGameLogic->getFrame() == m_lastFrame) {
+	if (conMgr->getLogicFrame() == m_lastFrame) {
 		time_t curTime = timeGetTime();
 		if ((curTime - m_lastFrameTime) > TheGlobalData->m_networkDisconnectTime) {
 			if (m_disconnectState == DISCONNECTSTATETYPE_SCREENOFF) {
@@ -126,19 +128,19 @@ void DisconnectManager::update(ConnectionManager *conMgr) {
 			sendKeepAlive(conMgr);
 		}
 	} else {
-		nextFrame(TheGameLogic->getFrame(), conMgr);
+		nextFrame(conMgr->getLogicFrame(), conMgr);
 	}
 
 	if (m_disconnectState != DISCONNECTSTATETYPE_SCREENOFF) {
 		updateDisconnectStatus(conMgr);
 
 		// check to see if we need to send pings
-		if (m_pingFrame < TheGameLogic->getFrame())
+		if (m_pingFrame < conMgr->getLogicFrame())
 		{
 			time_t curTime = timeGetTime();
 			if ((curTime - m_lastFrameTime) > 10000) /// @todo: plug in some better measure here
 			{
-				m_pingFrame = TheGameLogic->getFrame();
+				m_pingFrame = conMgr->getLogicFrame();
 				m_pingsSent = 0;
 				m_pingsRecieved = 0;
 
@@ -173,7 +175,7 @@ void DisconnectManager::update(ConnectionManager *conMgr) {
 			PingResponse resp;
 			while (ThePinger->getResponse(resp))
 			{
-				if (m_pingFrame != TheGameLogic->getFrame())
+				if (m_pingFrame != conMgr->getLogicFrame())
 				{
 					// wrong frame - we're not pinging yet
 					DEBUG_LOG(("DisconnectManager::update() - discarding ping of %d from %s (%d reps)\n",
@@ -223,7 +225,7 @@ void DisconnectManager::updateDisconnectStatus(ConnectionManager *conMgr) {
 
 				if (m_haveNotifiedOtherPlayersOfCurrentFrame == FALSE) {
 					if ((newTime < TheGlobalData->m_networkPlayerTimeoutTime / 3) || (isPlayerVotedOut(slot, conMgr) == TRUE)) {
-						TheNetwork->notifyOthersOfCurrentFrame();
+						conMgr->notifyOthersOfCurrentFrame(conMgr->getLogicFrame());
 						m_haveNotifiedOtherPlayersOfCurrentFrame = TRUE;
 					}
 
@@ -231,7 +233,7 @@ void DisconnectManager::updateDisconnectStatus(ConnectionManager *conMgr) {
 
 					if (m_timeOfDisconnectScreenOn != 0) {
 						if ((curTime - m_timeOfDisconnectScreenOn) > TheGlobalData->m_networkDisconnectScreenNotifyTime) {
-							TheNetwork->notifyOthersOfCurrentFrame();
+							conMgr->notifyOthersOfCurrentFrame(conMgr->getLogicFrame());
 							m_haveNotifiedOtherPlayersOfCurrentFrame = TRUE;
 						}
 					}
@@ -255,7 +257,9 @@ void DisconnectManager::updateDisconnectStatus(ConnectionManager *conMgr) {
 						DEBUG_LOG(("DisconnectManager::updateDisconnectStatus - not all on same frame\n"));
 					}
 				}
-				TheDisconnectMenu->setPlayerTimeoutTime(slot, newTime);
+				if (TheDisconnectMenu != NULL) {
+					TheDisconnectMenu->setPlayerTimeoutTime(slot, newTime);
+				}
 			}
 		}
 	}
@@ -307,7 +311,7 @@ void DisconnectManager::processDisconnectKeepAlive(NetCommandMsg *msg, Connectio
 void DisconnectManager::processDisconnectPlayer(NetCommandMsg *msg, ConnectionManager *conMgr) {
 	NetDisconnectPlayerCommandMsg *cmdMsg = (NetDisconnectPlayerCommandMsg *)msg;
 	DEBUG_LOG(("DisconnectManager::processDisconnectPlayer - Got disconnect player command from player %d.  Disconnecting player %d on frame %d\n", msg->getPlayerID(), cmdMsg->getDisconnectSlot(), cmdMsg->getDisconnectFrame()));
-	DEBUG_ASSERTCRASH(TheGameLogic->getFrame() == cmdMsg->getDisconnectFrame(), ("disconnecting player on the wrong frame!!!"));
+	DEBUG_ASSERTCRASH(conMgr->getLogicFrame() == cmdMsg->getDisconnectFrame(), ("disconnecting player on the wrong frame!!!"));
 	disconnectPlayer(cmdMsg->getDisconnectSlot(), conMgr);
 }
 
@@ -428,10 +432,10 @@ void DisconnectManager::processDisconnectScreenOff(NetCommandMsg *msg, Connectio
 void DisconnectManager::applyDisconnectVote(Int slot, UnsignedInt frame, Int fromSlot, ConnectionManager *conMgr) {
 	m_playerVotes[slot][fromSlot].vote = TRUE;
 	m_playerVotes[slot][fromSlot].frame = frame;
-	Int numVotes = countVotesForPlayer(slot);
+	Int numVotes = countVotesForPlayer(slot, conMgr);
 	DEBUG_LOG(("DisconnectManager::applyDisconnectVote - added a vote to disconnect slot %d, from slot %d, for frame %d, current votes are %d\n", slot, fromSlot, frame, numVotes));
 	Int transSlot = translatedSlotPosition(slot, conMgr->getLocalPlayerID());
-	if (transSlot != -1) {
+	if ((transSlot != -1) && (TheDisconnectMenu != NULL)) {
 		TheDisconnectMenu->updateVotes(transSlot, numVotes);
 	}
 }
@@ -446,9 +450,11 @@ void DisconnectManager::allCommandsReady(UnsignedInt frame, ConnectionManager *c
 		if (m_disconnectState != DISCONNECTSTATETYPE_SCREENOFF) {
 			DEBUG_LOG(("DisconnectManager::allCommandsReady - setting screen state to off.\n"));
 
-			TheDisconnectMenu->hideScreen();
+			if (TheDisconnectMenu != NULL) {
+				TheDisconnectMenu->hideScreen();
+			}
 			m_disconnectState = DISCONNECTSTATETYPE_SCREENOFF;
-			TheNetwork->notifyOthersOfNewFrame(frame);
+			conMgr->notifyOthersOfNewFrame(frame);
 
 			// reset the votes since we're moving to a new frame.
 			for (Int i = 0; i < MAX_SLOTS; ++i) {
@@ -484,13 +490,16 @@ void DisconnectManager::sendKeepAlive(ConnectionManager *conMgr) {
 }
 
 void DisconnectManager::populateDisconnectScreen(ConnectionManager *conMgr) {
+	if (TheDisconnectMenu == NULL) {
+		return;
+	}
 	for (Int i = 0; i < MAX_SLOTS; ++i) {
 		UnicodeString name = conMgr->getPlayerName(i);
 		Int slot = translatedSlotPosition(i, conMgr->getLocalPlayerID());
 		if (slot != -1) {
 			TheDisconnectMenu->setPlayerName(slot, name);
 
-			Int numVotes = countVotesForPlayer(i);
+			Int numVotes = countVotesForPlayer(i, conMgr);
 			TheDisconnectMenu->updateVotes(slot, numVotes);
 		}
 	}
@@ -539,13 +548,17 @@ void DisconnectManager::resetPacketRouterTimeout() {
 }
 
 void DisconnectManager::turnOnScreen(ConnectionManager *conMgr) {
-	TheDisconnectMenu->showScreen();
-	DEBUG_LOG(("DisconnectManager::turnOnScreen - turning on screen on frame %d\n", TheGameLogic->getFrame()));
+	if (TheDisconnectMenu != NULL) {
+		TheDisconnectMenu->showScreen();
+	}
+	DEBUG_LOG(("DisconnectManager::turnOnScreen - turning on screen on frame %d\n", conMgr->getLogicFrame()));
 	m_disconnectState = DISCONNECTSTATETYPE_SCREENON;
 	m_lastKeepAliveSendTime = -1;
 	populateDisconnectScreen(conMgr);
 	resetPlayerTimeouts(conMgr);
-	TheDisconnectMenu->hidePacketRouterTimeout();
+	if (TheDisconnectMenu != NULL) {
+		TheDisconnectMenu->hidePacketRouterTimeout();
+	}
 
 	m_haveNotifiedOtherPlayersOfCurrentFrame = FALSE;
 
@@ -554,7 +567,7 @@ void DisconnectManager::turnOnScreen(ConnectionManager *conMgr) {
 }
 
 void DisconnectManager::disconnectPlayer(Int slot, ConnectionManager *conMgr) {
-	DEBUG_LOG(("DisconnectManager::disconnectPlayer - Disconnecting slot number %d on frame %d\n", slot, TheGameLogic->getFrame()));
+	DEBUG_LOG(("DisconnectManager::disconnectPlayer - Disconnecting slot number %d on frame %d\n", slot, conMgr->getLogicFrame()));
 	DEBUG_ASSERTCRASH((slot >= 0) && (slot < MAX_SLOTS), ("Attempting to disconnect an invalid slot number"));
 	if ((slot < 0) || (slot >= (MAX_SLOTS))) {
 		return;
@@ -576,8 +589,12 @@ void DisconnectManager::disconnectPlayer(Int slot, ConnectionManager *conMgr) {
 
 		// Get the disconnecting player off the disconnect window.
 		UnicodeString uname = conMgr->getPlayerName(slot);
-		TheRecorder->logPlayerDisconnect(uname, slot);
-		TheDisconnectMenu->removePlayer(transSlot, uname);
+		if (TheRecorder != NULL) {
+			TheRecorder->logPlayerDisconnect(uname, slot);
+		}
+		if (TheDisconnectMenu != NULL) {
+			TheDisconnectMenu->removePlayer(transSlot, uname);
+		}
 
 		PlayerLeaveCode retcode = conMgr->disconnectPlayer(slot);
 		DEBUG_ASSERTCRASH((retcode != PLAYERLEAVECODE_UNKNOWN), ("Invalid player leave code"));
@@ -620,7 +637,7 @@ void DisconnectManager::sendVoteCommand(Int slot, ConnectionManager *conMgr) {
 
 	msg->setPlayerID(conMgr->getLocalPlayerID());
 	msg->setSlot(slot);
-	msg->setVoteFrame(TheGameLogic->getFrame());
+	msg->setVoteFrame(conMgr->getLogicFrame());
 	if (DoesCommandRequireACommandID(msg->getNetCommandType()) == TRUE) {
 		msg->setID(GenerateNextCommandID());
 	}
@@ -639,7 +656,7 @@ void DisconnectManager::voteForPlayerDisconnect(Int slot, ConnectionManager *con
 		sendVoteCommand(transSlot, conMgr);
 
 		// we use the game logic frame cause we might not have sent out our own disconnect frame yet.
-		applyDisconnectVote(transSlot, TheGameLogic->getFrame(), conMgr->getLocalPlayerID(), conMgr);
+		applyDisconnectVote(transSlot, conMgr->getLogicFrame(), conMgr->getLocalPlayerID(), conMgr);
 	}
 }
 
@@ -721,10 +738,10 @@ void DisconnectManager::sendPlayerDestruct(Int slot, ConnectionManager *conMgr)
 	}
 
 	DEBUG_LOG(("Queueing DestroyPlayer %d for frame %d on frame %d as command %d\n",
-		slot, TheNetwork->getExecutionFrame()+1, TheGameLogic->getFrame(), currentID));
+		slot, conMgr->getExecutionFrame()+1, conMgr->getLogicFrame(), currentID));
 
 	NetDestroyPlayerCommandMsg *netmsg = newInstance(NetDestroyPlayerCommandMsg);	
-	netmsg->setExecutionFrame(TheNetwork->getExecutionFrame()+1);
+	netmsg->setExecutionFrame(conMgr->getExecutionFrame()+1);
 	netmsg->setPlayerID(conMgr->getLocalPlayerID());
 	netmsg->setID(currentID);
 	netmsg->setPlayerIndex(slot);
@@ -740,7 +757,7 @@ Bool DisconnectManager::isPlayerVotedOut(Int slot, ConnectionManager *conMgr) {
 		return FALSE;
 	}
 	Int transSlot = untranslatedSlotPosition(slot, conMgr->getLocalPlayerID());
-	Int numVotes = countVotesForPlayer(transSlot);
+	Int numVotes = countVotesForPlayer(transSlot, conMgr);
 	if (numVotes >= (conMgr->getNumPlayers() - 1)) {
 		return TRUE;
 	}
@@ -783,15 +800,15 @@ void DisconnectManager::playerHasAdvancedAFrame(Int slot, UnsignedInt frame) {
 	}
 }
 
-Int DisconnectManager::countVotesForPlayer(Int slot) {
+Int DisconnectManager::countVotesForPlayer(Int slot, ConnectionManager *conMgr) {
 	if ((slot < 0) || (slot >= MAX_SLOTS)) {
 		return 0;
 	}
 
 	Int retval = 0;
 	for (Int i = 0; i < MAX_SLOTS; ++i) {
-		// using TheGameLogic->getFrame() cause we might not have sent our disconnect frame yet.
-		if ((m_playerVotes[slot][i].vote == TRUE) && (m_playerVotes[slot][i].frame == TheGameLogic->getFrame())) {
+		// using the logic frame cause we might not have sent our disconnect frame yet.
+		if ((m_playerVotes[slot][i].vote == TRUE) && (m_playerVotes[slot][i].frame == conMgr->getLogicFrame())) {
 			++retval;
 		}
 	}
@@ -810,10 +827,10 @@ void DisconnectManager::resetPlayersVotes(Int playerID, UnsignedInt frame, Conne
 		}
 	}
 
-	Int numVotes = countVotesForPlayer(playerID);
+	Int numVotes = countVotesForPlayer(playerID, conMgr);
 	DEBUG_LOG(("DisconnectManager::resetPlayersVotes - after adjusting votes, player %d has %d votes\n", playerID, numVotes));
 	Int transSlot = translatedSlotPosition(playerID, conMgr->getLocalPlayerID());
-	if (transSlot != -1) {
+	if ((transSlot != -1) && (TheDisconnectMenu != NULL)) {
 		TheDisconnectMenu->updateVotes(transSlot, numVotes);
 	}
 }
@@ -37,7 +37,6 @@
 #include "PreRTS.h"	// This must go first in EVERY cpp file int the GameEngine
 
 #include "GameNetwork/FrameMetrics.h"
-#include "GameClient/Display.h"
 #include "GameNetwork/NetworkUtil.h"
 
 FrameMetrics::FrameMetrics() 
@@ -96,7 +95,7 @@ void FrameMetrics::reset() {
 	init();
 }
 
-void FrameMetrics::doPerFrameMetrics(UnsignedInt frame) {
+void FrameMetrics::doPerFrameMetrics(UnsignedInt frame, Real fps) {
 	// Do the measurement of the fps.
 	time_t curTime = timeGetTime();
 	if ((curTime - m_lastFpsTimeThing) >= 1000) {
@@ -104,7 +103,7 @@ void FrameMetrics::doPerFrameMetrics(UnsignedInt frame) {
 //			DEBUG_LOG(("FrameMetrics::doPerFrameMetrics - adding %f to fps history. average before: %f ", m_fpsList[m_fpsListIndex], m_averageFps));
 //		}
 		m_averageFps -= ((m_fpsList[m_fpsListIndex])) / TheGlobalData->m_networkFPSHistoryLength; // subtract out the old value from the average.
-		m_fpsList[m_fpsListIndex] = TheDisplay->getAverageFPS();
+		m_fpsList[m_fpsListIndex] = fps;
 //		m_fpsList[m_fpsListIndex] = TheGameClient->getFrame() - m_fpsStartingFrame;
 		m_averageFps += ((Real)(m_fpsList[m_fpsListIndex])) / TheGlobalData->m_networkFPSHistoryLength; // add the new value to the average.
 //		DEBUG_LOG(("average after: %f\n", m_averageFps));
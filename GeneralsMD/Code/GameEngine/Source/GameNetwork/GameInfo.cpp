@@ -330,6 +330,7 @@ void GameInfo::reset( void )
 	m_mapSize = 0;
   m_superweaponRestriction = 0; 
   m_startingCash = TheGlobalData->m_defaultStartingCash;
+	m_compactGameCommands = TheGlobalData->m_networkCompactGameCommands;
   
 	//
 
@@ -940,6 +941,13 @@ AsciiString GameInfoToAsciiString( const GameInfo *game )
 		game->getMapCRC(), game->getMapSize(), game->getSeed(), game->getCRCInterval(), game->getSuperweaponRestriction(),
 		game->getStartingCash().countMoney(), game->oldFactionsOnly() ? 'Y' : 'N' );
 
+	// Only sent when it's on.  Clients that don't know the key refuse the options,
+	// so everyone who gets into the game can read compact game commands.
+	if (game->getCompactGameCommands())
+	{
+		optionsString.concat("CG=1;");
+	}
+
 	//add player info for each slot
 	optionsString.concat(slotListID);
 	optionsString.concat('=');
@@ -1031,6 +1039,7 @@ Bool ParseAsciiStringToGameInfo(GameInfo *game, AsciiString options)
 	Int useStats = TRUE;
   Money startingCash = TheGlobalData->m_defaultStartingCash;
   UnsignedShort restriction = 0; // Always the default
+	Bool compactGameCommands = FALSE;
   
 	Bool sawMap, sawMapCRC, sawMapSize, sawSeed, sawSlotlist, sawUseStats, sawSuperweaponRestriction, sawStartingCash, sawOldFactions;
 	sawMap = sawMapCRC = sawMapSize = sawSeed = sawSlotlist = sawUseStats = sawSuperweaponRestriction = sawStartingCash = sawOldFactions = FALSE;
@@ -1133,6 +1142,10 @@ Bool ParseAsciiStringToGameInfo(GameInfo *game, AsciiString options)
       oldFactionsOnly = ( val.compareNoCase( "Y" ) == 0 );
       sawOldFactions = TRUE;
     }
+		else if (key.compare("CG") == 0)
+		{
+			compactGameCommands = (atoi(val.str()) != 0);
+		}
 		else if (key.getLength() == 1 && *key.str() == slotListID)
 		{
 			sawSlotlist = true;
@@ -1495,6 +1508,7 @@ Bool ParseAsciiStringToGameInfo(GameInfo *game, AsciiString options)
     game->setSuperweaponRestriction(restriction);
     game->setStartingCash( startingCash );
     game->setOldFactionsOnly( oldFactionsOnly );
+		game->setCompactGameCommands( compactGameCommands );
 
 		return true;
 	}
@@ -0,0 +1,304 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+//																																						//
+//  (c) 2001-2003 Electronic Arts Inc.																				//
+//																																						//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file int the GameEngine
+
+#include "GameNetwork/LoopbackNetwork.h"
+
+/**
+ * The constructor.  Links start out perfect: no latency, no loss.
+ */
+LoopbackNetwork::LoopbackNetwork(UnsignedInt seed) {
+	m_defaultSettings.m_latency = 0;
+	m_defaultSettings.m_jitter = 0;
+	m_defaultSettings.m_packetLoss = 0;
+	m_defaultSettings.m_reorder = 0;
+	m_seed = seed;
+	m_nextSequence = 0;
+}
+
+/**
+ * The destructor.
+ */
+LoopbackNetwork::~LoopbackNetwork() {
+	for (DatagramList::iterator it = m_inFlight.begin(); it != m_inFlight.end(); ++it) {
+		delete (*it);
+	}
+	m_inFlight.clear();
+}
+
+void LoopbackNetwork::setDefaultLinkSettings(const LoopbackLinkSettings &settings) {
+	m_defaultSettings = settings;
+	for (LinkVec::iterator it = m_links.begin(); it != m_links.end(); ++it) {
+		it->m_settings = settings;
+	}
+}
+
+void LoopbackNetwork::setLinkSettings(UnsignedInt fromAddr, UnsignedInt toAddr, const LoopbackLinkSettings &settings) {
+	findLink(fromAddr, toAddr)->m_settings = settings;
+}
+
+LoopbackLinkSettings LoopbackNetwork::getLinkSettings(UnsignedInt fromAddr, UnsignedInt toAddr) {
+	return findLink(fromAddr, toAddr)->m_settings;
+}
+
+LoopbackLinkStats LoopbackNetwork::getLinkStats(UnsignedInt fromAddr, UnsignedInt toAddr) {
+	return findLink(fromAddr, toAddr)->m_stats;
+}
+
+LoopbackLinkStats LoopbackNetwork::getTotalStats() {
+	LoopbackLinkStats total;
+	total.m_packets = 0;
+	total.m_bytes = 0;
+	total.m_lost = 0;
+	total.m_reordered = 0;
+	for (LinkVec::iterator it = m_links.begin(); it != m_links.end(); ++it) {
+		total.m_packets += it->m_stats.m_packets;
+		total.m_bytes += it->m_stats.m_bytes;
+		total.m_lost += it->m_stats.m_lost;
+		total.m_reordered += it->m_stats.m_reordered;
+	}
+	return total;
+}
+
+void LoopbackNetwork::resetStats() {
+	for (LinkVec::iterator it = m_links.begin(); it != m_links.end(); ++it) {
+		it->m_stats.m_packets = 0;
+		it->m_stats.m_bytes = 0;
+		it->m_stats.m_lost = 0;
+		it->m_stats.m_reordered = 0;
+	}
+}
+
+LoopbackNetwork::Link * LoopbackNetwork::findLink(UnsignedInt fromAddr, UnsignedInt toAddr) {
+	for (LinkVec::iterator it = m_links.begin(); it != m_links.end(); ++it) {
+		if ((it->m_fromAddr == fromAddr) && (it->m_toAddr == toAddr)) {
+			return &(*it);
+		}
+	}
+
+	Link link;
+	link.m_fromAddr = fromAddr;
+	link.m_toAddr = toAddr;
+	link.m_settings = m_defaultSettings;
+	link.m_stats.m_packets = 0;
+	link.m_stats.m_bytes = 0;
+	link.m_stats.m_lost = 0;
+	link.m_stats.m_reordered = 0;
+	m_links.push_back(link);
+	return &(m_links.back());
+}
+
+Bool LoopbackNetwork::isBound(UnsignedInt addr, UnsignedShort port) {
+	for (EndpointVec::iterator it = m_endpoints.begin(); it != m_endpoints.end(); ++it) {
+		if ((it->m_addr == addr) && (it->m_port == port)) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+Bool LoopbackNetwork::bind(UnsignedInt addr, UnsignedShort port) {
+	if (isBound(addr, port)) {
+		return FALSE;
+	}
+	Endpoint endpoint;
+	endpoint.m_addr = addr;
+	endpoint.m_port = port;
+	m_endpoints.push_back(endpoint);
+	return TRUE;
+}
+
+void LoopbackNetwork::unbind(UnsignedInt addr, UnsignedShort port) {
+	for (EndpointVec::iterator it = m_endpoints.begin(); it != m_endpoints.end(); ++it) {
+		if ((it->m_addr == addr) && (it->m_port == port)) {
+			m_endpoints.erase(it);
+			break;
+		}
+	}
+
+	DatagramList::iterator dit = m_inFlight.begin();
+	while (dit != m_inFlight.end()) {
+		if (((*dit)->m_toAddr == addr) && ((*dit)->m_toPort == port)) {
+			delete (*dit);
+			dit = m_inFlight.erase(dit);
+		} else {
+			++dit;
+		}
+	}
+}
+
+/**
+ * Our own generator, so runs don't depend on (or disturb) the game's random streams.
+ */
+Int LoopbackNetwork::randomValue(Int lo, Int hi) {
+	if (hi <= lo) {
+		return lo;
+	}
+	m_seed = (m_seed * 1103515245) + 12345;
+	return lo + (Int)((m_seed >> 16) % (UnsignedInt)(hi - lo + 1));
+}
+
+/**
+ * Put a datagram on the link.  Like a real socket, this succeeds whether or not the datagram
+ * makes it.
+ */
+Int LoopbackNetwork::send(UnsignedInt fromAddr, UnsignedShort fromPort, UnsignedInt toAddr, UnsignedShort toPort, const unsigned char *buf, UnsignedInt len) {
+	if (len > MAX_MESSAGE_LEN) {
+		return -1;
+	}
+
+	Link *link = findLink(fromAddr, toAddr);
+	++link->m_stats.m_packets;
+	link->m_stats.m_bytes += len;
+
+	if ((link->m_settings.m_packetLoss > 0) && (randomValue(1, 100) <= link->m_settings.m_packetLoss)) {
+		++link->m_stats.m_lost;
+		return len;
+	}
+
+	Int delay = link->m_settings.m_latency + randomValue(-link->m_settings.m_jitter, link->m_settings.m_jitter);
+	if ((link->m_settings.m_reorder > 0) && (randomValue(1, 100) <= link->m_settings.m_reorder)) {
+		delay += link->m_settings.m_latency;
+		++link->m_stats.m_reordered;
+	}
+	if (delay < 0) {
+		delay = 0;
+	}
+
+	Datagram *datagram = NEW Datagram;
+	datagram->m_fromAddr = fromAddr;
+	datagram->m_fromPort = fromPort;
+	datagram->m_toAddr = toAddr;
+	datagram->m_toPort = toPort;
+	datagram->m_deliveryTime = timeGetTime() + delay;
+	datagram->m_sequence = m_nextSequence++;
+	datagram->m_length = len;
+	memcpy(datagram->m_data, buf, len);
+	m_inFlight.push_back(datagram);
+
+	return len;
+}
+
+/**
+ * Take the datagram for this endpoint that arrived first, if any have arrived.
+ */
+Int LoopbackNetwork::receive(UnsignedInt addr, UnsignedShort port, unsigned char *buf, UnsignedInt len, UnsignedInt &fromAddr, UnsignedShort &fromPort) {
+	UnsignedInt now = timeGetTime();
+	DatagramList::iterator best = m_inFlight.end();
+
+	for (DatagramList::iterator it = m_inFlight.begin(); it != m_inFlight.end(); ++it) {
+		Datagram *datagram = *it;
+		if ((datagram->m_toAddr != addr) || (datagram->m_toPort != port) || ((Int)(now - datagram->m_deliveryTime) < 0)) {
+			continue;
+		}
+		if ((best == m_inFlight.end()) ||
+				((Int)(datagram->m_deliveryTime - (*best)->m_deliveryTime) < 0) ||
+				((datagram->m_deliveryTime == (*best)->m_deliveryTime) && (datagram->m_sequence < (*best)->m_sequence))) {
+			best = it;
+		}
+	}
+
+	if (best == m_inFlight.end()) {
+		return 0;
+	}
+
+	Datagram *datagram = *best;
+	m_inFlight.erase(best);
+
+	UnsignedInt copyLen = datagram->m_length;
+	if (copyLen > len) {
+		copyLen = len; // truncated, just like recvfrom would
+	}
+	memcpy(buf, datagram->m_data, copyLen);
+	fromAddr = datagram->m_fromAddr;
+	fromPort = datagram->m_fromPort;
+
+	delete datagram;
+	return copyLen;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+LoopbackUDP::LoopbackUDP(LoopbackNetwork *network) : UDP() {
+	m_network = network;
+	m_addr = 0;
+	m_port = 0;
+	m_isBound = FALSE;
+}
+
+LoopbackUDP::~LoopbackUDP() {
+	if (m_isBound) {
+		m_network->unbind(m_addr, m_port);
+	}
+}
+
+Int LoopbackUDP::Bind(UnsignedInt IP, UnsignedShort port) {
+	if (m_isBound) {
+		m_network->unbind(m_addr, m_port);
+		m_isBound = FALSE;
+	}
+	if (!m_network->bind(IP, port)) {
+		return ADDRINUSE;
+	}
+	m_addr = IP;
+	m_port = port;
+	m_isBound = TRUE;
+	return OK;
+}
+
+Int LoopbackUDP::Write(const unsigned char *msg, UnsignedInt len, UnsignedInt IP, UnsignedShort port) {
+	if ((IP == 0) || (port == 0)) {
+		return ADDRNOTAVAIL;
+	}
+	return m_network->send(m_addr, m_port, IP, port, msg, len);
+}
+
+Int LoopbackUDP::Read(unsigned char *msg, UnsignedInt len, sockaddr_in *from) {
+	UnsignedInt fromAddr = 0;
+	UnsignedShort fromPort = 0;
+	Int retval = m_network->receive(m_addr, m_port, msg, len, fromAddr, fromPort);
+	if ((retval > 0) && (from != NULL)) {
+		memset(from, 0, sizeof(sockaddr_in));
+		from->sin_family = AF_INET;
+		from->sin_addr.s_addr = htonl(fromAddr);
+		from->sin_port = htons(fromPort);
+	}
+	return retval;
+}
+
+UDP::sockStat LoopbackUDP::GetStatus(void) {
+	return OK;
+}
@@ -38,13 +38,20 @@
 #include "GameNetwork/NetCommandList.h"
 #include "GameNetwork/NetworkUtil.h"
 
+enum { MIN_SORTED_SIZE = 8, MIN_ID_HASH_SIZE = 16 };
+
 /**
  * Constructor.
  */
 NetCommandList::NetCommandList() {
 	m_first = NULL;
 	m_last = NULL;
-	m_lastMessageInserted = NULL;
+	m_count = 0;
+	m_sorted = NULL;
+	m_sortedSize = 0;
+	m_idHash = NULL;
+	m_idHashSize = 0;
+	m_idHashCount = 0;
 }
 
 /**
@@ -52,6 +59,15 @@ NetCommandList::NetCommandList() {
  */
 NetCommandList::~NetCommandList() {
 	reset();
+
+	if (m_sorted != NULL) {
+		delete[] m_sorted;
+		m_sorted = NULL;
+	}
+	if (m_idHash != NULL) {
+		delete[] m_idHash;
+		m_idHash = NULL;
+	}
 }
 
 /**
@@ -87,8 +103,17 @@ NetCommandRef *NetCommandList::getFirstMessage() {
  * Remove the given message from this list.
  */
 void NetCommandList::removeMessage(NetCommandRef *msg) {
-	if (m_lastMessageInserted == msg) {
-		m_lastMessageInserted = msg->getNext();
+	Int index = findIndex(msg);
+	if (index == -1) {
+		DEBUG_CRASH(("NetCommandList::removeMessage - message isn't on this list"));
+		return;
+	}
+
+	--m_count;
+	memmove(m_sorted + index, m_sorted + index + 1, (m_count - index) * sizeof(NetCommandRef *));
+
+	if (DoesCommandRequireACommandID(msg->getCommand()->getNetCommandType())) {
+		hashRemove(msg);
 	}
 
 	if (msg->getPrev() != NULL) {
@@ -117,7 +142,8 @@ void NetCommandList::init() {
 }
 
 /**
- * Reset the contents of this list.
+ * Reset the contents of this list.  Hang on to the index storage, since the lists get reused
+ * frame after frame.
  */
 void NetCommandList::reset() {
 	NetCommandRef *temp = m_first;
@@ -129,12 +155,18 @@ void NetCommandList::reset() {
 		m_first = temp;
 	}
 	m_last = NULL;
-	m_lastMessageInserted = NULL;
+	m_count = 0;
+
+	for (Int i = 0; i < m_idHashSize; ++i) {
+		m_idHash[i] = NULL;
+	}
+	m_idHashCount = 0;
 }
 
 /**
- * Insert sorts msg.  Assumes that all the previous message inserts were done using this function.
- * The message is sorted in based first on command type, then player id, and then command id.
+ * Insert sorts msg.  The message is sorted in based first on command type, then player id, and
+ * then command id.  A message equal to one already on the list (see isEqualCommandMsg) isn't
+ * added, and NULL is returned.
  */
 NetCommandRef * NetCommandList::addMessage(NetCommandMsg *cmdMsg) {
 	if (cmdMsg == NULL) {
@@ -142,242 +174,250 @@ NetCommandRef * NetCommandList::addMessage(NetCommandMsg *cmdMsg) {
 		return NULL;
 	}
 
-//	UnsignedInt id = cmdMsg->getID();
-
-	NetCommandRef *msg = NEW_NETCOMMANDREF(cmdMsg);
-
-	if (m_first == NULL) {
-		// this is the first node, so we don't have to worry about ordering it.
-		m_first = msg;
-		m_last = msg;
-		m_lastMessageInserted = msg;
-		return msg;
+	// Make sure this command isn't already in the list.
+	Bool requiresID = DoesCommandRequireACommandID(cmdMsg->getNetCommandType());
+	if (requiresID) {
+		if (hashFind(cmdMsg->getID(), cmdMsg->getPlayerID()) != NULL) {
+			return NULL;
+		}
 	}
 
-	if (m_lastMessageInserted != NULL) {
-		// Messages that are inserted in order should just be put in one right after the other.
-		// So saving the placement of the last message inserted can give us a huge boost in
-		// efficiency.
-		NetCommandRef *theNext = m_lastMessageInserted->getNext();
-		if ((m_lastMessageInserted->getCommand()->getNetCommandType() == msg->getCommand()->getNetCommandType()) &&
-			(m_lastMessageInserted->getCommand()->getPlayerID() == msg->getCommand()->getPlayerID()) &&
-			(m_lastMessageInserted->getCommand()->getID() < msg->getCommand()->getID()) &&
-			((theNext == NULL) || ((theNext->getCommand()->getNetCommandType() > msg->getCommand()->getNetCommandType()) ||
-			 (theNext->getCommand()->getPlayerID() > msg->getCommand()->getPlayerID()) ||
-			 (theNext->getCommand()->getID() > msg->getCommand()->getID())))) {
-
-			// Make sure this command isn't already in the list.
-			if (isEqualCommandMsg(m_lastMessageInserted->getCommand(), msg->getCommand())) {
-
-				// This command is already in the list, don't duplicate it.
-				msg->deleteInstance();
-				msg = NULL;
-				return NULL;
-			}
+	Int index = findInsertIndex(cmdMsg);
 
-			if (theNext == NULL) {
-				// this means that m_lastMessageInserted == m_last, so m_last should point to the msg that is being inserted.
-				msg->setNext(m_lastMessageInserted->getNext());
-				msg->setPrev(m_lastMessageInserted);
-				m_lastMessageInserted->setNext(msg);
-				m_lastMessageInserted = msg;
-				m_last = msg;
-			} else {
-				msg->setNext(m_lastMessageInserted->getNext());
-				msg->setPrev(m_lastMessageInserted);
-				m_lastMessageInserted->setNext(msg);
-				msg->getNext()->setPrev(msg);
-				m_lastMessageInserted = msg;
+	if (!requiresID) {
+		// Anything it could be equal to sorts the same as it does, so it would be right here.
+		for (Int i = index; (i < m_count) && (compareCommands(m_sorted[i]->getCommand(), cmdMsg) == 0); ++i) {
+			if (isEqualCommandMsg(m_sorted[i]->getCommand(), cmdMsg)) {
+				return NULL;
 			}
-			return msg;
 		}
 	}
-	
-	if (msg->getCommand()->getNetCommandType() > m_last->getCommand()->getNetCommandType()) {
-		// easy optimization for a command that goes at the end of the list
-		// since they are likely to be added in order.
 
-		// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(m_last->getCommand(), msg->getCommand())) {
+	NetCommandRef *msg = NEW_NETCOMMANDREF(cmdMsg);
 
-			// This command is already in the list, don't duplicate it.
-			msg->deleteInstance();
-			msg = NULL;
-			return NULL;
-		}
+	if (m_count == m_sortedSize) {
+		growSorted();
+	}
+	memmove(m_sorted + index + 1, m_sorted + index, (m_count - index) * sizeof(NetCommandRef *));
+	m_sorted[index] = msg;
+	++m_count;
 
+	if (requiresID) {
+		hashInsert(msg);
+	}
+
+	if (index == m_count - 1) {
+		// message goes at the end of the list.
 		msg->setPrev(m_last);
 		msg->setNext(NULL);
-		m_last->setNext(msg);
+		if (m_last != NULL) {
+			m_last->setNext(msg);
+		} else {
+			m_first = msg;
+		}
 		m_last = msg;
-		m_lastMessageInserted = msg;
 		return msg;
 	}
-	
-	if (msg->getCommand()->getNetCommandType() < m_first->getCommand()->getNetCommandType()) {
-		// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(m_first->getCommand(), msg->getCommand())) {
 
-			// This command is already in the list, don't duplicate it.
-			msg->deleteInstance();
-			msg = NULL;
-			return NULL;
-		}
-
-		// The command goes at the head of the list.
-		msg->setNext(m_first);
-		msg->setPrev(NULL);
-		m_first->setPrev(msg);
+	// Insert message before the one it displaced in m_sorted.
+	NetCommandRef *tempmsg = m_sorted[index + 1];
+	msg->setNext(tempmsg);
+	msg->setPrev(tempmsg->getPrev());
+	if (msg->getPrev() != NULL) {
+		msg->getPrev()->setNext(msg);
+	} else {
 		m_first = msg;
-		m_lastMessageInserted = msg;
-		return msg;
-	}
-	
-	
-	// Find the start of the command type we're looking for.
-	NetCommandRef *tempmsg = m_first;
-	while ((tempmsg != NULL) && (msg->getCommand()->getNetCommandType() > tempmsg->getCommand()->getNetCommandType())) {
-		tempmsg = tempmsg->getNext();
 	}
+	tempmsg->setPrev(msg);
 
-	if (tempmsg == NULL) {
-		// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(m_last->getCommand(), msg->getCommand())) {
+	return msg;
+}
 
-			// This command is already in the list, don't duplicate it.
-			msg->deleteInstance();
-			msg = NULL;
-			return NULL;
-		}
+Int NetCommandList::length() {
+	return m_count;
+}
 
-		// message goes at the end of the list.
-		msg->setPrev(m_last);
-		msg->setNext(NULL);
-		m_last->setNext(msg);
-		m_last = msg;
-		m_lastMessageInserted = msg;
-		return msg;
+/**
+ * Find a message equal to msg (see isEqualCommandMsg).
+ */
+NetCommandRef * NetCommandList::findMessage(NetCommandMsg *msg) {
+	if (DoesCommandRequireACommandID(msg->getNetCommandType())) {
+		return hashFind(msg->getID(), msg->getPlayerID());
 	}
 
-	// Now find the player position.  munkee.
-	while ((tempmsg != NULL) && (msg->getCommand()->getNetCommandType() == tempmsg->getCommand()->getNetCommandType()) && (msg->getCommand()->getPlayerID() > tempmsg->getCommand()->getPlayerID())) {
-		tempmsg = tempmsg->getNext();
+	for (Int i = findInsertIndex(msg); (i < m_count) && (compareCommands(m_sorted[i]->getCommand(), msg) == 0); ++i) {
+		if (isEqualCommandMsg(m_sorted[i]->getCommand(), msg)) {
+			return m_sorted[i];
+		}
 	}
+	return NULL;
+}
 
-	if (tempmsg == NULL) {
-		// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(m_last->getCommand(), msg->getCommand())) {
-
-			// This command is already in the list, don't duplicate it.
-			msg->deleteInstance();
-			msg = NULL;
-			return NULL;
-		}
+/**
+ * Only finds messages of types that require a command ID.
+ */
+NetCommandRef * NetCommandList::findMessage(UnsignedShort commandID, UnsignedByte playerID) {
+	return hashFind(commandID, playerID);
+}
 
-		// message goes at the end of the list.
-		msg->setPrev(m_last);
-		msg->setNext(NULL);
-		m_last->setNext(msg);
-		m_last = msg;
-		m_lastMessageInserted = msg;
-		return msg;
+Int NetCommandList::compareCommands(NetCommandMsg *msg1, NetCommandMsg *msg2) {
+	if (msg1->getNetCommandType() != msg2->getNetCommandType()) {
+		return (msg1->getNetCommandType() < msg2->getNetCommandType()) ? -1 : 1;
 	}
-
-	// Find the position within the player's section based on the command ID.
-	// If the command type doesn't require a command ID, sort by whatever it should be sorted by.
-	while ((tempmsg != NULL) && (msg->getCommand()->getNetCommandType() == tempmsg->getCommand()->getNetCommandType()) && (msg->getCommand()->getPlayerID() == tempmsg->getCommand()->getPlayerID()) && (msg->getCommand()->getSortNumber() > tempmsg->getCommand()->getSortNumber())) {
-		tempmsg = tempmsg->getNext();
+	if (msg1->getPlayerID() != msg2->getPlayerID()) {
+		return (msg1->getPlayerID() < msg2->getPlayerID()) ? -1 : 1;
 	}
+	Int sort1 = msg1->getSortNumber();
+	Int sort2 = msg2->getSortNumber();
+	if (sort1 != sort2) {
+		return (sort1 < sort2) ? -1 : 1;
+	}
+	return 0;
+}
 
-	if (tempmsg == NULL) {
-		// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(m_last->getCommand(), msg->getCommand())) {
+/**
+ * Binary search m_sorted.  Commands are added in order most of the time, so check the end first.
+ */
+Int NetCommandList::findInsertIndex(NetCommandMsg *msg) {
+	if ((m_count == 0) || (compareCommands(m_sorted[m_count - 1]->getCommand(), msg) < 0)) {
+		return m_count;
+	}
 
-			// This command is already in the list, don't duplicate it.
-			msg->deleteInstance();
-			msg = NULL;
-			return NULL;
+	Int lo = 0;
+	Int hi = m_count - 1;
+	while (lo < hi) {
+		Int mid = (lo + hi) / 2;
+		if (compareCommands(m_sorted[mid]->getCommand(), msg) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
-
-		// This message goes at the end of the list.
-		msg->setPrev(m_last);
-		msg->setNext(NULL);
-		m_last->setNext(msg);
-		m_last = msg;
-		m_lastMessageInserted = msg;
-		return msg;
 	}
+	return lo;
+}
 
-	if (tempmsg == m_first) {
-		// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(m_first->getCommand(), msg->getCommand())) {
+Int NetCommandList::findIndex(NetCommandRef *ref) {
+	Int i;
+	for (i = findInsertIndex(ref->getCommand()); (i < m_count) && (compareCommands(m_sorted[i]->getCommand(), ref->getCommand()) == 0); ++i) {
+		if (m_sorted[i] == ref) {
+			return i;
+		}
+	}
 
-			// This command is already in the list, don't duplicate it.
-			msg->deleteInstance();
-			return NULL;
+	// Somebody changed the command since it was added.
+	for (i = 0; i < m_count; ++i) {
+		if (m_sorted[i] == ref) {
+			return i;
 		}
+	}
+	return -1;
+}
 
-		// This message goes at the head of the list.
-		msg->setNext(m_first);
-		msg->setPrev(NULL);
-		m_first->setPrev(msg);
-		m_first = msg;
-		m_lastMessageInserted = msg;
-		return msg;
+void NetCommandList::growSorted() {
+	Int newSize = (m_sortedSize == 0) ? MIN_SORTED_SIZE : m_sortedSize * 2;
+	NetCommandRef **newSorted = NEW NetCommandRef *[newSize];
+	if (m_sorted != NULL) {
+		memcpy(newSorted, m_sorted, m_count * sizeof(NetCommandRef *));
+		delete[] m_sorted;
 	}
+	m_sorted = newSorted;
+	m_sortedSize = newSize;
+}
 
-	// Make sure this command isn't already in the list.
-		if (isEqualCommandMsg(tempmsg->getCommand(), msg->getCommand())) {
+UnsignedInt NetCommandList::hashSlot(UnsignedShort commandID, UnsignedByte playerID) {
+	UnsignedInt key = ((UnsignedInt)playerID << 16) | commandID;
+	return (key * 2654435761U) >> 16;
+}
 
-		// This command is already in the list, don't duplicate it.
-		msg->deleteInstance();
-		msg = NULL;
+NetCommandRef * NetCommandList::hashFind(UnsignedShort commandID, UnsignedByte playerID) {
+	if (m_idHashCount == 0) {
 		return NULL;
 	}
 
-	// Insert message before tempmsg.
-	msg->setNext(tempmsg);
-	msg->setPrev(tempmsg->getPrev());
-	msg->getPrev()->setNext(msg);
-	tempmsg->setPrev(msg);
-	m_lastMessageInserted = msg;
-
-	return msg;
+	UnsignedInt mask = m_idHashSize - 1;
+	for (UnsignedInt slot = hashSlot(commandID, playerID) & mask; m_idHash[slot] != NULL; slot = (slot + 1) & mask) {
+		NetCommandMsg *cmd = m_idHash[slot]->getCommand();
+		if ((cmd->getID() == commandID) && (cmd->getPlayerID() == playerID)) {
+			return m_idHash[slot];
+		}
+	}
+	return NULL;
 }
 
-Int NetCommandList::length() {
-	Int retval = 0;
-	NetCommandRef *temp = m_first;
-	while (temp != NULL) {
-		++retval;
-		temp = temp->getNext();
+void NetCommandList::hashInsert(NetCommandRef *ref) {
+	if ((m_idHashCount + 1) * 2 > m_idHashSize) {
+		rehash((m_idHashSize == 0) ? MIN_ID_HASH_SIZE : m_idHashSize * 2);
 	}
-	return retval;
+
+	UnsignedInt mask = m_idHashSize - 1;
+	UnsignedInt slot = hashSlot(ref->getCommand()->getID(), ref->getCommand()->getPlayerID()) & mask;
+	while (m_idHash[slot] != NULL) {
+		slot = (slot + 1) & mask;
+	}
+	m_idHash[slot] = ref;
+	++m_idHashCount;
 }
 
 /**
- * This is really inefficient, but we can probably get away with it because
- * there shouldn't be too many messages for any given frame.
+ * Take ref out and shift back anything after it in its probe run that would otherwise be cut off.
  */
-NetCommandRef * NetCommandList::findMessage(NetCommandMsg *msg) {
-	NetCommandRef *retval = m_first;
-	while ((retval != NULL) && (isEqualCommandMsg(retval->getCommand(), msg) == FALSE)) {
-		retval = retval->getNext();
+void NetCommandList::hashRemove(NetCommandRef *ref) {
+	if (m_idHashCount == 0) {
+		return;
+	}
+
+	UnsignedInt mask = m_idHashSize - 1;
+	UnsignedInt slot = hashSlot(ref->getCommand()->getID(), ref->getCommand()->getPlayerID()) & mask;
+	while ((m_idHash[slot] != NULL) && (m_idHash[slot] != ref)) {
+		slot = (slot + 1) & mask;
+	}
+	if (m_idHash[slot] == NULL) {
+		// Somebody changed the command since it was added.
+		for (slot = 0; (slot < (UnsignedInt)m_idHashSize) && (m_idHash[slot] != ref); ++slot) {
+		}
+		if (slot == (UnsignedInt)m_idHashSize) {
+			return;
+		}
+	}
+
+	m_idHash[slot] = NULL;
+	--m_idHashCount;
+
+	UnsignedInt next = (slot + 1) & mask;
+	while (m_idHash[next] != NULL) {
+		NetCommandMsg *cmd = m_idHash[next]->getCommand();
+		UnsignedInt home = hashSlot(cmd->getID(), cmd->getPlayerID()) & mask;
+		// Move it back if its home isn't cyclically within (slot, next].
+		if (((next - home) & mask) >= ((next - slot) & mask)) {
+			m_idHash[slot] = m_idHash[next];
+			m_idHash[next] = NULL;
+			slot = next;
+		}
+		next = (next + 1) & mask;
 	}
-	return retval;
 }
 
-NetCommandRef * NetCommandList::findMessage(UnsignedShort commandID, UnsignedByte playerID) {
-	NetCommandRef *retval = m_first;
-	while (retval != NULL) {
-		if (DoesCommandRequireACommandID(retval->getCommand()->getNetCommandType())) {
-			if ((retval->getCommand()->getID() == commandID) && (retval->getCommand()->getPlayerID() == playerID)) {
-				return retval;
-			}
+void NetCommandList::rehash(Int size) {
+	NetCommandRef **oldHash = m_idHash;
+	Int oldSize = m_idHashSize;
+
+	m_idHash = NEW NetCommandRef *[size];
+	m_idHashSize = size;
+	m_idHashCount = 0;
+	Int i;
+	for (i = 0; i < size; ++i) {
+		m_idHash[i] = NULL;
+	}
+
+	for (i = 0; i < oldSize; ++i) {
+		if (oldHash[i] != NULL) {
+			hashInsert(oldHash[i]);
 		}
-		retval = retval->getNext();
 	}
-	return retval;
+
+	if (oldHash != NULL) {
+		delete[] oldHash;
+	}
 }
 
 Bool NetCommandList::isEqualCommandMsg(NetCommandMsg *msg1, NetCommandMsg *msg2) {
@@ -38,7 +38,7 @@
 #include "GameNetwork/NetCommandRef.h"
 
 #ifdef DEBUG_NETCOMMANDREF
-static UnsignedInt refNum = 0;
+static LONG refNum = 0;	///< the relay server makes refs on several threads
 #endif
 
 /**
@@ -57,7 +57,7 @@ NetCommandRef::NetCommandRef(NetCommandMsg *msg)
 	m_timeLastSent = -1;
 
 #ifdef DEBUG_NETCOMMANDREF
-	m_id = ++refNum;
+	m_id = InterlockedIncrement(&refNum);
 	DEBUG_LOG(("NetCommandRef %d allocated in file %s line %d\n", m_id, filename, line));
 #endif
 }
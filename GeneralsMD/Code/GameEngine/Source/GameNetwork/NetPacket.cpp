@@ -48,6 +48,78 @@
 //#pragma MESSAGE("************************************** WARNING, optimization disabled for debugging purposes")
 #endif
 
+Bool NetPacket::s_compactGameCommands = FALSE;
+
+// Compact game commands store integers as base 128 varints, low bits first.
+// Signed values are zig-zagged first so small negative deltas stay small.
+// The put functions return FALSE rather than write past the end of a packet.
+static Bool putByte(UnsignedByte *buffer, Int &offset, UnsignedByte value)
+{
+	if (offset >= MAX_PACKET_SIZE) {
+		return FALSE;
+	}
+	buffer[offset] = value;
+	++offset;
+	return TRUE;
+}
+
+static Bool putBytes(UnsignedByte *buffer, Int &offset, const void *data, Int len)
+{
+	if (offset + len > MAX_PACKET_SIZE) {
+		return FALSE;
+	}
+	memcpy(buffer + offset, data, len);
+	offset += len;
+	return TRUE;
+}
+
+static Bool putVarInt(UnsignedByte *buffer, Int &offset, UnsignedInt value)
+{
+	do {
+		UnsignedByte b = (UnsignedByte)(value & 0x7f);
+		value >>= 7;
+		if (value != 0) {
+			b |= 0x80;
+		}
+		if (!putByte(buffer, offset, b)) {
+			return FALSE;
+		}
+	} while (value != 0);
+	return TRUE;
+}
+
+static UnsignedInt getVarInt(UnsignedByte *data, Int &i)
+{
+	UnsignedInt value = 0;
+	Int shift = 0;
+	UnsignedByte b = 0;
+	do {
+		b = data[i];
+		++i;
+		value |= (UnsignedInt)(b & 0x7f) << shift;
+		shift += 7;
+	} while ((b & 0x80) && (shift < 35));
+	return value;
+}
+
+static UnsignedInt zigZag(Int value)
+{
+	return ((UnsignedInt)value << 1) ^ (UnsignedInt)(value >> 31);
+}
+
+static Int unZigZag(UnsignedInt value)
+{
+	return (Int)(value >> 1) ^ -(Int)(value & 1);
+}
+
+void NetPacket::SetCompactGameCommands(Bool compact) {
+	s_compactGameCommands = compact;
+}
+
+Bool NetPacket::GetCompactGameCommands() {
+	return s_compactGameCommands;
+}
+
 // This function assumes that all of the fields are either of default value or are
 // present in the raw data.
 NetCommandRef * NetPacket::ConstructNetCommandMsgFromRawData(UnsignedByte *data, UnsignedShort dataLength) {
@@ -1951,6 +2023,8 @@ void NetPacket::init() {
 	m_lastCommandID = 0;
 	m_lastCommandType = 0;
 	m_lastRelay = 0;
+	m_lastObjectID = INVALID_ID;
+	m_lastArgumentLayout = -1;
 
 	m_lastCommand = NULL;
 }
@@ -4710,7 +4784,13 @@ Bool NetPacket::addGameCommand(NetCommandRef *msg) {
 
 //	DEBUG_LOG(("NetPacket::addGameCommand for command ID %d\n", cmdMsg->getID()));
 
-	if (isRoomForGameMessage(msg, gmsg)) {
+	if (s_compactGameCommands) {
+		retval = addCompactGameCommand(msg, gmsg);
+	}
+
+	// A command full of large deltas can come out smaller at full width, so try
+	// that before giving up on this packet.
+	if (!retval && isRoomForGameMessage(msg, gmsg)) {
 		// Now we know there is enough room, put the new game message into the packet.
 
 		Bool needNewCommandID = FALSE; // this is to allow us to force the starting command ID to be respecified with this command.
@@ -4865,6 +4945,167 @@ void NetPacket::writeGameMessageArgumentToPacket(GameMessageArgumentDataType typ
 	}
 }
 
+/**
+ * Adds a game command using the compact encoding.  The header fields work the
+ * same way as in addGameCommand, except that the frame and command ID are
+ * varint deltas ('f' and 'c') against the values the reader already has, and
+ * the data section is marked with 'G' instead of 'D':
+ *
+ *   varint    (GameMessage::Type << 1) | 1 if the argument layout is the same
+ *             as the previous compact game command in this packet
+ *   layout    number of argument types, then type and count pairs (omitted if
+ *             it is the same as the previous one)
+ *   arguments integers and ids as varints, object ids as deltas from the
+ *             previous object id in the packet, everything else at full width
+ *
+ * Nothing is changed unless the whole command fits.
+ */
+Bool NetPacket::addCompactGameCommand(NetCommandRef *msg, GameMessage *gmsg) {
+	NetGameCommandMsg *cmdMsg = (NetGameCommandMsg *)(msg->getCommand());
+	Int offset = m_packetLen;
+	Bool fits = TRUE;
+
+	if (m_lastCommandType != cmdMsg->getNetCommandType()) {
+		fits = fits && putByte(m_packet, offset, 'T');
+		fits = fits && putByte(m_packet, offset, cmdMsg->getNetCommandType());
+	}
+
+	if (m_lastFrame != cmdMsg->getExecutionFrame()) {
+		Int frameDelta = (Int)(cmdMsg->getExecutionFrame() - m_lastFrame);
+		fits = fits && putByte(m_packet, offset, 'f');
+		fits = fits && putVarInt(m_packet, offset, zigZag(frameDelta));
+	}
+
+	if (m_lastRelay != msg->getRelay()) {
+		fits = fits && putByte(m_packet, offset, 'R');
+		fits = fits && putByte(m_packet, offset, msg->getRelay());
+	}
+
+	if (m_lastPlayerID != cmdMsg->getPlayerID()) {
+		fits = fits && putByte(m_packet, offset, 'P');
+		fits = fits && putByte(m_packet, offset, cmdMsg->getPlayerID());
+	}
+
+	// The reader keeps counting command IDs across player changes, so unlike
+	// the full width encoding there is no need to respecify it for a new player.
+	UnsignedShort nextCommandID = m_lastCommandID + 1;
+	if (nextCommandID != (UnsignedShort)(cmdMsg->getID())) {
+		Int idDelta = (Short)((UnsignedShort)(cmdMsg->getID()) - nextCommandID);
+		fits = fits && putByte(m_packet, offset, 'c');
+		fits = fits && putVarInt(m_packet, offset, zigZag(idDelta));
+	}
+
+	fits = fits && putByte(m_packet, offset, 'G');
+
+	GameMessageParser *parser = newInstance(GameMessageParser)(gmsg);
+	Bool sameLayout = isSameArgumentLayout(parser, m_lastArgumentLayout);
+	UnsignedInt header = ((UnsignedInt)(gmsg->getType()) << 1) | (sameLayout ? 1 : 0);
+	fits = fits && putVarInt(m_packet, offset, header);
+
+	Int layout = m_lastArgumentLayout;
+	if (!sameLayout) {
+		layout = offset;
+		fits = fits && putByte(m_packet, offset, (UnsignedByte)(parser->getNumTypes()));
+
+		GameMessageParserArgumentType *argType = parser->getFirstArgumentType();
+		while (fits && (argType != NULL)) {
+			fits = putByte(m_packet, offset, (UnsignedByte)(argType->getType()));
+			fits = fits && putByte(m_packet, offset, (UnsignedByte)(argType->getArgCount()));
+			argType = argType->getNext();
+		}
+	}
+
+	parser->deleteInstance();
+	parser = NULL;
+
+	ObjectID lastObjectID = m_lastObjectID;
+	Int numArgs = gmsg->getArgumentCount();
+	for (Int i = 0; fits && (i < numArgs); ++i) {
+		fits = writeCompactGameMessageArgument(gmsg->getArgumentDataType(i), *(gmsg->getArgument(i)), offset, lastObjectID);
+	}
+
+	if (!fits) {
+		return FALSE;
+	}
+
+	m_packetLen = offset;
+	m_lastCommandType = cmdMsg->getNetCommandType();
+	m_lastFrame = cmdMsg->getExecutionFrame();
+	m_lastRelay = msg->getRelay();
+	m_lastPlayerID = cmdMsg->getPlayerID();
+	m_lastCommandID = cmdMsg->getID();
+	m_lastObjectID = lastObjectID;
+	m_lastArgumentLayout = layout;
+
+	++m_numCommands;
+
+	if (m_lastCommand != NULL) {
+		m_lastCommand->deleteInstance();
+		m_lastCommand = NULL;
+	}
+	m_lastCommand = NEW_NETCOMMANDREF(msg->getCommand());
+	m_lastCommand->setRelay(msg->getRelay());
+
+	return TRUE;
+}
+
+/**
+ * Returns true if the argument layout written at the given offset matches the one
+ * for this parser.
+ */
+Bool NetPacket::isSameArgumentLayout(GameMessageParser *parser, Int offset) {
+	if ((offset < 0) || (offset >= m_packetLen)) {
+		return FALSE;
+	}
+	if (m_packet[offset] != (UnsignedByte)(parser->getNumTypes())) {
+		return FALSE;
+	}
+	++offset;
+
+	GameMessageParserArgumentType *argType = parser->getFirstArgumentType();
+	while (argType != NULL) {
+		if (offset + 2 > m_packetLen) {
+			return FALSE;
+		}
+		if ((m_packet[offset] != (UnsignedByte)(argType->getType())) || (m_packet[offset + 1] != (UnsignedByte)(argType->getArgCount()))) {
+			return FALSE;
+		}
+		offset += 2;
+		argType = argType->getNext();
+	}
+	return TRUE;
+}
+
+Bool NetPacket::writeCompactGameMessageArgument(GameMessageArgumentDataType type, GameMessageArgumentType arg, Int &offset, ObjectID &lastObjectID) {
+	if (type == ARGUMENTDATATYPE_INTEGER) {
+		return putVarInt(m_packet, offset, zigZag(arg.integer));
+	} else if (type == ARGUMENTDATATYPE_REAL) {
+		return putBytes(m_packet, offset, &(arg.real), sizeof(arg.real));
+	} else if (type == ARGUMENTDATATYPE_BOOLEAN) {
+		return putByte(m_packet, offset, arg.boolean ? 1 : 0);
+	} else if (type == ARGUMENTDATATYPE_OBJECTID) {
+		Int delta = (Int)(arg.objectID) - (Int)lastObjectID;
+		lastObjectID = arg.objectID;
+		return putVarInt(m_packet, offset, zigZag(delta));
+	} else if (type == ARGUMENTDATATYPE_DRAWABLEID) {
+		return putVarInt(m_packet, offset, (UnsignedInt)(arg.drawableID));
+	} else if (type == ARGUMENTDATATYPE_TEAMID) {
+		return putVarInt(m_packet, offset, arg.teamID);
+	} else if (type == ARGUMENTDATATYPE_LOCATION) {
+		return putBytes(m_packet, offset, &(arg.location), sizeof(arg.location));
+	} else if (type == ARGUMENTDATATYPE_PIXEL) {
+		return putVarInt(m_packet, offset, zigZag(arg.pixel.x)) && putVarInt(m_packet, offset, zigZag(arg.pixel.y));
+	} else if (type == ARGUMENTDATATYPE_PIXELREGION) {
+		return putVarInt(m_packet, offset, zigZag(arg.pixelRegion.lo.x)) && putVarInt(m_packet, offset, zigZag(arg.pixelRegion.lo.y))
+			&& putVarInt(m_packet, offset, zigZag(arg.pixelRegion.hi.x)) && putVarInt(m_packet, offset, zigZag(arg.pixelRegion.hi.y));
+	} else if (type == ARGUMENTDATATYPE_TIMESTAMP) {
+		return putVarInt(m_packet, offset, arg.timestamp);
+	} else if (type == ARGUMENTDATATYPE_WIDECHAR) {
+		return putVarInt(m_packet, offset, (UnsignedInt)(arg.wChar));
+	}
+	return TRUE;
+}
+
 /**
  * Returns true if there is enough room in this packet for this message.
  */
@@ -4953,6 +5194,8 @@ NetCommandList * NetPacket::getCommandList() {
 	UnsignedShort commandID = 1; // The first command is going to be
 	UnsignedByte commandType = 0;
 	UnsignedByte relay = 0;
+	ObjectID lastObjectID = INVALID_ID;
+	Int lastArgumentLayout = -1;
 	NetCommandRef *lastCommand = NULL;
 
 	Int i = 0;
@@ -4977,17 +5220,31 @@ NetCommandList * NetPacket::getCommandList() {
 			++i;
 			memcpy(&commandID, m_packet + i, sizeof(UnsignedShort));
 			i += sizeof(UnsignedShort);
-		} else if (m_packet[i] == 'D') {
+		} else if (m_packet[i] == 'f') {
+			++i;
+			frame += unZigZag(getVarInt(m_packet, i));
+		} else if (m_packet[i] == 'c') {
+			++i;
+			commandID += (UnsignedShort)(unZigZag(getVarInt(m_packet, i)));
+		} else if ((m_packet[i] == 'D') || (m_packet[i] == 'G')) {
+			// 'G' is the data section of a compact game command.
+			Bool compact = (m_packet[i] == 'G');
 			++i;
 
 			NetCommandMsg *msg = NULL;
 
+			DEBUG_ASSERTCRASH(!compact || (commandType == NETCOMMANDTYPE_GAMECOMMAND), ("Compact data section on a command of type %d", commandType));
+
 			//DEBUG_LOG(("NetPacket::getCommandList() - command of type %d(%s)\n", commandType, GetAsciiNetCommandType((NetCommandType)commandType).str()));
 
 			switch((NetCommandType)commandType)
 			{
 			case NETCOMMANDTYPE_GAMECOMMAND:
-				msg = readGameMessage(m_packet, i);
+				if (compact) {
+					msg = readCompactGameMessage(m_packet, i, lastArgumentLayout, lastObjectID);
+				} else {
+					msg = readGameMessage(m_packet, i);
+				}
 				//DEBUG_LOG(("read game command from player %d for frame %d\n", playerID, frame));
 				break;
 			case NETCOMMANDTYPE_ACKBOTH:
@@ -5355,6 +5612,114 @@ void NetPacket::readGameMessageArgumentFromPacket(GameMessageArgumentDataType ty
 	}
 }
 
+/**
+ * Reads the data portion of a compact game message from the given position in the
+ * packet.  lastLayout and lastObjectID carry the state shared with the previous
+ * compact game message in the packet; see addCompactGameCommand.
+ */
+NetCommandMsg * NetPacket::readCompactGameMessage(UnsignedByte *data, Int &i, Int &lastLayout, ObjectID &lastObjectID)
+{
+	UnsignedInt header = getVarInt(data, i);
+	Bool sameLayout = ((header & 1) != 0);
+
+	Int layout = i;
+	if (sameLayout) {
+		DEBUG_ASSERTCRASH(lastLayout >= 0, ("Compact game message repeats a layout that was never sent"));
+		if (lastLayout < 0) {
+			return NULL;
+		}
+		layout = lastLayout;
+	}
+	lastLayout = layout;
+
+	NetGameCommandMsg *msg = newInstance(NetGameCommandMsg);
+	msg->setGameMessageType((GameMessage::Type)(header >> 1));
+
+	// Get the types and the number of arguments of those types.
+	UnsignedByte numArgTypes = data[layout];
+	++layout;
+
+	Int totalArgCount = 0;
+	Int j;
+	GameMessageParser *parser = newInstance(GameMessageParser)();
+	for (j = 0; j < numArgTypes; ++j) {
+		UnsignedByte type = data[layout];
+		UnsignedByte argCount = data[layout + 1];
+		layout += 2;
+
+		parser->addArgType((GameMessageArgumentDataType)type, argCount);
+		totalArgCount += argCount;
+	}
+
+	if (!sameLayout) {
+		i = layout;
+	}
+
+	GameMessageParserArgumentType *parserArgType = parser->getFirstArgumentType();
+	GameMessageArgumentDataType lasttype = ARGUMENTDATATYPE_UNKNOWN;
+	Int argsLeftForType = 0;
+	if (parserArgType != NULL) {
+		lasttype = parserArgType->getType();
+		argsLeftForType = parserArgType->getArgCount();
+	}
+	for (j = 0; j < totalArgCount; ++j) {
+		readCompactGameMessageArgumentFromPacket(lasttype, msg, data, i, lastObjectID);
+
+		--argsLeftForType;
+		if (argsLeftForType == 0) {
+			parserArgType = parserArgType->getNext();
+			// parserArgType is allowed to be NULL here
+			if (parserArgType != NULL) {
+				argsLeftForType = parserArgType->getArgCount();
+				lasttype = parserArgType->getType();
+			}
+		}
+	}
+
+	parser->deleteInstance();
+	parser = NULL;
+
+	return (NetCommandMsg *)msg;
+}
+
+void NetPacket::readCompactGameMessageArgumentFromPacket(GameMessageArgumentDataType type, NetGameCommandMsg *msg, UnsignedByte *data, Int &i, ObjectID &lastObjectID) {
+	GameMessageArgumentType arg;
+	if (type == ARGUMENTDATATYPE_INTEGER) {
+		arg.integer = unZigZag(getVarInt(data, i));
+	} else if (type == ARGUMENTDATATYPE_REAL) {
+		memcpy(&(arg.real), data + i, sizeof(arg.real));
+		i += sizeof(arg.real);
+	} else if (type == ARGUMENTDATATYPE_BOOLEAN) {
+		arg.boolean = (data[i] != 0);
+		++i;
+	} else if (type == ARGUMENTDATATYPE_OBJECTID) {
+		lastObjectID = (ObjectID)((Int)lastObjectID + unZigZag(getVarInt(data, i)));
+		arg.objectID = lastObjectID;
+	} else if (type == ARGUMENTDATATYPE_DRAWABLEID) {
+		arg.drawableID = (DrawableID)(getVarInt(data, i));
+	} else if (type == ARGUMENTDATATYPE_TEAMID) {
+		arg.teamID = getVarInt(data, i);
+	} else if (type == ARGUMENTDATATYPE_LOCATION) {
+		memcpy(&(arg.location), data + i, sizeof(arg.location));
+		i += sizeof(arg.location);
+	} else if (type == ARGUMENTDATATYPE_PIXEL) {
+		arg.pixel.x = unZigZag(getVarInt(data, i));
+		arg.pixel.y = unZigZag(getVarInt(data, i));
+	} else if (type == ARGUMENTDATATYPE_PIXELREGION) {
+		arg.pixelRegion.lo.x = unZigZag(getVarInt(data, i));
+		arg.pixelRegion.lo.y = unZigZag(getVarInt(data, i));
+		arg.pixelRegion.hi.x = unZigZag(getVarInt(data, i));
+		arg.pixelRegion.hi.y = unZigZag(getVarInt(data, i));
+	} else if (type == ARGUMENTDATATYPE_TIMESTAMP) {
+		arg.timestamp = getVarInt(data, i);
+	} else if (type == ARGUMENTDATATYPE_WIDECHAR) {
+		arg.wChar = (WideChar)(getVarInt(data, i));
+	} else {
+		return;
+	}
+	msg->addArgument(type, arg);
+}
+
 /**
  * Reads the data portion of the ack message at this position in the packet.
  */
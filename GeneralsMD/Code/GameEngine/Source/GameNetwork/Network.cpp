@@ -156,6 +156,8 @@ class Network : public NetworkInterface
 	Real getOutgoingPacketsPerSecond( void );
 	Real getUnknownBytesPerSecond( void );
 	Real getUnknownPacketsPerSecond( void );
+	Real getIncomingPacketsPerCall( void );
+	Real getOutgoingPacketsPerCall( void );
 
 	// Multiplayer Load Progress Functions
 	void updateLoadProgress( Int percent );
@@ -884,6 +886,28 @@ Real Network::getUnknownPacketsPerSecond( void )
 	  return 0.0;
 }
 
+/**
+ * returns the average number of packets read per transport receive call that read any.
+ */
+Real Network::getIncomingPacketsPerCall( void )
+{
+	if (m_conMgr)
+		return m_conMgr->getIncomingPacketsPerCall();
+	else
+	  return 0.0;
+}
+
+/**
+ * returns the average number of packets written per transport send call that wrote any.
+ */
+Real Network::getOutgoingPacketsPerCall( void )
+{
+	if (m_conMgr)
+		return m_conMgr->getOutgoingPacketsPerCall();
+	else
+	  return 0.0;
+}
+
 /**
  * returns the smallest packet arrival cushion since this was last called.
  */
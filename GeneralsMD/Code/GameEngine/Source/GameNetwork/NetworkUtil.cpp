@@ -280,3 +280,32 @@ AsciiString GetAsciiNetCommandType(NetCommandType type) {
 	}
 	return s;
 }
+
+/**
+ * The run ahead equation.  Given the worst round trip latency in the game (seconds) and the slowest
+ * player's frame rate, works out how many frames ahead commands have to be scheduled and what frame
+ * rate everyone should run at.  Shared by the packet router and the lockstep benchmark.
+ */
+void ComputeRunAhead(Real maxLatency, Int minFps, Int frameRate, Int fpsLimit, Int slackPercent, Int &newRunAhead, Int &newFrameRate) {
+	if ((minFps >= ((frameRate * 9) / 10)) && (minFps < frameRate)) {
+		// if the minimum fps is within 10% of the desired framerate, then keep the current minimum fps.
+		minFps = frameRate;
+	}
+	if (minFps < 5) {
+		minFps = 5; // Absolutely do not run below 5 fps.
+	}
+	if (minFps > fpsLimit) {
+		minFps = fpsLimit; // Cap to 30 FPS.
+	}
+	DEBUG_LOG(("ComputeRunAhead - minFps after adjustment is %d\n", minFps));
+	newRunAhead = (Int)((maxLatency / 2.0) * (Real)minFps);
+	newRunAhead += (newRunAhead * slackPercent) / 100; // Add in 10% of slack to the run ahead in case of network hiccups.
+	if (newRunAhead < MIN_RUNAHEAD) {
+		newRunAhead = MIN_RUNAHEAD; // make sure its at least MIN_RUNAHEAD.
+	}
+
+	if (newRunAhead > (MAX_FRAMES_AHEAD / 2)) {
+		newRunAhead = MAX_FRAMES_AHEAD / 2; // dont let run ahead get out of hand.
+	}
+	newFrameRate = minFps;
+}
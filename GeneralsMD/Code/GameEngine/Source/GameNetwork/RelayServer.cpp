@@ -0,0 +1,551 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+//																																						//
+//  (c) 2001-2003 Electronic Arts Inc.																				//
+//																																						//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "PreRTS.h"	// This must go first in EVERY cpp file int the GameEngine
+
+#include "GameNetwork/RelayServer.h"
+#include "GameNetwork/NetPacket.h"
+#include "GameNetwork/NetworkUtil.h"
+
+/**
+ * The constructor.
+ */
+RelayGame::RelayGame() {
+	m_gameID = 0;
+	m_hostSlot = 0;
+	m_transport = NULL;
+	m_relayedCommands = NULL;
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		m_connections[i] = NULL;
+		m_latencyAverages[i] = 0.0f;
+		m_fpsAverages[i] = -1;
+		m_lastFrameInfo[i] = 0;
+	}
+	m_runAhead = 0;
+	m_frameRate = 0;
+}
+
+/**
+ * The destructor.
+ */
+RelayGame::~RelayGame() {
+	reset();
+
+	if (m_relayedCommands != NULL) {
+		m_relayedCommands->deleteInstance();
+		m_relayedCommands = NULL;
+	}
+}
+
+/**
+ * Set up an empty game.  Players are added with addPlayer.
+ */
+void RelayGame::init(UnsignedInt gameID, UnsignedInt hostSlot, Transport *transport) {
+	reset();
+
+	m_gameID = gameID;
+	m_hostSlot = hostSlot;
+	m_transport = transport;
+
+	if (m_relayedCommands == NULL) {
+		m_relayedCommands = newInstance(NetCommandList);
+		m_relayedCommands->init();
+	}
+	m_relayedCommands->reset();
+}
+
+/**
+ * Drop all the players and whatever we were holding for them.
+ */
+void RelayGame::reset() {
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if (m_connections[i] != NULL) {
+			m_connections[i]->deleteInstance();
+			m_connections[i] = NULL;
+		}
+		m_latencyAverages[i] = 0.0f;
+		m_fpsAverages[i] = -1;
+		m_lastFrameInfo[i] = 0;
+	}
+
+	if (m_relayedCommands != NULL) {
+		m_relayedCommands->reset();
+	}
+
+	m_runAhead = 0;
+	m_frameRate = 0;
+}
+
+/**
+ * Give this slot a connection to the address its packets come from.
+ */
+Bool RelayGame::addPlayer(UnsignedInt slot, UnsignedInt addr, UnsignedShort port) {
+	if ((slot >= MAX_SLOTS) || (m_connections[slot] != NULL)) {
+		DEBUG_ASSERTCRASH(slot < MAX_SLOTS, ("RelayGame::addPlayer - %d is an invalid slot", slot));
+		return FALSE;
+	}
+
+	m_connections[slot] = newInstance(Connection);
+	m_connections[slot]->init();
+	m_connections[slot]->attachTransport(m_transport);
+	m_connections[slot]->setUser(newInstance(User)(UnicodeString::TheEmptyString, addr, port));
+	return TRUE;
+}
+
+/**
+ * Returns the slot whose packets come from this address, or -1 if it isn't one of ours.
+ */
+Int RelayGame::findSlot(UnsignedInt addr, UnsignedShort port) {
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if (m_connections[i] != NULL) {
+			User *user = m_connections[i]->getUser();
+			if ((user->GetIPAddr() == addr) && (user->GetPort() == port)) {
+				return i;
+			}
+		}
+	}
+	return -1;
+}
+
+/**
+ * Returns TRUE when there is nobody left to relay for.
+ */
+Bool RelayGame::isOver() {
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if (m_connections[i] != NULL) {
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+UnsignedByte RelayGame::getLiveMask() {
+	UnsignedByte mask = 0;
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if ((m_connections[i] != NULL) && (m_connections[i]->isQuitting() == FALSE)) {
+			mask = mask | (1 << i);
+		}
+	}
+	return mask;
+}
+
+/**
+ * Throw away the connections of players that have left and whose queues have drained (or given up
+ * draining), then packetize whatever is queued for everyone else.
+ */
+void RelayGame::update() {
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if (m_connections[i] == NULL) {
+			continue;
+		}
+		if (m_connections[i]->isQuitting() && m_connections[i]->isQueueEmpty()) {
+			DEBUG_LOG(("RelayGame::update - game %d, player %d has left\n", m_gameID, i));
+			m_connections[i]->deleteInstance();
+			m_connections[i] = NULL;
+			m_fpsAverages[i] = -1;
+			continue;
+		}
+		m_connections[i]->doSend();
+	}
+}
+
+/**
+ * The relay's version of ConnectionManager::doRelay for a single command.  Acks are ours to process,
+ * everything else is acked and passed on.
+ */
+void RelayGame::processCommand(NetCommandRef *ref, UnsignedInt slot) {
+	NetCommandMsg *msg = ref->getCommand();
+
+	if ((slot >= MAX_SLOTS) || (m_connections[slot] == NULL) || (msg->getPlayerID() != slot)) {
+		// Players only ever send their own commands to the packet router.
+		return;
+	}
+
+	NetCommandType type = msg->getNetCommandType();
+	if ((type == NETCOMMANDTYPE_ACKSTAGE1) || (type == NETCOMMANDTYPE_ACKSTAGE2) || (type == NETCOMMANDTYPE_ACKBOTH)) {
+		processAck(msg);
+		return;
+	}
+
+	if (CommandRequiresAck(msg)) {
+		ackCommand(ref, slot);
+	}
+
+	if (type == NETCOMMANDTYPE_FRAMEINFO) {
+		if (msg->getExecutionFrame() > m_lastFrameInfo[slot]) {
+			m_lastFrameInfo[slot] = msg->getExecutionFrame();
+		}
+	} else if (type == NETCOMMANDTYPE_RUNAHEADMETRICS) {
+		processRunAheadMetrics((NetRunAheadMetricsCommandMsg *)msg);
+	} else if ((type == NETCOMMANDTYPE_RUNAHEAD) && (slot == m_hostSlot)) {
+		m_runAhead = ((NetRunAheadCommandMsg *)msg)->getRunAhead();
+		m_frameRate = ((NetRunAheadCommandMsg *)msg)->getFrameRate();
+	}
+
+	relayCommand(ref, slot);
+
+	if (type == NETCOMMANDTYPE_PLAYERLEAVE) {
+		// The leave notice is on its way to everyone else, so stop sending to the player that left.
+		UnsignedByte leavingID = ((NetPlayerLeaveCommandMsg *)msg)->getLeavingPlayerID();
+		if ((leavingID < MAX_SLOTS) && (m_connections[leavingID] != NULL)) {
+			m_connections[leavingID]->setQuitting();
+		}
+	}
+}
+
+/**
+ * Ack a command for the players it's going to, the same way the packet router would.  If nobody else
+ * needs it the sender gets both acks at once, otherwise it gets stage 1 now and stage 2 once the
+ * last recipient has acked.
+ *
+ * The ack has to look like it came from whoever the sender thinks it sent the command to: the host
+ * for everybody but the host, and the target player for the host, which sends to each player directly.
+ */
+void RelayGame::ackCommand(NetCommandRef *ref, UnsignedInt slot) {
+	NetCommandMsg *msg = ref->getCommand();
+	NetCommandMsg *ackmsg;
+
+	UnsignedByte relay = ref->getRelay() & ~(1 << slot);
+	UnsignedByte sendRelay = getLiveMask() & relay;
+	if (sendRelay == 0) {
+		ackmsg = newInstance(NetAckBothCommandMsg)(msg);
+	} else {
+		ackmsg = newInstance(NetAckStage1CommandMsg)(msg);
+	}
+
+	UnsignedInt ackFrom = m_hostSlot;
+	if (slot == m_hostSlot) {
+		for (Int i = 0; i < MAX_SLOTS; ++i) {
+			if (relay & (1 << i)) {
+				ackFrom = i;
+				break;
+			}
+		}
+	}
+	ackmsg->setPlayerID(ackFrom);
+
+	m_connections[slot]->sendNetCommandMsg(ackmsg, 1 << slot);
+	ackmsg->detach();
+}
+
+/**
+ * Pass a command on to everyone in its relay mask except the sender, and remember who we're still
+ * waiting on acks from.  This is ConnectionManager::sendRemoteCommand without the local frame data.
+ */
+void RelayGame::relayCommand(NetCommandRef *ref, UnsignedInt slot) {
+	NetCommandMsg *msg = ref->getCommand();
+	UnsignedByte relay = ref->getRelay() & ~(1 << slot);
+	UnsignedByte actualRelay = 0;
+
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if ((relay & (1 << i)) && (m_connections[i] != NULL) && (m_connections[i]->isQuitting() == FALSE)) {
+			m_connections[i]->sendNetCommandMsg(msg, 1 << i);
+			actualRelay = actualRelay | (1 << i);
+		}
+	}
+
+	if ((actualRelay != 0) && (CommandRequiresAck(msg) == TRUE)) {
+		NetCommandRef *relayed = m_relayedCommands->addMessage(msg);
+		if (relayed != NULL) {
+			relayed->setRelay(actualRelay);
+		}
+	}
+}
+
+/**
+ * Every ack a player sends is addressed to the packet router, which is us.  The stage 1 part stops
+ * our connection to that player resending the command; the stage 2 part counts towards telling the
+ * original sender everyone has it.
+ */
+void RelayGame::processAck(NetCommandMsg *msg) {
+	UnsignedInt playerID = msg->getPlayerID();
+	NetCommandType type = msg->getNetCommandType();
+
+	if ((type == NETCOMMANDTYPE_ACKSTAGE1) || (type == NETCOMMANDTYPE_ACKBOTH)) {
+		NetCommandRef *ref = m_connections[playerID]->processAck(msg);
+		if (ref != NULL) {
+			ref->deleteInstance();
+			ref = NULL;
+		}
+	}
+
+	if (type != NETCOMMANDTYPE_ACKBOTH) {
+		// stage 2 acks are only ever sent by the packet router, so a player sending one isn't acking anything.
+		return;
+	}
+
+	NetAckBothCommandMsg *bothmsg = (NetAckBothCommandMsg *)msg;
+	NetCommandRef *ref = m_relayedCommands->findMessage(bothmsg->getCommandID(), bothmsg->getOriginalPlayerID());
+	if (ref == NULL) {
+		return;
+	}
+
+	UnsignedByte relay = ref->getRelay() & ~(1 << playerID);
+	relay = relay & getLiveMask(); // don't wait on players that have left
+	if (relay != 0) {
+		ref->setRelay(relay);
+		return;
+	}
+
+	m_relayedCommands->removeMessage(ref);
+
+	UnsignedByte originalPlayerID = bothmsg->getOriginalPlayerID();
+	if ((originalPlayerID < MAX_SLOTS) && (m_connections[originalPlayerID] != NULL)) {
+		NetAckStage2CommandMsg *ackmsg = newInstance(NetAckStage2CommandMsg)(ref->getCommand());
+		ackmsg->setPlayerID(m_hostSlot);
+		m_connections[originalPlayerID]->sendNetCommandMsg(ackmsg, 1 << originalPlayerID);
+		ackmsg->detach();
+		ackmsg = NULL;
+	}
+
+	ref->deleteInstance();
+	ref = NULL;
+}
+
+/**
+ * A player's run ahead metrics are on their way to the host; keep a copy for ourselves.
+ */
+void RelayGame::processRunAheadMetrics(NetRunAheadMetricsCommandMsg *msg) {
+	UnsignedInt player = msg->getPlayerID();
+	if (player < MAX_SLOTS) {
+		m_latencyAverages[player] = msg->getAverageLatency();
+		m_fpsAverages[player] = msg->getAverageFps();
+		if (m_fpsAverages[player] > 100) {
+			// same cap ConnectionManager::processRunAheadMetrics applies for alt-tabbed players.
+			m_fpsAverages[player] = 100;
+		}
+	}
+}
+
+Real RelayGame::getMaximumLatency() {
+	Real lat1 = 0.0;
+	Real lat2 = 0.0;
+
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if ((m_connections[i] != NULL) && (m_latencyAverages[i] != 0.0)) {
+			if (m_latencyAverages[i] > lat1) {
+				lat2 = lat1;
+				lat1 = m_latencyAverages[i];
+			} else if (m_latencyAverages[i] > lat2) {
+				lat2 = m_latencyAverages[i];
+			}
+		}
+	}
+
+	return (lat1 + lat2);
+}
+
+void RelayGame::getMinimumFps(Int &minFps, Int &minFpsPlayer) {
+	minFps = -1;
+	minFpsPlayer = -1;
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if ((m_connections[i] != NULL) && (m_fpsAverages[i] != -1)) {
+			if ((minFps == -1) || (m_fpsAverages[i] < minFps)) {
+				minFps = m_fpsAverages[i];
+				minFpsPlayer = i;
+			}
+		}
+	}
+}
+
+UnsignedInt RelayGame::getFrameSpread() {
+	UnsignedInt minFrame = 0;
+	UnsignedInt maxFrame = 0;
+	Bool first = TRUE;
+	for (Int i = 0; i < MAX_SLOTS; ++i) {
+		if ((m_connections[i] != NULL) && (m_connections[i]->isQuitting() == FALSE)) {
+			if (first || (m_lastFrameInfo[i] < minFrame)) {
+				minFrame = m_lastFrameInfo[i];
+			}
+			if (first || (m_lastFrameInfo[i] > maxFrame)) {
+				maxFrame = m_lastFrameInfo[i];
+			}
+			first = FALSE;
+		}
+	}
+	return maxFrame - minFrame;
+}
+
+//-------------------------------------------------------------------------------------------------
+
+/**
+ * The constructor.
+ */
+RelayServer::RelayServer() {
+	m_transport = NULL;
+	for (Int i = 0; i < MAX_RELAY_GAMES; ++i) {
+		m_games[i] = NULL;
+	}
+	m_numGames = 0;
+}
+
+/**
+ * The destructor.
+ */
+RelayServer::~RelayServer() {
+	reset();
+}
+
+/**
+ * Open the socket for this event loop.
+ */
+Bool RelayServer::init(UnsignedInt ip, UnsignedShort port) {
+	reset();
+
+	m_transport = NEW Transport;
+	if (!m_transport->init(ip, port)) {
+		DEBUG_LOG(("RelayServer::init - couldn't open port %d\n", port));
+		delete m_transport;
+		m_transport = NULL;
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+ * Close the socket and drop every game.
+ */
+void RelayServer::reset() {
+	for (Int i = 0; i < MAX_RELAY_GAMES; ++i) {
+		if (m_games[i] != NULL) {
+			m_games[i]->deleteInstance();
+			m_games[i] = NULL;
+		}
+	}
+	m_numGames = 0;
+
+	if (m_transport != NULL) {
+		m_transport->reset();
+		delete m_transport;
+		m_transport = NULL;
+	}
+}
+
+/**
+ * Start relaying for a game.  Its players still have to be added to it.
+ */
+RelayGame * RelayServer::addGame(UnsignedInt gameID, UnsignedInt hostSlot) {
+	if ((m_transport == NULL) || (findGame(gameID) != NULL)) {
+		return NULL;
+	}
+
+	for (Int i = 0; i < MAX_RELAY_GAMES; ++i) {
+		if (m_games[i] == NULL) {
+			m_games[i] = newInstance(RelayGame);
+			m_games[i]->init(gameID, hostSlot, m_transport);
+			++m_numGames;
+			return m_games[i];
+		}
+	}
+	return NULL;
+}
+
+RelayGame * RelayServer::findGame(UnsignedInt gameID) {
+	for (Int i = 0; i < MAX_RELAY_GAMES; ++i) {
+		if ((m_games[i] != NULL) && (m_games[i]->getGameID() == gameID)) {
+			return m_games[i];
+		}
+	}
+	return NULL;
+}
+
+RelayGame * RelayServer::findGameByAddress(UnsignedInt addr, UnsignedShort port, Int &slot) {
+	for (Int i = 0; i < MAX_RELAY_GAMES; ++i) {
+		if (m_games[i] != NULL) {
+			slot = m_games[i]->findSlot(addr, port);
+			if (slot != -1) {
+				return m_games[i];
+			}
+		}
+	}
+	slot = -1;
+	return NULL;
+}
+
+/**
+ * One pass of the event loop.  Everything that has arrived is broken into commands and handed to the
+ * game the sender belongs to; then each game packetizes what it has queued and the transport sends it.
+ * Games are deleted once their last player has gone.
+ */
+void RelayServer::update() {
+	if (m_transport == NULL) {
+		return;
+	}
+
+	m_transport->doRecv();
+
+	for (Int i = 0; i < MAX_MESSAGES; ++i) {
+		TransportMessage *message = &(m_transport->m_inBuffer[i]);
+		if (message->length == 0) {
+			continue;
+		}
+
+		Int slot;
+		RelayGame *game = findGameByAddress(message->addr, message->port, slot);
+		if (game != NULL) {
+			NetPacket *packet = newInstance(NetPacket)(message);
+			NetCommandList *cmdList = packet->getCommandList();
+			NetCommandRef *cmd = cmdList->getFirstMessage();
+			while (cmd != NULL) {
+				game->processCommand(cmd, slot);
+				cmd = cmd->getNext();
+			}
+
+			packet->deleteInstance();
+			packet = NULL;
+
+			cmdList->deleteInstance();
+			cmdList = NULL;
+		}
+
+		// signal that this has been processed.
+		message->length = 0;
+	}
+
+	for (Int g = 0; g < MAX_RELAY_GAMES; ++g) {
+		if (m_games[g] == NULL) {
+			continue;
+		}
+		m_games[g]->update();
+		if (m_games[g]->isOver()) {
+			DEBUG_LOG(("RelayServer::update - game %d is over\n", m_games[g]->getGameID()));
+			m_games[g]->deleteInstance();
+			m_games[g] = NULL;
+			--m_numGames;
+		}
+	}
+
+	m_transport->doSend();
+}
@@ -86,6 +86,10 @@ Transport::Transport(void)
 {
 	m_winsockInit = false;
 	m_udpsock = NULL;
+	m_outHead = m_outTail = 0;
+	m_recvHead = m_recvTail = 0;
+	m_useLatency = false;
+	m_usePacketLoss = false;
 }
 
 Transport::~Transport(void)
@@ -118,10 +122,19 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 		m_winsockInit = true;
 	}
 
+	return init(NEW UDP(), ip, port);
+}
+
+/**
+ * Bind the given socket and run over it.  The transport owns the socket from here on, even if this
+ * fails.  This is how the loopback network simulator swaps a LoopbackUDP in for a real one.
+ */
+Bool Transport::init( UDP *sock, UnsignedInt ip, UnsignedShort port )
+{
 	// ------- Bind our port --------
 	if (m_udpsock)
 		delete m_udpsock;
-	m_udpsock = NEW UDP();
+	m_udpsock = sock;
 	
 	if (!m_udpsock)
 		return false;
@@ -141,9 +154,10 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 	}
 
 	// ------- Clear buffers --------
+	m_outHead = m_outTail = 0;
+	m_recvHead = m_recvTail = 0;
 	for (int i=0; i<MAX_MESSAGES; ++i)
 	{
-		m_outBuffer[i].length = 0;
 		m_inBuffer[i].length = 0;
 #if defined(_DEBUG) || defined(_INTERNAL)
 		m_delayedInBuffer[i].message.length = 0;
@@ -157,6 +171,8 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 		m_incomingPackets[i] = 0;
 		m_outgoingPackets[i] = 0;
 		m_unknownPackets[i] = 0;
+		m_incomingBatches[i] = 0;
+		m_outgoingBatches[i] = 0;
 	}
 	m_statisticsSlot = 0;
 	m_lastSecond = timeGetTime();
@@ -164,11 +180,15 @@ Bool Transport::init( UnsignedInt ip, UnsignedShort port )
 	m_port = port;
 
 #if defined(_DEBUG) || defined(_INTERNAL)
-	if (TheGlobalData->m_latencyAverage > 0 || TheGlobalData->m_latencyNoise)
-		m_useLatency = true;
+	// The headless relay server runs without TheGlobalData, and so without the simulation.
+	if (TheGlobalData != NULL)
+	{
+		if (TheGlobalData->m_latencyAverage > 0 || TheGlobalData->m_latencyNoise)
+			m_useLatency = true;
 
-	if (TheGlobalData->m_packetLoss)
-		m_usePacketLoss = true;
+		if (TheGlobalData->m_packetLoss)
+			m_usePacketLoss = true;
+	}
 #endif
 
 	return true;
@@ -205,6 +225,14 @@ Bool Transport::update( void )
 	return retval;
 }
 
+// Write failures that go away by themselves.  Anything else (a bad address, a dead route) will
+// fail the same way every time, so the message is dropped rather than left blocking the ring.
+static Bool isTransientSendError(UDP::sockStat status)
+{
+	return (status == UDP::WOULDBLOCK) || (status == UDP::AGAIN) || (status == UDP::INPROGRESS)
+		|| (status == UDP::INTR) || (status == (UDP::sockStat)WSAENOBUFS);
+}
+
 Bool Transport::doSend() {
 	if (!m_udpsock)
 	{
@@ -226,58 +254,67 @@ Bool Transport::doSend() {
 		m_incomingBytes[m_statisticsSlot] = 0;
 		m_unknownPackets[m_statisticsSlot] = 0;
 		m_unknownBytes[m_statisticsSlot] = 0;
+		m_incomingBatches[m_statisticsSlot] = 0;
+		m_outgoingBatches[m_statisticsSlot] = 0;
 	}
 
-	// Send all messages
-	int i;
-	for (i=0; i<MAX_MESSAGES; ++i)
+	// Send everything queued, oldest first.  If the socket is just full, leave the message
+	// (and everything behind it) for the next call so ordering is preserved.  Messages that
+	// can never be sent are dropped; the connections retry anything that needed to get there.
+	UnsignedInt head = m_outHead;
+	UnsignedInt tail = m_outTail;
+	Int numSent = 0;
+	while (head != tail)
 	{
-		if (m_outBuffer[i].length != 0)
+		TransportMessage *msg = &m_outBuffer[head & RING_MASK];
+		Int bytes = msg->length + sizeof(TransportMessageHeader);
+		Int result = m_udpsock->Write((unsigned char *)msg, bytes, msg->addr, msg->port);
+		if (result > 0)
 		{
-			int bytesSent = 0;
-			// Send this message
-			if ((bytesSent = m_udpsock->Write((unsigned char *)(&m_outBuffer[i]), m_outBuffer[i].length + sizeof(TransportMessageHeader), m_outBuffer[i].addr, m_outBuffer[i].port)) > 0)
-			{
-				//DEBUG_LOG(("Sending %d bytes to %d:%d\n", m_outBuffer[i].length + sizeof(TransportMessageHeader), m_outBuffer[i].addr, m_outBuffer[i].port));
-				m_outgoingPackets[m_statisticsSlot]++;
-				m_outgoingBytes[m_statisticsSlot] += m_outBuffer[i].length + sizeof(TransportMessageHeader);
-				m_outBuffer[i].length = 0;  // Remove from queue
-//				DEBUG_LOG(("Transport::doSend - sent %d butes to %d.%d.%d.%d:%d\n", bytesSent,
-//					(m_outBuffer[i].addr >> 24) & 0xff,
-//					(m_outBuffer[i].addr >> 16) & 0xff,
-//					(m_outBuffer[i].addr >> 8) & 0xff,
-//					m_outBuffer[i].addr & 0xff,
-//					m_outBuffer[i].port));
-			}
-			else
-			{
-				//DEBUG_LOG(("Could not write to socket!!!  Not discarding message!\n"));
-				retval = FALSE;
-				//DEBUG_LOG(("Transport::doSend returning FALSE\n"));
-			}
+			//DEBUG_LOG(("Sending %d bytes to %d:%d\n", bytes, msg->addr, msg->port));
+			m_outgoingPackets[m_statisticsSlot]++;
+			m_outgoingBytes[m_statisticsSlot] += bytes;
+			++head;
+			++numSent;
+		}
+		else if ((result != UDP::ADDRNOTAVAIL) && isTransientSendError(m_udpsock->GetStatus()))
+		{
+			//DEBUG_LOG(("Could not write to socket!!!  Not discarding message!\n"));
+			retval = FALSE;
+			break;
+		}
+		else
+		{
+			DEBUG_LOG(("Transport::doSend - dropping a %d byte message to %X:%d that can't be sent\n", bytes, msg->addr, msg->port));
+			retval = FALSE;
+			++head;
 		}
-	} // for (i=0; i<MAX_MESSAGES; ++i)
+	}
+	m_outHead = head;	// hand the sent slots back to queueSend
+
+	if (numSent > 0)
+	{
+		m_outgoingBatches[m_statisticsSlot]++;
+	}
 
 #if defined(_DEBUG) || defined(_INTERNAL)
 	// Latency simulation - deliver anything we're holding on to that is ready
 	if (m_useLatency)
 	{
-		for (i=0; i<MAX_MESSAGES; ++i)
+		for (Int i=0; i<MAX_MESSAGES; ++i)
 		{
 			if (m_delayedInBuffer[i].message.length != 0 && m_delayedInBuffer[i].deliveryTime <= now)
 			{
-				for (int j=0; j<MAX_MESSAGES; ++j)
+				if (m_recvTail - m_recvHead >= MAX_MESSAGES)
 				{
-					if (m_inBuffer[j].length == 0)
-					{
-						// Empty slot; use it
-						memcpy(&m_inBuffer[j], &m_delayedInBuffer[i].message, sizeof(TransportMessage));
-						m_delayedInBuffer[i].message.length = 0;
-						break;
-					}
+					break;	// receive ring is full; try again next time
 				}
+				memcpy(&m_recvRing[m_recvTail & RING_MASK], &m_delayedInBuffer[i].message, sizeof(TransportMessage));
+				++m_recvTail;
+				m_delayedInBuffer[i].message.length = 0;
 			}
 		}
+		deliverIncoming();
 	}
 #endif
 	return retval;
@@ -299,12 +336,22 @@ Bool Transport::doRecv()
 	UnsignedInt now = timeGetTime();
 #endif
 
-	TransportMessage incomingMessage;
-	unsigned char *buf = (unsigned char *)&incomingMessage;
+	// Read straight into the receive ring, and stop when it's full rather than reading
+	// datagrams we have nowhere to put; they'll keep in the socket buffer until next time.
+	UnsignedInt tail = m_recvTail;
+	Int numRead = 0;
 	int len = MAX_MESSAGE_LEN;
 //	DEBUG_LOG(("Transport::doRecv - checking\n"));
-	while ( (len=m_udpsock->Read(buf, MAX_MESSAGE_LEN, &from)) > 0 )
+	while (tail - m_recvHead < MAX_MESSAGES)
 	{
+		TransportMessage *incomingMessage = &m_recvRing[tail & RING_MASK];
+		unsigned char *buf = (unsigned char *)incomingMessage;
+		if ((len=m_udpsock->Read(buf, MAX_MESSAGE_LEN, &from)) <= 0)
+		{
+			break;
+		}
+		++numRead;
+
 #if defined(_DEBUG) || defined(_INTERNAL)
 		// Packet loss simulation
 		if (m_usePacketLoss)
@@ -318,32 +365,29 @@ Bool Transport::doRecv()
 
 //		DEBUG_LOG(("Transport::doRecv - Got something! len = %d\n", len));
 		// Decrypt the packet
-//		DEBUG_LOG(("buffer = "));
-//		for (Int munkee = 0; munkee < len; ++munkee) {
-//			DEBUG_LOG(("%02x", *(buf + munkee)));
-//		}
-//		DEBUG_LOG(("\n"));
 		decryptBuf(buf, len);
 
-		incomingMessage.length = len - sizeof(TransportMessageHeader);
+		incomingMessage->length = len - sizeof(TransportMessageHeader);
 
-		if (len <= sizeof(TransportMessageHeader) || !isGeneralsPacket( &incomingMessage ))
+		if (len <= sizeof(TransportMessageHeader) || !isGeneralsPacket( incomingMessage ))
 		{
 			m_unknownPackets[m_statisticsSlot]++;
 			m_unknownBytes[m_statisticsSlot] += len;
 			continue;
 		}
 
-		// Something there; stick it somewhere
+		// Something there; keep it
 //		DEBUG_LOG(("Saw %d bytes from %d:%d\n", len, ntohl(from.sin_addr.S_un.S_addr), ntohs(from.sin_port)));
 		m_incomingPackets[m_statisticsSlot]++;
 		m_incomingBytes[m_statisticsSlot] += len;
+		incomingMessage->addr = ntohl(from.sin_addr.S_un.S_addr);
+		incomingMessage->port = ntohs(from.sin_port);
 
-		for (int i=0; i<MAX_MESSAGES; ++i)
-		{
 #if defined(_DEBUG) || defined(_INTERNAL)
-			// Latency simulation
-			if (m_useLatency)
+		// Latency simulation
+		if (m_useLatency)
+		{
+			for (int i=0; i<MAX_MESSAGES; ++i)
 			{
 				if (m_delayedInBuffer[i].message.length == 0)
 				{
@@ -352,32 +396,25 @@ Bool Transport::doRecv()
 						now + TheGlobalData->m_latencyAverage +
 						(Int)(TheGlobalData->m_latencyAmplitude * sin(now * TheGlobalData->m_latencyPeriod)) +
 						GameClientRandomValue(-TheGlobalData->m_latencyNoise, TheGlobalData->m_latencyNoise);
-					m_delayedInBuffer[i].message.length = incomingMessage.length;
-					m_delayedInBuffer[i].message.addr = ntohl(from.sin_addr.S_un.S_addr);
-					m_delayedInBuffer[i].message.port = ntohs(from.sin_port);
-					memcpy(&m_delayedInBuffer[i].message, buf, len);
+					memcpy(&m_delayedInBuffer[i].message, incomingMessage, sizeof(TransportMessage));
 					break;
 				}
 			}
-			else
-			{
-#endif
-				if (m_inBuffer[i].length == 0)
-				{
-					// Empty slot; use it
-					m_inBuffer[i].length = incomingMessage.length;
-					m_inBuffer[i].addr = ntohl(from.sin_addr.S_un.S_addr);
-					m_inBuffer[i].port = ntohs(from.sin_port);
-					memcpy(&m_inBuffer[i], buf, len);
-					break;
-				}
-#if defined(_DEBUG) || defined(_INTERNAL)
-			}
-#endif
+			continue;
 		}
-		//DEBUG_ASSERTCRASH(i<MAX_MESSAGES, ("Message lost!"));
+#endif
+
+		++tail;
+	}
+	m_recvTail = tail;	// publish the new messages
+
+	if (numRead > 0)
+	{
+		m_incomingBatches[m_statisticsSlot]++;
 	}
 
+	deliverIncoming();
+
 	if (len == -1) {
 		// there was a socket error trying to perform a read.
 		//DEBUG_LOG(("Transport::doRecv returning FALSE\n"));
@@ -387,43 +424,61 @@ Bool Transport::doRecv()
 	return retval;
 }
 
+void Transport::deliverIncoming( void )
+{
+	// Consumers pick messages out of m_inBuffer in any order and clear them as they go, so
+	// fill the free slots lowest first, in arrival order, with a single pass.
+	UnsignedInt head = m_recvHead;
+	UnsignedInt tail = m_recvTail;
+	for (Int i=0; i<MAX_MESSAGES && head != tail; ++i)
+	{
+		if (m_inBuffer[i].length == 0)
+		{
+			const TransportMessage *msg = &m_recvRing[head & RING_MASK];
+			memcpy(&m_inBuffer[i], msg, msg->length + sizeof(TransportMessageHeader));
+			m_inBuffer[i].length = msg->length;
+			m_inBuffer[i].addr = msg->addr;
+			m_inBuffer[i].port = msg->port;
+			++head;
+		}
+	}
+	m_recvHead = head;
+}
+
 Bool Transport::queueSend(UnsignedInt addr, UnsignedShort port, const UnsignedByte *buf, Int len /*,
 						  NetMessageFlags flags, Int id */)
 {
-	int i;
-
 	if (len < 1 || len > MAX_PACKET_SIZE)
 	{
 		return false;
 	}
 
-	for (i=0; i<MAX_MESSAGES; ++i)
+	UnsignedInt tail = m_outTail;
+	if (tail - m_outHead >= MAX_MESSAGES)
 	{
-		if (m_outBuffer[i].length == 0)
-		{
-			// Insert data here
-			m_outBuffer[i].length = len;
-			memcpy(m_outBuffer[i].data, buf, len);
-			m_outBuffer[i].addr = addr;
-			m_outBuffer[i].port = port;
-//			m_outBuffer[i].header.flags = flags;
-//			m_outBuffer[i].header.id = id;
-			m_outBuffer[i].header.magic = GENERALS_MAGIC_NUMBER;
-
-			CRC crc;
-			crc.computeCRC( (unsigned char *)(&(m_outBuffer[i].header.magic)), m_outBuffer[i].length + sizeof(TransportMessageHeader) - sizeof(UnsignedInt) );
-//			DEBUG_LOG(("About to assign the CRC for the packet\n"));
-			m_outBuffer[i].header.crc = crc.get();
-
-			// Encrypt packet
-//			DEBUG_LOG(("buffer: "));
-			encryptBuf((unsigned char *)&m_outBuffer[i], len + sizeof(TransportMessageHeader));
-//			DEBUG_LOG(("\n"));
-
-			return true;
-		}
+		return false;
 	}
-	return false;
+
+	// Insert data here
+	TransportMessage *msg = &m_outBuffer[tail & RING_MASK];
+	msg->length = len;
+	memcpy(msg->data, buf, len);
+	msg->addr = addr;
+	msg->port = port;
+//	msg->header.flags = flags;
+//	msg->header.id = id;
+	msg->header.magic = GENERALS_MAGIC_NUMBER;
+
+	CRC crc;
+	crc.computeCRC( (unsigned char *)(&(msg->header.magic)), msg->length + sizeof(TransportMessageHeader) - sizeof(UnsignedInt) );
+	msg->header.crc = crc.get();
+
+	// Encrypt packet
+	encryptBuf((unsigned char *)msg, len + sizeof(TransportMessageHeader));
+
+	m_outTail = tail + 1;	// publish it to doSend
+
+	return true;
 }
 
 Bool Transport::isGeneralsPacket( TransportMessage *msg )
@@ -516,3 +571,33 @@ Real Transport::getUnknownPacketsPerSecond( void )
 
 
 
+
+Real Transport::getIncomingPacketsPerCall( void )
+{
+	Real packets = 0.0;
+	Real calls = 0.0;
+	for (int i=0; i<MAX_TRANSPORT_STATISTICS_SECONDS; ++i)
+	{
+		if (i != m_statisticsSlot)
+		{
+			packets += m_incomingPackets[i] + m_unknownPackets[i];
+			calls += m_incomingBatches[i];
+		}
+	}
+	return (calls > 0.0) ? packets / calls : 0.0;
+}
+
+Real Transport::getOutgoingPacketsPerCall( void )
+{
+	Real packets = 0.0;
+	Real calls = 0.0;
+	for (int i=0; i<MAX_TRANSPORT_STATISTICS_SECONDS; ++i)
+	{
+		if (i != m_statisticsSlot)
+		{
+			packets += m_outgoingPackets[i];
+			calls += m_outgoingBatches[i];
+		}
+	}
+	return (calls > 0.0) ? packets / calls : 0.0;
+}
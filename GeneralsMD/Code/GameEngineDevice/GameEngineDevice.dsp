@@ -1337,6 +1337,10 @@ SOURCE=.\Source\Win32Device\Common\Win32LocalFileSystem.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Source\Win32Device\Common\Win32MappedArchiveFile.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Source\Win32Device\Common\Win32OSDisplay.cpp
 # End Source File
 # End Group
@@ -1751,6 +1755,10 @@ SOURCE=.\Include\Win32Device\Common\Win32LocalFile.h
 
 SOURCE=.\Include\Win32Device\Common\Win32LocalFileSystem.h
 # End Source File
+# Begin Source File
+
+SOURCE=.\Include\Win32Device\Common\Win32MappedArchiveFile.h
+# End Source File
 # End Group
 # Begin Group "GameClient H (Win32Device)"
 
@@ -210,4 +210,48 @@ class W3DDisplay : public Display
 
 };  // end W3DDisplay
 
+//=============================================================================
+/** W3D display with no device behind it, for -headless runs.  The scenes and
+	* asset manager are still set up so draw modules load their models (the logic
+	* reads bone positions back off them), but nothing ever touches the video card.
+	*/
+//=============================================================================
+class W3DDisplayDummy : public W3DDisplay
+{
+
+public:
+
+	virtual void init( void );  ///< set up scenes and assets without a device
+
+	virtual void setWidth( UnsignedInt width ) { Display::setWidth( width ); }
+	virtual void setHeight( UnsignedInt height ) { Display::setHeight( height ); }
+	virtual Bool setDisplayMode( UnsignedInt xres, UnsignedInt yres, UnsignedInt bitdepth, Bool windowed ) { return FALSE; }
+	virtual Int getDisplayModeCount(void) { return 0; }
+	virtual void getDisplayModeDescription(Int modeIndex, Int *xres, Int *yres, Int *bitDepth) { }
+ 	virtual void setGamma(Real gamma, Real bright, Real contrast, Bool calibrate) { }
+
+	virtual void draw( void ) { }
+
+	virtual void drawLine( Int startX, Int startY, Int endX, Int endY, 
+												 Real lineWidth, UnsignedInt lineColor ) { }
+	virtual void drawLine( Int startX, Int startY, Int endX, Int endY, 
+												 Real lineWidth, UnsignedInt lineColor1, UnsignedInt lineColor2 ) { }
+	virtual void drawOpenRect( Int startX, Int startY, Int width, Int height,
+														 Real lineWidth, UnsignedInt lineColor ) { }
+	virtual void drawFillRect( Int startX, Int startY, Int width, Int height, 
+														 UnsignedInt color ) { }
+	virtual void drawRectClock(Int startX, Int startY, Int width, Int height, Int percent, UnsignedInt color) { }
+	virtual void drawRemainingRectClock(Int startX, Int startY, Int width, Int height, Int percent, UnsignedInt color) { }
+	virtual void drawImage( const Image *image, Int startX, Int startY, 
+													Int endX, Int endY, Color color = 0xFFFFFFFF, DrawImageMode mode=DRAW_IMAGE_ALPHA) { }
+	virtual void drawVideoBuffer( VideoBuffer *buffer, Int startX, Int startY, 
+													Int endX, Int endY ) { }
+
+	virtual VideoBuffer*	createVideoBuffer( void ) { return NULL; }
+
+	virtual void takeScreenShot(void) { }
+	virtual void toggleMovieCapture(void) { }
+
+};  // end W3DDisplayDummy
+
 #endif  // end __W3DDISPLAY_H_
@@ -50,6 +50,7 @@
 // SYSTEM INCLUDES ////////////////////////////////////////////////////////////
 
 // USER INCLUDES //////////////////////////////////////////////////////////////
+#include "Common/GlobalData.h"
 #include "GameClient/GameClient.h"
 #include "W3DDevice/GameClient/W3DParticleSys.h"
 #include "W3DDevice/GameClient/W3DDisplay.h"
@@ -108,7 +109,7 @@ class W3DGameClient : public GameClient
 	virtual Mouse *createMouse( void );											///< factory for the mouse
 
 	/// factory for creating TheDisplay
-	virtual Display *createGameDisplay( void ) { return NEW W3DDisplay; }
+	virtual Display *createGameDisplay( void );
 
 	/// factory for creating TheInGameUI
 	virtual InGameUI *createInGameUI( void ) { return NEW W3DInGameUI; }	
@@ -122,20 +123,51 @@ class W3DGameClient : public GameClient
   /// Manager for display strings
 	virtual DisplayStringManager *createDisplayStringManager( void ) { return NEW W3DDisplayStringManager; }
 
-	virtual VideoPlayerInterface *createVideoPlayer( void ) { return NEW BinkVideoPlayer; }
+	virtual VideoPlayerInterface *createVideoPlayer( void );
 	/// factory for creating the TerrainVisual
 	virtual TerrainVisual *createTerrainVisual( void ) { return NEW W3DTerrainVisual; }
 
 	/// factory for creating the snow manager
-	virtual SnowManager *createSnowManager( void ) { return NEW W3DSnowManager; }
+	virtual SnowManager *createSnowManager( void );
 
 	virtual void setFrameRate(Real msecsPerFrame) { TheW3DFrameLengthInMsec = msecsPerFrame; }
 
 };  // end class W3DGameClient
 
-inline Keyboard *W3DGameClient::createKeyboard( void ) { return NEW DirectInputKeyboard; }
+inline Keyboard *W3DGameClient::createKeyboard( void )
+{
+	// headless runs have no window to take DirectInput from
+	if (TheGlobalData->m_headless)
+		return NEW KeyboardDummy;
+	return NEW DirectInputKeyboard;
+}
+inline Display *W3DGameClient::createGameDisplay( void )
+{
+	// headless runs never create a device; the dummy display only sets up scenes and assets
+	if (TheGlobalData->m_headless)
+		return NEW W3DDisplayDummy;
+	return NEW W3DDisplay;
+}
+inline SnowManager *W3DGameClient::createSnowManager( void )
+{
+	// snow is purely visual and needs a device for its buffers
+	if (TheGlobalData->m_headless)
+		return NULL;
+	return NEW W3DSnowManager;
+}
+inline VideoPlayerInterface *W3DGameClient::createVideoPlayer( void )
+{
+	// headless runs never show a movie, so don't open Bink or its audio at all
+	if (TheGlobalData->m_headless)
+		return NEW VideoPlayer;
+	return NEW BinkVideoPlayer;
+}
 inline Mouse *W3DGameClient::createMouse( void )
 {
+	// headless runs have no window for the mouse to live in, and leave TheWin32Mouse NULL
+	if (TheGlobalData->m_headless)
+		return NEW MouseDummy;
+
 	//return new DirectInputMouse;
 	Win32Mouse * mouse = NEW W3DMouse;
 	TheWin32Mouse = mouse;   ///< global cheat for the WndProc()
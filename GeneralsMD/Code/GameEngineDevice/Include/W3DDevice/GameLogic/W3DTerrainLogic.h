@@ -87,6 +87,8 @@ class W3DTerrainLogic : public TerrainLogic
 	virtual void xfer( Xfer *xfer );
 	virtual void loadPostProcess( void );
 
+	virtual UnsignedByte getClipHeight( Int x, Int y ) const;
+
 	Real m_mapMinZ;	///< Minimum terrain z value.
 	Real m_mapMaxZ;	///< Maximum terrain z value.
 
@@ -41,6 +41,7 @@
 #ifndef __WIN32BIGFILE_H
 #define __WIN32BIGFILE_H
 
+#include <windows.h>
 #include "Common/ArchiveFile.h"
 #include "Common/AsciiString.h"
 #include "Common/List.h"
@@ -59,10 +60,14 @@ class Win32BIGFile : public ArchiveFile
 		virtual void					setSearchPriority( Int new_priority );	///< Set this BIG file's search priority
 		virtual void					close( void );													///< Close this BIG file
 
+		Bool									mapArchive( void );											///< map the attached archive so read-only opens are views instead of copies
+
 	protected:
 
 		AsciiString		m_name;		///< BIG file name
 		AsciiString		m_path;		///< BIG file path
+		HANDLE				m_mapFile;			///< read-only handle on the archive, kept for the mapping
+		HANDLE				m_mapping;			///< file mapping of the whole archive; NULL if we fall back to copying
 };
 
 #endif // __WIN32BIGFILE_H
\ No newline at end of file
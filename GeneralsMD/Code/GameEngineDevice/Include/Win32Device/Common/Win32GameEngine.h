@@ -110,8 +110,20 @@ inline ArchiveFileSystem *Win32GameEngine::createArchiveFileSystem( void ) { ret
 inline ParticleSystemManager* Win32GameEngine::createParticleSystemManager( void ) { return NEW W3DParticleSystemManager; }
 
 inline NetworkInterface *Win32GameEngine::createNetwork( void ) { return NetworkInterface::createNetwork(); }
-inline Radar *Win32GameEngine::createRadar( void ) { return NEW W3DRadar; }
+inline Radar *Win32GameEngine::createRadar( void )
+{
+	// headless runs have no device to build the radar textures on
+	if (TheGlobalData->m_headless)
+		return NEW RadarDummy;
+	return NEW W3DRadar;
+}
 inline WebBrowser *Win32GameEngine::createWebBrowser( void ) { return NEW CComObject<W3DWebBrowser>; }
-inline AudioManager *Win32GameEngine::createAudioManager( void ) { return NEW MilesAudioManager; }
+inline AudioManager *Win32GameEngine::createAudioManager( void )
+{
+	// headless runs never play anything, so don't open Miles at all
+	if (TheGlobalData->m_headless)
+		return NEW AudioManagerDummy;
+	return NEW MilesAudioManager;
+}
  
 #endif  // end __WIN32GAMEENGINE_H_
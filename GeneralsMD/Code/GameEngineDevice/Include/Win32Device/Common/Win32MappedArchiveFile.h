@@ -0,0 +1,81 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+//																																						//
+//  (c) 2001-2003 Electronic Arts Inc.																				//
+//																																						//
+////////////////////////////////////////////////////////////////////////////////
+
+///// Win32MappedArchiveFile.h ///////////////////////////
+// Read-only view of a file inside a memory-mapped BIG archive
+//////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef __WIN32MAPPEDARCHIVEFILE_H
+#define __WIN32MAPPEDARCHIVEFILE_H
+
+#include <windows.h>
+#include "Common/RAMFile.h"
+
+//===============================
+// Win32MappedArchiveFile
+//===============================
+/**
+	* A RAMFile whose data points directly into a mapped view of the owning BIG
+	* file instead of a private copy.  All of the RAMFile read/scan/seek code works
+	* unchanged on the view.  The view is unmapped on close; since Windows keeps
+	* the section alive while any view of it exists, an open file stays valid even
+	* if its archive is closed underneath it.
+	*/
+//===============================
+
+class Win32MappedArchiveFile : public RAMFile
+{
+	MEMORY_POOL_GLUE_WITH_USERLOOKUP_CREATE(Win32MappedArchiveFile, "Win32MappedArchiveFile")
+	protected:
+
+		void				*m_viewBase;									///< start of the mapped view (aligned to allocation granularity)
+		Int					m_readAhead;									///< bytes to fault in ahead of the read position, 0 for none
+		Int					m_readAheadPos;								///< everything before this position has already been faulted in
+
+		void					touchReadAhead( void );														///< fault in pages up to m_readAhead bytes past the read position
+
+	public:
+
+		Win32MappedArchiveFile();
+		//virtual				~Win32MappedArchiveFile();
+
+		Bool					openFromMapping( HANDLE mapping, const AsciiString& filename, Int offset, Int size, Int readAhead );	///< map a view of size bytes at offset in the archive
+		virtual void	close( void );																			///< Unmap the view and close the file
+		virtual Int		read( void *buffer, Int bytes );										///< Read the specified number of bytes in to buffer: See File::read
+		virtual char* readEntireAndClose();																///< copies the view, since the caller owns (and deletes) the buffer
+};
+
+#endif // __WIN32MAPPEDARCHIVEFILE_H
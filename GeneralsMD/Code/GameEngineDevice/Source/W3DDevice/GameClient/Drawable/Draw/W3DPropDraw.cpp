@@ -110,7 +110,7 @@ void W3DPropDraw::reactToTransformChange( const Matrix3D *oldMtx,
 	}
 	m_propAdded = true;
 	const W3DPropDrawModuleData *moduleData = getW3DPropDrawModuleData();
-	if (!moduleData) {
+	if (!moduleData || !TheTerrainRenderObject) {
 		return;
 	}
 	Real scale = draw->getScale();
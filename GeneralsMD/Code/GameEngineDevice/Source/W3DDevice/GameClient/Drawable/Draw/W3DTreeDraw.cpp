@@ -151,7 +151,7 @@ void W3DTreeDraw::reactToTransformChange( const Matrix3D *oldMtx,
 	}
 	m_treeAdded = true;
 	const W3DTreeDrawModuleData *moduleData = getW3DTreeDrawModuleData();
-	if (!moduleData) {
+	if (!moduleData || !TheTerrainRenderObject) {
 		return;
 	}
 	Real scale = draw->getScale();
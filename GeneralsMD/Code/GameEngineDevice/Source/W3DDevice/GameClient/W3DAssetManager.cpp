@@ -65,6 +65,7 @@
 #include "part_emt.h"
 #include "vertmaterial.h"
 #include "dx8wrapper.h"
+#include "ww3d.h"
 #include "texture.h"
 #include "surfaceclass.h"
 #include "textureloader.h"
@@ -676,6 +677,9 @@ TextureClass * W3DAssetManager::Recolor_Texture_One_Time(TextureClass *texture,
 	// if texture is procedural return NULL
 	if (name && name[0]=='!') return NULL;
 
+	// with texturing off (headless runs) no texture data is ever loaded, so there is nothing to recolor
+	if (!WW3D::Is_Texturing_Enabled()) return NULL;
+
 	// make sure texture is loaded
 	if (!texture->Is_Initialized())	
 		TextureLoader::Request_Foreground_Loading(texture);
@@ -1658,6 +1662,9 @@ TextureClass * W3DAssetManager::Recolor_Texture_One_Time(TextureClass *texture,
 	// if texture is procedural return NULL
 	if (name && name[0]=='!') return NULL;
 
+	// with texturing off (headless runs) no texture data is ever loaded, so there is nothing to recolor
+	if (!WW3D::Is_Texturing_Enabled()) return NULL;
+
 	// make sure texture is loaded
 	if (!texture->Is_Initialized())	
 		TextureLoader::Request_High_Priority_Loading(texture, (TextureClass::MipCountType)texture->Get_Mip_Level_Count());
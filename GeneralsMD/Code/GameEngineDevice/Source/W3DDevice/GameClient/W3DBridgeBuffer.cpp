@@ -783,6 +783,10 @@ void W3DBridgeBuffer::freeBridgeBuffers(void)
 //=============================================================================
 void W3DBridgeBuffer::allocateBridgeBuffers(void)
 {
+	// Headless runs have no device.  The buffer is then only used to hand the bridges to the
+	// logic, and loadBridgesInVertexAndIndexBuffers() already skips missing buffers.
+	if (DX8Wrapper::_Get_D3D_Device8() == NULL)
+		return;
 	m_vertexBridge=NEW_REF(DX8VertexBufferClass,(DX8_FVF_XYZNDUV1,MAX_BRIDGE_VERTEX+4,DX8VertexBufferClass::USAGE_DYNAMIC));
 	m_indexBridge=NEW_REF(DX8IndexBufferClass,(MAX_BRIDGE_INDEX+4, DX8IndexBufferClass::USAGE_DYNAMIC));
 	m_vertexMaterial=VertexMaterialClass::Get_Preset(VertexMaterialClass::PRELIT_DIFFUSE);
@@ -836,9 +840,14 @@ void W3DBridgeBuffer::loadBridges(W3DTerrainLogic *pTerrainLogic, Bool saveGame)
 			if (!pMapObj2->getFlag(FLAG_BRIDGE_POINT2)) continue;
 			Vector3 from, to;
 			from.Set(pMapObj->getLocation()->x, pMapObj->getLocation()->y, 0);
-			from.Z = TheTerrainRenderObject->getHeightMapHeight(from.X, from.Y, NULL) + BRIDGE_FLOAT_AMT;
 			to.Set(pMapObj2->getLocation()->x, pMapObj2->getLocation()->y, 0);
-			to.Z = TheTerrainRenderObject->getHeightMapHeight(to.X, to.Y, NULL) + BRIDGE_FLOAT_AMT;
+			if (TheTerrainRenderObject) {
+				from.Z = TheTerrainRenderObject->getHeightMapHeight(from.X, from.Y, NULL) + BRIDGE_FLOAT_AMT;
+				to.Z = TheTerrainRenderObject->getHeightMapHeight(to.X, to.Y, NULL) + BRIDGE_FLOAT_AMT;
+			} else if (pTerrainLogic) {
+				from.Z = pTerrainLogic->getGroundHeight(from.X, from.Y) + BRIDGE_FLOAT_AMT;
+				to.Z = pTerrainLogic->getGroundHeight(to.X, to.Y) + BRIDGE_FLOAT_AMT;
+			}
 			addBridge(from, to, pMapObj->getName(), pTerrainLogic, pMapObj->getProperties());
 			pMapObj = pMapObj2;
 		} 
@@ -844,6 +844,66 @@ void W3DDisplay::init( void )
 	}
 }  // end init
 
+// W3DDisplayDummy::init ======================================================
+/** Bring up just enough of W3D for the draw modules to load their models: the
+	* file system, the scenes and lights, and the asset manager.  WW3D runs in its
+	* lite mode, which never loads D3D, and texturing is off so textures are named
+	* but never created. */
+//=============================================================================
+void W3DDisplayDummy::init( void )
+{
+
+	Display::init();
+
+	// handle re-entry for ourselves
+	if( m_initialized )
+		return;
+
+	// Override the W3D File system
+	TheW3DFileSystem = NEW W3DFileSystem;
+
+	// init the Westwood math library
+	WWMath::Init();
+
+	// create our scenes.  Nothing is ever rendered from them, but drawables add their
+	// render objects to the 3D scene and the interface code expects the others.
+	m_3DInterfaceScene = NEW_REF( RTS3DInterfaceScene, () );
+	m_2DScene = NEW_REF( RTS2DScene, () );
+	m_3DScene = NEW_REF( RTS3DScene, () );
+
+	Int lindex;
+	for (lindex=0; lindex<TheGlobalData->m_numGlobalLights; lindex++) 
+	{	m_myLight[lindex] = NEW_REF( LightClass, (LightClass::DIRECTIONAL) );
+	}
+
+	setTimeOfDay( TheGlobalData->m_timeOfDay );
+
+	for (lindex=0; lindex<TheGlobalData->m_numGlobalLights; lindex++) 
+	{	m_3DScene->setGlobalLight( m_myLight[lindex], lindex );
+	}
+
+	// create a new asset manager
+	m_assetManager = NEW W3DAssetManager;	
+	m_assetManager->Register_Prototype_Loader(&_ParticleEmitterLoader );
+	m_assetManager->Register_Prototype_Loader(&_AggregateLoader);
+	m_assetManager->Set_WW3D_Load_On_Demand( true );
+
+	if (WW3D::Init( NULL, NULL, true ) != WW3D_ERROR_OK)
+		throw ERROR_INVALID_D3D;
+
+	WW3D::Enable_Texturing(false);
+	WW3D::Enable_Static_Sort_Lists(true);
+	WW3D::Set_Thumbnail_Enabled(false);
+
+	setWindowed( TRUE );
+	setWidth( TheGlobalData->m_xResolution );
+	setHeight( TheGlobalData->m_yResolution );
+	setBitDepth( W3D_DISPLAY_DEFAULT_BIT_DEPTH );
+
+	m_initialized = true;
+
+}  // end init
+
 // W3DDisplay::reset ===========================================================
 /** Reset the W3D display system.  Here we need to
   * remove the objects from the previous map. */
@@ -1370,13 +1430,13 @@ void W3DDisplay::gatherDebugStats( void )
 
 		// Network incoming bandwidth stats
 		if (TheNetwork != NULL) {
-			unibuffer.format(L"IN: %.2f bytes/sec, %.2f packets/sec",
-				TheNetwork->getIncomingBytesPerSecond(), TheNetwork->getIncomingPacketsPerSecond());
+			unibuffer.format(L"IN: %.2f bytes/sec, %.2f packets/sec, %.2f packets/call",
+				TheNetwork->getIncomingBytesPerSecond(), TheNetwork->getIncomingPacketsPerSecond(), TheNetwork->getIncomingPacketsPerCall());
 			m_displayStrings[NetIncoming]->setText( unibuffer );
 
 			// Network outgoing bandwidth stats
-			unibuffer.format(L"OUT: %.2f bytes/sec, %.2f packets/sec",
-				TheNetwork->getOutgoingBytesPerSecond(), TheNetwork->getOutgoingPacketsPerSecond());
+			unibuffer.format(L"OUT: %.2f bytes/sec, %.2f packets/sec, %.2f packets/call",
+				TheNetwork->getOutgoingBytesPerSecond(), TheNetwork->getOutgoingPacketsPerSecond(), TheNetwork->getOutgoingPacketsPerCall());
 			m_displayStrings[NetOutgoing]->setText( unibuffer );
 
 			// Network performance stats
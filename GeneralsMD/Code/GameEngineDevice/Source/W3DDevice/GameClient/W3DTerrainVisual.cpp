@@ -246,6 +246,15 @@ void W3DTerrainVisual::init( void )
 
 	// extend
 	TerrainVisual::init();
+
+	// headless runs have no device, so there is no terrain, water, shadow, track or smudge
+	// rendering to set up.  load() still reads the logic height map.
+	if (TheGlobalData->m_headless)
+	{
+		m_isWaterGridRenderingEnabled = FALSE;
+		return;
+	}
+
 	// create a new render object for W3D
 	m_terrainRenderObject = NEW_REF( HeightMapRenderObjClass, () );
 	m_terrainRenderObject->Set_Collision_Type( PICK_TYPE_TERRAIN );
@@ -326,7 +335,8 @@ void W3DTerrainVisual::reset( void )
 	// extend
 	TerrainVisual::reset();
 
-	m_terrainRenderObject->reset();
+	if (m_terrainRenderObject)
+		m_terrainRenderObject->reset();
 
 	if (TheW3DShadowManager)
 		TheW3DShadowManager->Reset();
@@ -594,7 +604,7 @@ Bool W3DTerrainVisual::load( AsciiString filename )
 
 	}  // end if
 
-	if( m_terrainRenderObject == NULL )
+	if( m_terrainRenderObject == NULL && !TheGlobalData->m_headless )
 		return FALSE;
 
 
@@ -604,6 +614,9 @@ Bool W3DTerrainVisual::load( AsciiString filename )
   REF_PTR_RELEASE( m_logicHeightMap );
 	m_logicHeightMap = NEW WorldHeightMap(pStrm);
 
+	// without a render object there is nothing else to load
+	if( m_terrainRenderObject == NULL )
+		return TRUE;
 
 
 
@@ -955,7 +968,8 @@ void W3DTerrainVisual::setRawMapHeight(const ICoord2D *gridPos, Int height)
  		if (m_logicHeightMap->getHeight(x,y) > height) 
 		{
 			m_logicHeightMap->setRawHeight(x, y, height);
-			m_terrainRenderObject->staticLightingChanged(); // OOH! this could benefit from the new Seismic update code
+			if (m_terrainRenderObject)
+				m_terrainRenderObject->staticLightingChanged(); // OOH! this could benefit from the new Seismic update code
 
 
 #ifdef DO_SEISMIC_SIMULATIONS 
@@ -1023,7 +1037,8 @@ void W3DTerrainVisual::addFactionBibDrawable(Drawable *factionBuilding, Bool hig
 		mtx->Transform_Vector(*mtx, corners[1], &corners[1]);
 		mtx->Transform_Vector(*mtx, corners[2], &corners[2]);
 		mtx->Transform_Vector(*mtx, corners[3], &corners[3]);
-		m_terrainRenderObject->addTerrainBibDrawable(corners, factionBuilding->getID(), highlight);
+		if (m_terrainRenderObject)
+			m_terrainRenderObject->addTerrainBibDrawable(corners, factionBuilding->getID(), highlight);
 	}
 }
 
@@ -1065,7 +1080,8 @@ void W3DTerrainVisual::addFactionBib(Object *factionBuilding, Bool highlight, Re
 		mtx->Transform_Vector(*mtx, corners[1], &corners[1]);
 		mtx->Transform_Vector(*mtx, corners[2], &corners[2]);
 		mtx->Transform_Vector(*mtx, corners[3], &corners[3]);
-		m_terrainRenderObject->addTerrainBib(corners, factionBuilding->getID(), highlight);
+		if (m_terrainRenderObject)
+			m_terrainRenderObject->addTerrainBib(corners, factionBuilding->getID(), highlight);
 	}
 }
 
@@ -1208,8 +1224,9 @@ void W3DTerrainVisual::crc( Xfer *xfer )
 void W3DTerrainVisual::xfer( Xfer *xfer )
 {
 
-	// version
-	XferVersion currentVersion = 3;
+	// version.  Headless runs have no terrain render object, so they write no client side
+	// trees & props.
+	XferVersion currentVersion = m_terrainRenderObject ? 3 : 2;
 	XferVersion version = currentVersion;
 	xfer->xferVersion( &version, currentVersion );
 
@@ -1277,7 +1294,8 @@ void W3DTerrainVisual::xfer( Xfer *xfer )
 		if (xfer->getXferMode() == XFER_LOAD)	
     {	
 			// Update the display height map.
-			m_terrainRenderObject->staticLightingChanged();
+			if (m_terrainRenderObject)
+				m_terrainRenderObject->staticLightingChanged();
 		}
 	}
 
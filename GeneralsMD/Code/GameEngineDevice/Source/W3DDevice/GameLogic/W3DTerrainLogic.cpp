@@ -39,6 +39,7 @@
 
 #include "Common/GameMemory.h"
 #include "W3DDevice/GameClient/HeightMap.h"
+#include "W3DDevice/GameClient/W3DBridgeBuffer.h"
 #include "W3DDevice/GameLogic/W3DTerrainLogic.h"
 #include "W3DDevice/GameClient/WorldHeightMap.h"
 #include "Common/PerfTimer.h"
@@ -46,6 +47,7 @@
 #include "Common/GlobalData.h"
 #include "Common/Xfer.h"
 #include "GameClient/GameClient.h"
+#include "GameClient/TerrainVisual.h"
 
 #include "GameClient/MapUtil.h"
 #include "GameLogic/AI.h"
@@ -109,7 +111,18 @@ void W3DTerrainLogic::reset( void )
 void W3DTerrainLogic::newMap( Bool saveGame )
 {
 
-	TheTerrainRenderObject->loadRoadsAndBridges( this, saveGame );
+	if (TheTerrainRenderObject)
+	{
+		TheTerrainRenderObject->loadRoadsAndBridges( this, saveGame );
+	}
+	else
+	{
+		// headless runs have no render object to own the bridge buffer, but the bridges still
+		// have to reach the logic, so load them through a scratch buffer that never draws.
+		W3DBridgeBuffer *bridgeBuffer = NEW W3DBridgeBuffer;
+		bridgeBuffer->loadBridges( this, saveGame );
+		delete bridgeBuffer;
+	}
 	TerrainLogic::newMap( saveGame );
 }  // end update
 
@@ -185,6 +198,10 @@ Bool W3DTerrainLogic::loadMap( AsciiString filename , Bool query )
 		}
 		m_mapMinZ = minHt * MAP_HEIGHT_SCALE;
 		m_mapMaxZ = maxHt * MAP_HEIGHT_SCALE;
+
+		// keep the samples, so logic height queries never need the render object
+		setHeightSamples( terrainHeightMap->getDataPtr(), m_mapDX, m_mapDY, terrainHeightMap->getBorderSizeInline() );
+
 		//release temporary object used for loading height values
 		REF_PTR_RELEASE(terrainHeightMap);
 	}
@@ -264,7 +281,8 @@ void W3DTerrainLogic::getExtentIncludingBorder( Region3D *extent ) const
 	extent->lo.x = 0.0f;
 	extent->lo.y = 0.0f;
 
-	Real border = TheTerrainRenderObject->getMap()->getBorderSizeInline() * MAP_XY_FACTOR;
+	Int borderSize = m_mapData ? m_mapBorder : TheTerrainRenderObject->getMap()->getBorderSizeInline();
+	Real border = borderSize * MAP_XY_FACTOR;
 	extent->lo.x -= border;
 	extent->lo.y -= border;
 	extent->hi.x = (m_mapDX * MAP_XY_FACTOR)-border;
@@ -274,6 +292,11 @@ void W3DTerrainLogic::getExtentIncludingBorder( Region3D *extent ) const
 //-------------------------------------------------------------------------------------------------
 Bool W3DTerrainLogic::isClearLineOfSight(const Coord3D& pos, const Coord3D& posOther) const
 {
+	if (m_mapData)
+	{
+		return TerrainLogic::isClearLineOfSight(pos, posOther);
+	}
+
 	if (TheTerrainRenderObject) 
 	{
 		return TheTerrainRenderObject->isClearLineOfSight(pos, posOther);
@@ -284,11 +307,28 @@ Bool W3DTerrainLogic::isClearLineOfSight(const Coord3D& pos, const Coord3D& posO
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/** Off the edge of the map, heights have always come from the render object's own height map,
+	* so keep asking it while there is one. */
+//-------------------------------------------------------------------------------------------------
+UnsignedByte W3DTerrainLogic::getClipHeight( Int x, Int y ) const
+{
+	if (TheTerrainRenderObject && TheTerrainRenderObject->getMap())
+		return TheTerrainRenderObject->getClipHeight(x, y);
+
+	return TerrainLogic::getClipHeight(x, y);
+}
+
 //-------------------------------------------------------------------------------------------------
 /** W3D specific get height function for logical terrain */
 //-------------------------------------------------------------------------------------------------
 Real W3DTerrainLogic::getGroundHeight( Real x, Real y, Coord3D* normal ) const
 {
+	if (m_mapData)
+	{
+		return sampleGroundHeight(x, y, normal);
+	}
+
 #define USE_THE_TERRAIN_OBJECT
 #ifdef USE_THE_TERRAIN_OBJECT
 	if (TheTerrainRenderObject) 
@@ -316,7 +356,7 @@ Real W3DTerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, C
 {
 #ifdef USE_THE_TERRAIN_OBJECT
 
-	if (!TheTerrainRenderObject)
+	if (!m_mapData && !TheTerrainRenderObject)
 	{
 		if (normal)
 		{	
@@ -328,7 +368,7 @@ Real W3DTerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, C
 		return 0;
 	}
 
-	Real height = TheTerrainRenderObject->getHeightMapHeight(x,y,normal);
+	Real height = m_mapData ? sampleGroundHeight(x,y,normal) : TheTerrainRenderObject->getHeightMapHeight(x,y,normal);
 
 	if (layer != LAYER_GROUND) 
 	{
@@ -369,7 +409,27 @@ Real W3DTerrainLogic::getLayerHeight( Real x, Real y, PathfindLayerEnum layer, C
 Bool W3DTerrainLogic::isCliffCell( Real x, Real y) const
 {
 
-	return TheTerrainRenderObject->isCliffCell(x,y);
+	if (TheTerrainRenderObject)
+		return TheTerrainRenderObject->isCliffCell(x,y);
+
+	// headless runs have no render object; read the same cliff flags off the logic height map
+	WorldHeightMap *logicHeightMap = TheTerrainVisual ? TheTerrainVisual->getLogicHeightMap() : NULL;
+	if (logicHeightMap == NULL)
+		return false;
+
+	Int iX = x/MAP_XY_FACTOR;
+	Int iY = y/MAP_XY_FACTOR;
+	iX += logicHeightMap->getBorderSizeInline();
+	iY += logicHeightMap->getBorderSizeInline();
+	if (iX<0) iX = 0;
+	if (iY<0) iY = 0;
+	if (iX >= (logicHeightMap->getXExtent()-1)) {
+		iX = logicHeightMap->getXExtent()-2;
+	}
+	if (iY >= (logicHeightMap->getYExtent()-1)) {
+		iY = logicHeightMap->getYExtent()-2;
+	}
+	return logicHeightMap->getCliffState(iX, iY);
 
 }  // end isCliffCell
 
@@ -411,4 +471,13 @@ void W3DTerrainLogic::loadPostProcess( void )
 	// extend base class
 	TerrainLogic::loadPostProcess();
 
+	// the height samples are only saved once, by the terrain visual, so copy them back
+	// from there now that it has loaded.
+	WorldHeightMap *logicHeightMap = TheTerrainVisual ? TheTerrainVisual->getLogicHeightMap() : NULL;
+	if (m_mapData && logicHeightMap && 
+			logicHeightMap->getXExtent() == m_mapDX && logicHeightMap->getYExtent() == m_mapDY)
+	{
+		memcpy(m_mapData, logicHeightMap->getDataPtr(), m_mapDX * m_mapDY);
+	}
+
 }  // end loadPostProcess
@@ -43,12 +43,18 @@
 #include "Common/GameMemory.h"
 #include "Common/PerfTimer.h"
 #include "Win32Device/Common/Win32BIGFile.h"
+#include "Win32Device/Common/Win32MappedArchiveFile.h"
+
+/// how far ahead of the read position to fault in pages for File::STREAMING opens
+static const Int STREAMING_READ_AHEAD = 64 * 1024;
 
 //============================================================================
 // Win32BIGFile::Win32BIGFile
 //============================================================================
 
-Win32BIGFile::Win32BIGFile()
+Win32BIGFile::Win32BIGFile() :
+	m_mapFile(INVALID_HANDLE_VALUE),
+	m_mapping(NULL)
 {
 
 }
@@ -59,7 +65,46 @@ Win32BIGFile::Win32BIGFile()
 
 Win32BIGFile::~Win32BIGFile()
 {
+	if (m_mapping != NULL) {
+		CloseHandle(m_mapping);
+		m_mapping = NULL;
+	}
+	if (m_mapFile != INVALID_HANDLE_VALUE) {
+		CloseHandle(m_mapFile);
+		m_mapFile = INVALID_HANDLE_VALUE;
+	}
+}
 
+//============================================================================
+// Win32BIGFile::mapArchive
+//============================================================================
+/**
+	* Create a read-only mapping of the attached archive.  Nothing is mapped into
+	* the address space here; openFile maps a view of just the requested file.
+	* If anything fails we leave m_mapping NULL and openFile copies into a RAMFile
+	* as it always has.
+	*/
+Bool Win32BIGFile::mapArchive( void )
+{
+	if (m_file == NULL) {
+		return FALSE;
+	}
+
+	m_mapFile = CreateFile(m_file->getName(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+	if (m_mapFile == INVALID_HANDLE_VALUE) {
+		DEBUG_LOG(("Win32BIGFile::mapArchive - could not open %s for mapping, error %d\n", m_file->getName(), GetLastError()));
+		return FALSE;
+	}
+
+	m_mapping = CreateFileMapping(m_mapFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m_mapping == NULL) {
+		DEBUG_LOG(("Win32BIGFile::mapArchive - could not map %s, error %d\n", m_file->getName(), GetLastError()));
+		CloseHandle(m_mapFile);
+		m_mapFile = INVALID_HANDLE_VALUE;
+		return FALSE;
+	}
+
+	return TRUE;
 }
 
 //============================================================================
@@ -75,17 +120,32 @@ File* Win32BIGFile::openFile( const Char *filename, Int access )
 	}
 
 	RAMFile *ramFile = NULL;
-	
-	if (BitTest(access, File::STREAMING)) 
-		ramFile = newInstance( StreamingArchiveFile );
-	else 
-		ramFile = newInstance( RAMFile );
-
-	ramFile->deleteOnClose();
-	if (ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
-		ramFile->close();
-		ramFile = NULL;
-		return NULL;
+
+	if (m_mapping != NULL && fileInfo->m_size > 0) {
+		// hand out a view straight into the archive; no allocation, no copy.
+		Win32MappedArchiveFile *mappedFile = newInstance( Win32MappedArchiveFile );
+		Int readAhead = BitTest(access, File::STREAMING) ? STREAMING_READ_AHEAD : 0;
+		if (mappedFile->openFromMapping(m_mapping, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size, readAhead)) {
+			mappedFile->deleteOnClose();
+			ramFile = mappedFile;
+		} else {
+			mappedFile->deleteInstance();
+			mappedFile = NULL;
+		}
+	}
+
+	if (ramFile == NULL) {
+		if (BitTest(access, File::STREAMING)) 
+			ramFile = newInstance( StreamingArchiveFile );
+		else 
+			ramFile = newInstance( RAMFile );
+
+		ramFile->deleteOnClose();
+		if (ramFile->openFromArchive(m_file, fileInfo->m_filename, fileInfo->m_offset, fileInfo->m_size) == FALSE) {
+			ramFile->close();
+			ramFile = NULL;
+			return NULL;
+		}
 	}
 
 	if ((access & File::WRITE) == 0) {
@@ -38,6 +38,7 @@
 
 #include <winsock2.h>
 #include "Common/AudioAffect.h"
+#include "Common/CriticalSection.h"
 #include "Common/ArchiveFile.h"
 #include "Common/ArchiveFileSystem.h"
 #include "Common/File.h"
@@ -47,6 +48,7 @@
 #include "Win32Device/Common/Win32BIGFile.h"
 #include "Win32Device/Common/Win32BIGFileSystem.h"
 #include "Common/registry.h"
+#include "Common/WorkerThreadPool.h"
 
 #ifdef _INTERNAL
 // for occasional debugging...
@@ -56,6 +58,172 @@
 
 static const char *BIGFileIdentifier = "BIGF";
 
+enum { BIG_HEADER_SIZE = 0x10 };	///< "BIGF", archive size, file count, end of the directory
+enum { BIG_DIRECTORY_GUESS_PER_FILE = 64 };	///< how much directory to read per file when the header doesn't say
+
+//-------------------------------------------------------------------------------------------------
+/** One archive to mount.  The header is read and parsed on whichever thread picks the job up;
+	* everything that touches the file system's shared state happens afterwards, in order. */
+//-------------------------------------------------------------------------------------------------
+struct BIGMountJob
+{
+	AsciiString			m_filename;
+	Win32BIGFile		*m_archiveFile;		///< NULL if the mount failed
+	const char			*m_error;					///< why it failed; reported by the main thread
+	Int							m_archiveSize;
+	Int							m_numFiles;
+};
+
+//-------------------------------------------------------------------------------------------------
+/** Parse numFiles directory entries out of the header block.  Returns FALSE if the block
+	* ends before the entries do. */
+//-------------------------------------------------------------------------------------------------
+static Bool parseBIGDirectory( Win32BIGFile *archiveFile, const AsciiString& archiveFileName,
+															 const char *directory, Int directorySize, Int numFiles, const char **error )
+{
+	ArchivedFileInfo fileInfo;
+	char buffer[_MAX_PATH];
+	Int pos = 0;
+
+	for (Int i = 0; i < numFiles; ++i) {
+		if (pos + 8 > directorySize) {
+			return FALSE;
+		}
+
+		Int fileOffset;
+		Int filesize;
+		memcpy(&fileOffset, directory + pos, 4);
+		memcpy(&filesize, directory + pos + 4, 4);
+		pos += 8;
+
+		fileInfo.m_archiveFilename = archiveFileName;
+		fileInfo.m_offset = ntohl(fileOffset);
+		fileInfo.m_size = ntohl(filesize);
+
+		// the path name of the file, NUL terminated.
+		const char *name = directory + pos;
+		const char *nameEnd = (const char *)memchr(name, 0, directorySize - pos);
+		if (nameEnd == NULL) {
+			return FALSE;
+		}
+		Int nameLength = nameEnd - name;
+		if (nameLength >= _MAX_PATH) {
+			*error = "Path too long in BIG file directory";
+			return FALSE;
+		}
+		memcpy(buffer, name, nameLength + 1);
+		pos += nameLength + 1;
+
+		Int filenameIndex = nameLength - 1;
+		while ((filenameIndex >= 0) && (buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/')) {
+			--filenameIndex;
+		}
+
+		fileInfo.m_filename = (char *)(buffer + filenameIndex + 1);
+		fileInfo.m_filename.toLower();
+		buffer[filenameIndex + 1] = 0;
+
+		AsciiString path;
+		path = buffer;
+
+		archiveFile->addFile(path, &fileInfo);
+	}
+
+	return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/** Open a BIG file and build its directory tree.  The whole directory is pulled in with one read
+	* rather than a few bytes at a time.  Safe to call from a worker thread: it only touches the new
+	* archive and logs nothing; failures come back through job.m_error. */
+//-------------------------------------------------------------------------------------------------
+static void mountBIGFile( BIGMountJob& job )
+{
+	job.m_archiveFile = NULL;
+	job.m_error = NULL;
+	job.m_archiveSize = 0;
+	job.m_numFiles = 0;
+
+	File *fp = TheLocalFileSystem->openFile(job.m_filename.str(), File::READ | File::BINARY);
+	if (fp == NULL) {
+		job.m_error = "Could not open archive file";
+		return;
+	}
+
+	Int header[BIG_HEADER_SIZE / 4];
+	if (fp->read(header, BIG_HEADER_SIZE) != BIG_HEADER_SIZE || memcmp(header, BIGFileIdentifier, 4) != 0) {
+		job.m_error = "Error reading BIG file identifier";
+		fp->close();
+		return;
+	}
+
+	// the archive size is little endian; everything else in the header is big endian.
+	job.m_archiveSize = header[1];
+	job.m_numFiles = ntohl(header[2]);
+	Int directoryEnd = ntohl(header[3]);
+
+	// If the end-of-directory field is no good, start from a guess and grow it until the
+	// directory parses, rather than reading what could be the whole archive.
+	Int fileSize = fp->size();
+	Int maxDirectorySize = fileSize - BIG_HEADER_SIZE;
+	Int directorySize = directoryEnd - BIG_HEADER_SIZE;
+	if (directorySize <= 0 || directoryEnd > fileSize) {
+		directorySize = job.m_numFiles * BIG_DIRECTORY_GUESS_PER_FILE;
+		if (directorySize < 4096) {
+			directorySize = 4096;
+		}
+	}
+	if (directorySize > maxDirectorySize) {
+		directorySize = maxDirectorySize;
+	}
+
+	AsciiString archiveFileName;
+	archiveFileName = job.m_filename;
+	archiveFileName.toLower();
+
+	Win32BIGFile *archiveFile = NEW Win32BIGFile;
+	Bool parsed = FALSE;
+	for (;;) {
+		char *directory = MSGNEW("BIGFileDirectory") char[directorySize];
+		fp->seek(BIG_HEADER_SIZE, File::START);
+		Int bytesRead = fp->read(directory, directorySize);
+		parsed = (bytesRead == directorySize) && parseBIGDirectory(archiveFile, archiveFileName, directory, directorySize, job.m_numFiles, &job.m_error);
+		delete [] directory;
+
+		// the directory runs past what we read; read twice as much and try again.
+		if (parsed || job.m_error != NULL || directorySize >= maxDirectorySize) {
+			break;
+		}
+		directorySize *= 2;
+		if (directorySize > maxDirectorySize) {
+			directorySize = maxDirectorySize;
+		}
+		delete archiveFile;
+		archiveFile = NEW Win32BIGFile;
+	}
+
+	if (!parsed) {
+		if (job.m_error == NULL) {
+			job.m_error = "BIG file directory is truncated";
+		}
+		delete archiveFile;
+		fp->close();
+		return;
+	}
+
+	// leave fp open as the archive file will be using it.
+	archiveFile->attachFile(fp);
+
+	job.m_archiveFile = archiveFile;
+}
+
+//-------------------------------------------------------------------------------------------------
+static void mountBIGFileJob( void *userData, Int jobIndex )
+{
+	BIGMountJob *jobs = (BIGMountJob *)userData;
+	mountBIGFile(jobs[jobIndex]);
+}
+
 Win32BIGFileSystem::Win32BIGFileSystem() : ArchiveFileSystem() {
 }
 
@@ -93,105 +261,23 @@ void Win32BIGFileSystem::postProcessLoad() {
 }
 
 ArchiveFile * Win32BIGFileSystem::openArchiveFile(const Char *filename) {
-	File *fp = TheLocalFileSystem->openFile(filename, File::READ | File::BINARY);
-	AsciiString archiveFileName;
-	archiveFileName = filename;
-	archiveFileName.toLower();
-	Int archiveFileSize = 0;
-	Int numLittleFiles = 0;
-
-	ArchiveFile *archiveFile = NEW Win32BIGFile;
+	BIGMountJob job;
+	job.m_filename = filename;
 
 	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - opening BIG file %s\n", filename));
 
-	if (fp == NULL) {
-		DEBUG_CRASH(("Could not open archive file %s for parsing", filename));
-		return NULL;
-	}
+	mountBIGFile(job);
 
-	AsciiString asciibuf;
-	char buffer[_MAX_PATH];
-	fp->read(buffer, 4); // read the "BIG" at the beginning of the file.
-	buffer[4] = 0;
-	if (strcmp(buffer, BIGFileIdentifier) != 0) {
-		DEBUG_CRASH(("Error reading BIG file identifier in file %s", filename));
-		fp->close();
-		fp = NULL;
+	if (job.m_archiveFile == NULL) {
+		DEBUG_CRASH(("%s: %s", job.m_error, filename));
 		return NULL;
 	}
 
-	// read in the file size.
-	fp->read(&archiveFileSize, 4);
-
-	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - size of archive file is %d bytes\n", archiveFileSize));
-
-//	char t;
-
-	// read in the number of files contained in this BIG file.
-	// change the order of the bytes cause the file size is in reverse byte order for some reason.
-	fp->read(&numLittleFiles, 4);
-	numLittleFiles = ntohl(numLittleFiles);
-
-	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - %d are contained in archive\n", numLittleFiles));
-//	for (Int i = 0; i < 2; ++i) {
-//		t = buffer[i];
-//		buffer[i] = buffer[(4-i)-1];
-//		buffer[(4-i)-1] = t;
-//	}
-
-	// seek to the beginning of the directory listing.
-	fp->seek(0x10, File::START);
-	// read in each directory listing.
-	ArchivedFileInfo *fileInfo = NEW ArchivedFileInfo;
-
-	for (Int i = 0; i < numLittleFiles; ++i) {
-		Int filesize = 0;
-		Int fileOffset = 0;
-		fp->read(&fileOffset, 4);
-		fp->read(&filesize, 4);
-
-		filesize = ntohl(filesize);
-		fileOffset = ntohl(fileOffset);
-
-		fileInfo->m_archiveFilename = archiveFileName;
-		fileInfo->m_offset = fileOffset;
-		fileInfo->m_size = filesize;
-		
-		// read in the path name of the file.
-		Int pathIndex = -1;
-		do {
-			++pathIndex;
-			fp->read(buffer + pathIndex, 1);
-		} while (buffer[pathIndex] != 0);
-
-		Int filenameIndex = pathIndex;
-		while ((buffer[filenameIndex] != '\\') && (buffer[filenameIndex] != '/') && (filenameIndex >= 0)) {
-			--filenameIndex;
-		}
+	job.m_archiveFile->mapArchive();
 
-		fileInfo->m_filename = (char *)(buffer + filenameIndex + 1);
-		fileInfo->m_filename.toLower();
-		buffer[filenameIndex + 1] = 0;
+	DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - size of archive file is %d bytes, %d files contained in archive\n", job.m_archiveSize, job.m_numFiles));
 
-		AsciiString path;
-		path = buffer;
-
-		AsciiString debugpath;
-		debugpath = path;
-		debugpath.concat(fileInfo->m_filename);
-//		DEBUG_LOG(("Win32BIGFileSystem::openArchiveFile - adding file %s to archive file %s, file number %d\n", debugpath.str(), fileInfo->m_archiveFilename.str(), i));
-
-		archiveFile->addFile(path, fileInfo);
-	}
-
-	archiveFile->attachFile(fp);
-
-	delete fileInfo;
-	fileInfo = NULL;
-
-	// leave fp open as the archive file will be using it.
-
-	return archiveFile;
+	return job.m_archiveFile;
 }
 
 void Win32BIGFileSystem::closeArchiveFile(const Char *filename) {
@@ -210,6 +296,7 @@ void Win32BIGFileSystem::closeArchiveFile(const Char *filename) {
 	DEBUG_ASSERTCRASH(stricmp(filename, MUSIC_BIG) == 0, ("Attempting to close Archive file '%s', need to add code to handle its shutdown correctly.", filename));
 
 	// may need to do some other processing here first.
+	removeArchiveFromIndex(it->second);
 	
 	delete (it->second);
 	m_archiveFileMap.erase(it);
@@ -226,20 +313,56 @@ Bool Win32BIGFileSystem::loadBigFilesFromDirectory(AsciiString dir, AsciiString
 	FilenameList filenameList;
 	TheLocalFileSystem->getFileListInDirectory(dir, AsciiString(""), fileMask, filenameList, TRUE);
 
+	Int numArchives = filenameList.size();
+	if (numArchives == 0) {
+		return FALSE;
+	}
+
+	// read and parse every header first; each job only touches its own archive.
+	std::vector<BIGMountJob> jobs;
+	jobs.resize(numArchives);
+	Int i = 0;
+	FilenameListIter it;
+	for (it = filenameList.begin(); it != filenameList.end(); ++it, ++i) {
+		jobs[i].m_filename = *it;
+	}
+
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	Int numThreads = (Int)systemInfo.dwNumberOfProcessors - 1;
+	if (numThreads > numArchives - 1) {
+		numThreads = numArchives - 1;
+	}
+	// Mounting allocates from the memory pools, which are only safe to share between threads
+	// once the app has installed their critical sections.  The tools don't, so they mount in turn.
+	if (TheMemoryPoolCriticalSection == NULL || TheDmaCriticalSection == NULL) {
+		numThreads = 0;
+	}
+	if (numThreads > 0) {
+		WorkerThreadPool pool(numThreads);
+		pool.run(mountBIGFileJob, &jobs[0], numArchives);
+	} else {
+		for (i = 0; i < numArchives; ++i) {
+			mountBIGFile(jobs[i]);
+		}
+	}
+
+	// then merge them in filename order, exactly as a one-at-a-time mount would.
 	Bool actuallyAdded = FALSE;
-	FilenameListIter it = filenameList.begin();
-	while (it != filenameList.end()) {
-		ArchiveFile *archiveFile = openArchiveFile((*it).str());
+	for (i = 0; i < numArchives; ++i) {
+		const BIGMountJob& job = jobs[i];
+		ArchiveFile *archiveFile = job.m_archiveFile;
 
 		if (archiveFile != NULL) {
-			DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - loading %s into the directory tree.\n", (*it).str()));
-			loadIntoDirectoryTree(archiveFile, *it, overwrite);
-			m_archiveFileMap[(*it)] = archiveFile;
-			DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.\n", (*it).str()));
+			job.m_archiveFile->mapArchive();
+			DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - loading %s (%d files, %d bytes) into the directory tree.\n", job.m_filename.str(), job.m_numFiles, job.m_archiveSize));
+			loadIntoDirectoryTree(archiveFile, job.m_filename, overwrite);
+			m_archiveFileMap[job.m_filename] = archiveFile;
+			DEBUG_LOG(("Win32BIGFileSystem::loadBigFilesFromDirectory - %s inserted into the archive file map.\n", job.m_filename.str()));
 			actuallyAdded = TRUE;
+		} else {
+			DEBUG_CRASH(("%s: %s", job.m_error, job.m_filename.str()));
 		}
-
-		it++;
 	}
 
 	return actuallyAdded;
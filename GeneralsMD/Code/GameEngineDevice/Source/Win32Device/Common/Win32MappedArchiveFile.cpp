@@ -0,0 +1,207 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+//																																						//
+//  (c) 2001-2003 Electronic Arts Inc.																				//
+//																																						//
+////////////////////////////////////////////////////////////////////////////////
+
+////// Win32MappedArchiveFile.cpp /////////////////////////
+// Read-only view of a file inside a memory-mapped BIG archive
+/////////////////////////////////////////////////////
+
+#include <windows.h>
+#include "Common/GameMemory.h"
+#include "Win32Device/Common/Win32MappedArchiveFile.h"
+
+//----------------------------------------------------------------------------
+//         Private Data                                                     
+//----------------------------------------------------------------------------
+
+static DWORD s_allocationGranularity = 0;	///< views must start on a multiple of this
+static DWORD s_pageSize = 0;
+
+//----------------------------------------------------------------------------
+//         Private Functions                                               
+//----------------------------------------------------------------------------
+
+static void initMappingGranularity( void )
+{
+	if (s_allocationGranularity == 0) {
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		s_pageSize = info.dwPageSize;
+		s_allocationGranularity = info.dwAllocationGranularity;
+	}
+}
+
+//============================================================================
+// Win32MappedArchiveFile::Win32MappedArchiveFile
+//============================================================================
+
+Win32MappedArchiveFile::Win32MappedArchiveFile()
+: m_viewBase(NULL),
+	m_readAhead(0),
+	m_readAheadPos(0)
+{
+
+}
+
+//============================================================================
+// Win32MappedArchiveFile::~Win32MappedArchiveFile
+//============================================================================
+
+Win32MappedArchiveFile::~Win32MappedArchiveFile()
+{
+	if (m_viewBase != NULL) {
+		UnmapViewOfFile(m_viewBase);
+		m_viewBase = NULL;
+		m_data = NULL;	// not ours to delete; keep ~RAMFile away from it
+	}
+}
+
+//============================================================================
+// Win32MappedArchiveFile::openFromMapping
+//============================================================================
+/**
+	* Map just the bytes of this file (widened down to the allocation granularity)
+	* rather than the whole archive, so address space use is bounded by what is
+	* actually open at the time.
+	*/
+Bool Win32MappedArchiveFile::openFromMapping( HANDLE mapping, const AsciiString& filename, Int offset, Int size, Int readAhead )
+{
+	if (mapping == NULL || size <= 0) {
+		return FALSE;
+	}
+
+	if (File::open(filename.str(), File::READ | File::BINARY) == FALSE) {
+		return FALSE;
+	}
+
+	initMappingGranularity();
+	DWORD viewOffset = offset - (offset % s_allocationGranularity);
+	Int lead = offset - viewOffset;
+
+	m_viewBase = MapViewOfFile(mapping, FILE_MAP_READ, 0, viewOffset, lead + size);
+	if (m_viewBase == NULL) {
+		DEBUG_LOG(("Win32MappedArchiveFile::openFromMapping - could not map %s, error %d\n", filename.str(), GetLastError()));
+		return FALSE;
+	}
+
+	m_data = (Char *)m_viewBase + lead;
+	m_size = size;
+	m_pos = 0;
+	m_readAhead = readAhead;
+	m_readAheadPos = 0;
+	m_nameStr = filename;
+
+	touchReadAhead();
+
+	return TRUE;
+}
+
+//============================================================================
+// Win32MappedArchiveFile::close
+//============================================================================
+
+void Win32MappedArchiveFile::close( void )
+{
+	if (m_viewBase != NULL) {
+		UnmapViewOfFile(m_viewBase);
+		m_viewBase = NULL;
+		m_data = NULL;
+	}
+
+	RAMFile::close();
+}
+
+//============================================================================
+// Win32MappedArchiveFile::read
+//============================================================================
+
+Int Win32MappedArchiveFile::read( void *buffer, Int bytes )
+{
+	Int bytesRead = RAMFile::read(buffer, bytes);
+
+	if (m_readAhead > 0) {
+		touchReadAhead();
+	}
+
+	return bytesRead;
+}
+
+//============================================================================
+// Win32MappedArchiveFile::touchReadAhead
+//============================================================================
+/**
+	* Streaming readers (audio) consume the file a little at a time.  Faulting in
+	* the next chunk as soon as we get near it lets the memory manager cluster the
+	* disk reads instead of taking one page fault per small read.
+	*/
+void Win32MappedArchiveFile::touchReadAhead( void )
+{
+	if (m_readAhead <= 0 || m_data == NULL) {
+		return;
+	}
+
+	Int end = m_pos + m_readAhead;
+	if (end > m_size) {
+		end = m_size;
+	}
+
+	Int pos = m_readAheadPos;
+	if (pos < m_pos) {
+		pos = m_pos;
+	}
+
+	volatile Char touch;
+	for (; pos < end; pos += s_pageSize) {
+		touch = m_data[pos];
+	}
+
+	m_readAheadPos = end;
+}
+
+//============================================================================
+// Win32MappedArchiveFile::readEntireAndClose
+//============================================================================
+
+char* Win32MappedArchiveFile::readEntireAndClose()
+{
+	if (m_viewBase == NULL) {
+		return RAMFile::readEntireAndClose();
+	}
+
+	char* tmp = MSGNEW("RAMFILE") char[m_size];	// will belong to our caller!
+	memcpy(tmp, m_data, m_size);
+
+	close();
+
+	return tmp;
+}
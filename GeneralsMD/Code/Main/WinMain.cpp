@@ -884,6 +884,8 @@ static CriticalSection critSec1, critSec2, critSec3, critSec4, critSec5;
 Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
                       LPSTR lpCmdLine, Int nCmdShow )
 {
+	Int exitCode = 0;
+
 	checkProtection();
 
 #ifdef _PROFILE
@@ -930,12 +932,16 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 		argv[0] = NULL;
 
 		char *token;
+		Bool headless = false;
 		token = nextParam(lpCmdLine, "\" ");
 		while (argc < 20 && token != NULL) {
 			argv[argc++] = strtrim(token);
 			//added a preparse step for this flag because it affects window creation style
 			if (stricmp(token,"-win")==0)
 				ApplicationIsWindowed=true;
+			// headless runs get no window at all; every device they would need is a dummy
+			if (stricmp(token,"-headless")==0 || stricmp(token,"-simReplay")==0)
+				headless=true;
 			token = nextParam(NULL, "\" ");	   
 		}
 
@@ -996,7 +1002,7 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 
 
 		// register windows class and create application window
-		if( initializeAppWindows( hInstance, nCmdShow, ApplicationIsWindowed) == false )
+		if( !headless && initializeAppWindows( hInstance, nCmdShow, ApplicationIsWindowed) == false )
 			return 0;
 
 		if (gLoadScreenBitmap!=NULL) {
@@ -1074,7 +1080,7 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 		DEBUG_LOG(("CRC message is %d\n", GameMessage::MSG_LOGIC_CRC));
 
 		// run the game main loop
-		GameMain(argc, argv);
+		exitCode = GameMain(argc, argv);
 
 #ifdef DO_COPY_PROTECTION
 		// Clean up copy protection
@@ -1107,7 +1113,7 @@ Int APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance,
 	TheDmaCriticalSection = NULL;
 	TheMemoryPoolCriticalSection = NULL;
 
-	return 0;
+	return exitCode;
 
 }  // end WinMain
 
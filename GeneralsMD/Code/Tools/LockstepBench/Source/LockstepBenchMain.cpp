@@ -0,0 +1,1001 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: LockstepBenchMain.cpp /////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+//
+// Project:    LockstepBench
+//
+// File name:  LockstepBenchMain.cpp
+//
+// Desc:       Runs N lockstep peers in one process over a LoopbackNetwork and
+//             reports how the network code copes: the run ahead the packet
+//             router picks, frames stalled waiting for commands, frame resend
+//             requests, command retries, players disconnected and bytes on
+//             the wire.
+//
+//             Each peer is a real ConnectionManager (and so DisconnectManager,
+//             Connections and FrameDataManagers), told about the other peers
+//             through a GameInfo the way the lobby does it.  Commands go
+//             through the packet router, run ahead and disconnects are
+//             negotiated by the game's own code.  Only the Network frame loop
+//             is repeated here, since Network is tied to TheGameLogic and
+//             TheCommandList; it is kept to the same order of events.
+//
+//             The script is a text file:
+//
+//               peers <count>
+//               frames <count>
+//               fps <frames per second>
+//               seed <number>
+//               timeout <seconds>   ; give up after this long with no progress
+//               compact <0|1>       ; pack game commands with the compact encoding
+//               disconnecttime <ms> ; GameData.ini NetworkDisconnectTime
+//               playertimeout <ms>  ; GameData.ini NetworkPlayerTimeoutTime
+//               link <from> <to> [latency <ms>] [jitter <ms>] [loss <%>] [reorder <%>]
+//               at <frame> link ...   ; change a link once the lowest live slot reaches the frame
+//               cmd <frame> <slot> <select|move|attack> [<object count>]
+//               every <frames> <slot> <select|move|attack> [<object count>]
+//               drop <frame> <slot> ; the peer goes silent once the lowest live slot reaches the frame
+//
+//             <from>, <to> and <slot> are slot numbers or * for all of them
+//             (drop takes a single slot).  The others take disconnecttime
+//             plus playertimeout to vote a dropped peer out, so the timeout
+//             has to be longer than that; the game's 60 second player
+//             timeout makes for a slow bench.
+//
+//-----------------------------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES ////////////////////////////////////////////////////////////
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <list>
+#include <vector>
+
+// USER INCLUDES //////////////////////////////////////////////////////////////
+#include "Lib/BaseType.h"
+#include "Common/Debug.h"
+#include "Common/FileSystem.h"
+#include "Common/GameMemory.h"
+#include "Common/GlobalData.h"
+#include "Common/MessageStream.h"
+#include "GameNetwork/ConnectionManager.h"
+#include "GameNetwork/GameInfo.h"
+#include "GameNetwork/LoopbackNetwork.h"
+#include "GameNetwork/NetCommandList.h"
+#include "GameNetwork/NetCommandMsg.h"
+#include "GameNetwork/NetCommandRef.h"
+#include "GameNetwork/NetPacket.h"
+#include "GameNetwork/networkutil.h"
+#include "GameNetwork/Transport.h"
+
+// DEFINES ////////////////////////////////////////////////////////////////////
+#define PEER_PORT 8088
+#define DEFAULT_TIMEOUT 30
+
+// PRIVATE TYPES //////////////////////////////////////////////////////////////
+enum BenchCommandType
+{
+	BENCHCOMMAND_SELECT,		///< MSG_CREATE_SELECTED_GROUP: a Bool and a list of object IDs
+	BENCHCOMMAND_MOVE,			///< MSG_DO_MOVETO: a location
+	BENCHCOMMAND_ATTACK			///< MSG_DO_ATTACK_OBJECT: attacker and victim object IDs
+};
+
+struct BenchCommand
+{
+	UnsignedInt m_frame;		///< frame to issue it on, or the period for a repeating command
+	Int m_slot;
+	BenchCommandType m_type;
+	Int m_numObjects;
+};
+
+struct BenchLinkChange
+{
+	UnsignedInt m_frame;
+	Int m_from;							///< -1 for every slot
+	Int m_to;								///< -1 for every slot
+	Bool m_hasLatency, m_hasJitter, m_hasLoss, m_hasReorder;
+	LoopbackLinkSettings m_settings;
+};
+
+struct BenchDrop
+{
+	UnsignedInt m_frame;
+	Int m_slot;
+};
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////
+static Int s_numPeers = 2;
+static UnsignedInt s_numFrames = 900;
+static Int s_fps = 30;
+static UnsignedInt s_seed = 1;
+static Int s_timeout = DEFAULT_TIMEOUT;
+static Bool s_compact = FALSE;
+static std::vector<BenchLinkChange> s_linkChanges;	///< in script order; frame 0 ones apply before the start
+static std::vector<BenchCommand> s_commands;
+static std::vector<BenchCommand> s_repeatingCommands;
+static std::vector<BenchDrop> s_drops;
+
+///////////////////////////////////////////////////////////////////////////////
+// PUBLIC DATA ////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+HINSTANCE ApplicationHInstance = NULL;  ///< our application instance
+
+/// just to satisfy the game libraries we link to
+HWND ApplicationHWnd = NULL;
+
+char *gAppPrefix = "LB_";
+
+const Char *g_strFile = "data\\Generals.str";
+const Char *g_csfFile = "data\\%s\\Generals.csf";
+
+///////////////////////////////////////////////////////////////////////////////
+// PRIVATE CLASSES ////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static UnsignedInt peerAddress(Int slot)
+{
+	return 0x0A000001 + slot;	// 10.0.0.1 and up
+}
+
+class SimPeer;
+
+//-----------------------------------------------------------------------------
+/** A ConnectionManager that asks its peer, rather than TheGameLogic, TheNetwork
+  * and TheDisplay, what frame it's on. */
+//-----------------------------------------------------------------------------
+class PeerConnectionManager : public ConnectionManager
+{
+public:
+	PeerConnectionManager(SimPeer *peer) : m_peer(peer) { }
+
+	virtual UnsignedInt getLogicFrame( void );
+	virtual Int getExecutionFrame( void );
+	virtual Real getLocalFps( void );
+
+protected:
+	SimPeer *m_peer;
+};
+
+//-----------------------------------------------------------------------------
+/** The game the lobby would have set up, with its own slots (as SkirmishGameInfo has). */
+//-----------------------------------------------------------------------------
+class BenchGameInfo : public GameInfo
+{
+public:
+	BenchGameInfo()
+	{
+		for (Int i = 0; i < MAX_SLOTS; ++i)
+			setSlotPointer(i, &m_benchSlot[i]);
+	}
+
+private:
+	GameSlot m_benchSlot[MAX_SLOTS];
+};
+
+//-----------------------------------------------------------------------------
+/** One simulated player: what Network does with its ConnectionManager. */
+//-----------------------------------------------------------------------------
+class SimPeer
+{
+public:
+	SimPeer(LoopbackNetwork *network, Int slot);
+	~SimPeer();
+
+	void update();
+	void drop() { m_dropped = TRUE; }
+	Bool isDropped() { return m_dropped; }
+	Bool isDone() { return m_frame > s_numFrames; }
+	UnsignedInt getFrame() { return m_frame; }
+	Int getExecutionFrame();
+	Int getAverageFps() { return m_averageFps; }
+	void report();
+
+protected:
+	void issueCommands();
+	void issueCommand(const BenchCommand &cmd);
+	Bool timeForNewFrame();
+	void executeFrame();
+	void setRunAhead(Int runAhead, Int frameRate);
+
+	Int m_slot;
+	PeerConnectionManager *m_conMgr;
+
+	UnsignedInt m_frame;							///< the next frame to execute, what TheGameLogic->getFrame() would say
+	UnsignedInt m_lastIssueFrame;			///< the last frame we sent frame info and issued commands on
+	Int m_runAhead;
+	Int m_frameRate;
+	Int m_lastExecutionFrame;
+	Int m_lastFrameCompleted;
+	UnsignedInt m_nextFrameTime;
+	Bool m_didSelfSlug;
+	UnsignedInt m_nextCommand;				///< index into s_commands
+	Bool m_dropped;
+
+	// stands in for the display frame rate
+	UnsignedInt m_fpsTime;
+	Int m_fpsFrames;
+	Int m_averageFps;
+
+	// what we report
+	Bool m_stalled;
+	UnsignedInt m_stallStart;
+	Int m_stallFrames;								///< frames that were due but didn't have all their commands
+	UnsignedInt m_stallTime;					///< milliseconds spent waiting on them
+	Int m_runAheadChanges;
+	Int m_commandsIssued;
+	Int m_commandsExecuted;
+	Int m_playersDestroyed;						///< DestroyPlayer commands executed, one per player voted out
+};
+
+//-----------------------------------------------------------------------------
+UnsignedInt PeerConnectionManager::getLogicFrame()
+{
+	return m_peer->getFrame();
+}
+
+//-----------------------------------------------------------------------------
+Int PeerConnectionManager::getExecutionFrame()
+{
+	return m_peer->getExecutionFrame();
+}
+
+//-----------------------------------------------------------------------------
+Real PeerConnectionManager::getLocalFps()
+{
+	return (Real)m_peer->getAverageFps();
+}
+
+//-----------------------------------------------------------------------------
+/** Network::init, then Network::parseUserList with the game the lobby would
+  * have handed it. */
+//-----------------------------------------------------------------------------
+SimPeer::SimPeer(LoopbackNetwork *network, Int slot)
+{
+	m_slot = slot;
+
+	m_conMgr = NEW PeerConnectionManager(this);
+	m_conMgr->init();
+
+	Transport *transport = new Transport;
+	transport->reset();
+	transport->init(NEW LoopbackUDP(network), peerAddress(slot), PEER_PORT);
+	m_conMgr->attachTransport(transport);
+	m_conMgr->setLocalAddress(peerAddress(slot), PEER_PORT);
+
+	m_runAhead = min(max(30, MIN_RUNAHEAD), MAX_FRAMES_AHEAD/2);
+	m_frameRate = s_fps;
+	m_lastExecutionFrame = m_runAhead - 1;
+	m_lastFrameCompleted = m_runAhead - 1;
+	m_frame = 1;
+	m_lastIssueFrame = 0;
+	m_nextFrameTime = 0;
+	m_didSelfSlug = FALSE;
+	m_nextCommand = 0;
+	m_dropped = FALSE;
+
+	m_fpsTime = timeGetTime();
+	m_fpsFrames = 0;
+	m_averageFps = s_fps;
+
+	m_stalled = FALSE;
+	m_stallStart = 0;
+	m_stallFrames = 0;
+	m_stallTime = 0;
+	m_runAheadChanges = 0;
+	m_commandsIssued = 0;
+	m_commandsExecuted = 0;
+	m_playersDestroyed = 0;
+
+	BenchGameInfo game;
+	game.setLocalIP(peerAddress(slot));
+	game.enterGame();
+	for (Int i = 0; i < s_numPeers; ++i)
+	{
+		UnicodeString name;
+		name.format(L"peer%d", i);
+		GameSlot *gameSlot = game.getSlot(i);
+		gameSlot->setState(SLOT_PLAYER, name, peerAddress(i));
+		gameSlot->setPort(PEER_PORT);
+	}
+	game.setCompactGameCommands(s_compact);
+
+	m_conMgr->parseUserList(&game);
+	m_conMgr->destroyGameMessages();
+	m_conMgr->zeroFrames(1, m_runAhead - 1);
+
+	// Network::processCommand on frame 1: clear out frame 0 since we skipped it
+	NetCommandList *netcmdlist = m_conMgr->getFrameCommandList(0);
+	netcmdlist->deleteInstance();
+}
+
+//-----------------------------------------------------------------------------
+SimPeer::~SimPeer()
+{
+	m_conMgr->destroyGameMessages();
+	delete m_conMgr;
+}
+
+//-----------------------------------------------------------------------------
+/** Same order of events as Network::update.  A dropped peer has gone silent:
+  * no acks, no keep alives, no frame info. */
+//-----------------------------------------------------------------------------
+void SimPeer::update()
+{
+	if (m_dropped)
+		return;
+
+	if (!isDone())
+	{
+		issueCommands();
+		m_conMgr->updateRunAhead(m_runAhead, m_frameRate, m_didSelfSlug, getExecutionFrame());
+		m_didSelfSlug = FALSE;
+	}
+
+	// Once we're through the last frame we stay around to relay and ack for
+	// the others, but stop watching for them to disconnect.
+	m_conMgr->update(!isDone());
+
+	if (!isDone())
+	{
+		UnsignedInt now = timeGetTime();
+		if (m_conMgr->allCommandsReady(m_frame))
+		{
+			m_conMgr->handleAllCommandsReady();
+			if (m_stalled)
+			{
+				m_stallTime += now - m_stallStart;
+				m_stalled = FALSE;
+			}
+			if (timeForNewFrame())
+				executeFrame();
+		}
+		else if (!m_stalled && ((Int)(now - m_nextFrameTime) >= 0))
+		{
+			// the frame is due and we can't run it
+			m_stalled = TRUE;
+			m_stallStart = now;
+			++m_stallFrames;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+/** Tell everyone the command counts for the frames we can't add to any more,
+  * then issue the script's commands for this frame (Network::processCommand
+  * and ConnectionManager::sendLocalGameMessage). */
+//-----------------------------------------------------------------------------
+void SimPeer::issueCommands()
+{
+	if (m_frame == m_lastIssueFrame)
+		return;
+	m_lastIssueFrame = m_frame;
+
+	Int executionFrame = getExecutionFrame();
+	for (Int frame = m_lastFrameCompleted + 1; frame < executionFrame; ++frame)
+	{
+		m_conMgr->processFrameTick(frame);
+		m_lastFrameCompleted = frame;
+	}
+
+	while ((m_nextCommand < s_commands.size()) && (s_commands[m_nextCommand].m_frame <= m_frame))
+	{
+		const BenchCommand &cmd = s_commands[m_nextCommand++];
+		if ((cmd.m_slot == m_slot) || (cmd.m_slot == -1))
+			issueCommand(cmd);
+	}
+
+	for (std::vector<BenchCommand>::const_iterator it = s_repeatingCommands.begin(); it != s_repeatingCommands.end(); ++it)
+	{
+		if (((it->m_slot == m_slot) || (it->m_slot == -1)) && ((m_frame % it->m_frame) == 0))
+			issueCommand(*it);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void SimPeer::issueCommand(const BenchCommand &cmd)
+{
+	NetGameCommandMsg *msg = newInstance(NetGameCommandMsg)();
+	GameMessageArgumentType arg;
+
+	switch (cmd.m_type)
+	{
+		case BENCHCOMMAND_SELECT:
+			msg->setGameMessageType(GameMessage::MSG_CREATE_SELECTED_GROUP);
+			arg.boolean = TRUE;
+			msg->addArgument(ARGUMENTDATATYPE_BOOLEAN, arg);
+			for (Int i = 0; i < cmd.m_numObjects; ++i)
+			{
+				arg.objectID = (ObjectID)(1000 * (m_slot + 1) + i);
+				msg->addArgument(ARGUMENTDATATYPE_OBJECTID, arg);
+			}
+			break;
+		case BENCHCOMMAND_MOVE:
+			msg->setGameMessageType(GameMessage::MSG_DO_MOVETO);
+			arg.location.x = (Real)(m_frame % 1000);
+			arg.location.y = (Real)(m_slot * 100);
+			arg.location.z = 0.0f;
+			msg->addArgument(ARGUMENTDATATYPE_LOCATION, arg);
+			break;
+		case BENCHCOMMAND_ATTACK:
+			msg->setGameMessageType(GameMessage::MSG_DO_ATTACK_OBJECT);
+			arg.objectID = (ObjectID)(1000 * (m_slot + 1));
+			msg->addArgument(ARGUMENTDATATYPE_OBJECTID, arg);
+			arg.objectID = (ObjectID)(1000 * (((m_slot + 1) % s_numPeers) + 1));
+			msg->addArgument(ARGUMENTDATATYPE_OBJECTID, arg);
+			break;
+	}
+
+	UnsignedShort currentID = 0;
+	if (DoesCommandRequireACommandID(NETCOMMANDTYPE_GAMECOMMAND))
+		currentID = GenerateNextCommandID();
+
+	msg->setExecutionFrame(getExecutionFrame());
+	msg->setPlayerID(m_slot);
+	msg->setID(currentID);
+	m_conMgr->sendLocalCommand(msg);
+	msg->detach();
+	++m_commandsIssued;
+}
+
+//-----------------------------------------------------------------------------
+/** Network::getExecutionFrame */
+//-----------------------------------------------------------------------------
+Int SimPeer::getExecutionFrame()
+{
+	Int frame = m_frame + m_runAhead;
+	if (frame > m_lastExecutionFrame)
+		m_lastExecutionFrame = frame;
+	return m_lastExecutionFrame;
+}
+
+//-----------------------------------------------------------------------------
+/** Network::timeForNewFrame, including slowing down when we're running up
+  * against the edge of our run ahead. */
+//-----------------------------------------------------------------------------
+Bool SimPeer::timeForNewFrame()
+{
+	UnsignedInt now = timeGetTime();
+	UnsignedInt frameDelay = 1000 / m_frameRate;
+
+	Real cushion = m_conMgr->getMinimumCushion();
+	Real runAheadPercentage = m_runAhead * (TheGlobalData->m_networkRunAheadSlack / (Real)100.0);
+	if (cushion < runAheadPercentage)
+	{
+		frameDelay += frameDelay / 10;
+		m_didSelfSlug = TRUE;
+	}
+
+	if ((Int)(now - m_nextFrameTime) < 0)
+		return FALSE;
+
+	if ((Int)(now - (m_nextFrameTime + 2 * frameDelay)) > 0)
+		m_nextFrameTime = now;
+	else
+		m_nextFrameTime += frameDelay;
+	return TRUE;
+}
+
+//-----------------------------------------------------------------------------
+/** Network::RelayCommandsToCommandList, with the game commands counted rather
+  * than put on TheCommandList. */
+//-----------------------------------------------------------------------------
+void SimPeer::executeFrame()
+{
+	NetCommandList *netcmdlist = m_conMgr->getFrameCommandList(m_frame);
+	for (NetCommandRef *ref = netcmdlist->getFirstMessage(); ref != NULL; ref = ref->getNext())
+	{
+		NetCommandMsg *msg = ref->getCommand();
+		switch (msg->getNetCommandType())
+		{
+			case NETCOMMANDTYPE_GAMECOMMAND:
+				++m_commandsExecuted;
+				break;
+			case NETCOMMANDTYPE_RUNAHEAD:
+			{
+				NetRunAheadCommandMsg *runAheadMsg = (NetRunAheadCommandMsg *)msg;
+				setRunAhead(runAheadMsg->getRunAhead(), runAheadMsg->getFrameRate());
+				break;
+			}
+			case NETCOMMANDTYPE_DESTROYPLAYER:
+			{
+				NetDestroyPlayerCommandMsg *destroyMsg = (NetDestroyPlayerCommandMsg *)msg;
+				++m_playersDestroyed;
+				printf("frame %5d: slot %d sees slot %d destroyed\n", m_frame, m_slot, destroyMsg->getPlayerIndex());
+				break;
+			}
+		}
+	}
+	netcmdlist->deleteInstance();
+
+	++m_frame;
+
+	++m_fpsFrames;
+	UnsignedInt now = timeGetTime();
+	if (now - m_fpsTime >= 1000)
+	{
+		m_averageFps = (m_fpsFrames * 1000) / (now - m_fpsTime);
+		m_fpsFrames = 0;
+		m_fpsTime = now;
+	}
+}
+
+//-----------------------------------------------------------------------------
+/** Network::processRunAheadCommand */
+//-----------------------------------------------------------------------------
+void SimPeer::setRunAhead(Int runAhead, Int frameRate)
+{
+	if ((runAhead != m_runAhead) || (frameRate != m_frameRate))
+	{
+		++m_runAheadChanges;
+		if (m_slot == (Int)m_conMgr->getPacketRouterSlot())
+			printf("frame %5d: run ahead %d at %d fps\n", m_frame, runAhead, frameRate);
+	}
+
+	m_runAhead = runAhead;
+	m_frameRate = frameRate;
+
+	time_t frameGrouping = ((1000 * m_runAhead) / m_frameRate) / 2;
+	if (frameGrouping < 1)
+		frameGrouping = 1;
+	if (frameGrouping > 500)
+		frameGrouping = 500;
+	m_conMgr->setFrameGrouping(frameGrouping);
+}
+
+//-----------------------------------------------------------------------------
+void SimPeer::report()
+{
+	printf("slot %d%s: frame %d, run ahead %d at %d fps (%d changes), latency %.3fs, %d stalled frames (%dms), "
+		"%d resend requests, %d resends served, %d retries, %d/%d commands issued/executed, "
+		"%d players destroyed, %d connected, packet router %d\n",
+		m_slot, m_dropped ? " (dropped)" : "", m_frame - 1, m_runAhead, m_frameRate, m_runAheadChanges,
+		m_conMgr->getAverageLatency(), m_stallFrames, m_stallTime, m_conMgr->getFrameResendRequests(),
+		m_conMgr->getFrameResendsServed(), m_conMgr->getTotalRetries(), m_commandsIssued, m_commandsExecuted,
+		m_playersDestroyed, m_conMgr->getNumPlayers(), m_conMgr->getPacketRouterSlot());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS //////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// parseSlot ==================================================================
+/** A slot number, or * for all of them (-1). */
+//=============================================================================
+static Bool parseSlot(const char *token, Int &slot)
+{
+	if (token == NULL)
+		return FALSE;
+	if (strcmp(token, "*") == 0)
+	{
+		slot = -1;
+		return TRUE;
+	}
+	slot = atoi(token);
+	return (slot >= 0) && (slot < MAX_SLOTS);
+}
+
+// parseCommand ===============================================================
+/** <frame> <slot> <select|move|attack> [<object count>] */
+//=============================================================================
+static Bool parseCommand(BenchCommand &cmd)
+{
+	const char *seps = " \t\r\n";
+	char *frame = strtok(NULL, seps);
+	char *slot = strtok(NULL, seps);
+	char *type = strtok(NULL, seps);
+	char *count = strtok(NULL, seps);
+	if (frame == NULL || type == NULL || !parseSlot(slot, cmd.m_slot))
+		return FALSE;
+
+	cmd.m_frame = atoi(frame);
+	cmd.m_numObjects = (count != NULL) ? atoi(count) : 1;
+	if (stricmp(type, "select") == 0)
+		cmd.m_type = BENCHCOMMAND_SELECT;
+	else if (stricmp(type, "move") == 0)
+		cmd.m_type = BENCHCOMMAND_MOVE;
+	else if (stricmp(type, "attack") == 0)
+		cmd.m_type = BENCHCOMMAND_ATTACK;
+	else
+		return FALSE;
+	return TRUE;
+}
+
+// parseLink ==================================================================
+/** <from> <to> [latency <ms>] [jitter <ms>] [loss <%>] [reorder <%>] */
+//=============================================================================
+static Bool parseLink(BenchLinkChange &change)
+{
+	const char *seps = " \t\r\n";
+	if (!parseSlot(strtok(NULL, seps), change.m_from) || !parseSlot(strtok(NULL, seps), change.m_to))
+		return FALSE;
+
+	change.m_hasLatency = change.m_hasJitter = change.m_hasLoss = change.m_hasReorder = FALSE;
+	char *key;
+	while ((key = strtok(NULL, seps)) != NULL)
+	{
+		char *value = strtok(NULL, seps);
+		if (value == NULL)
+			return FALSE;
+		if (stricmp(key, "latency") == 0)
+		{
+			change.m_settings.m_latency = atoi(value);
+			change.m_hasLatency = TRUE;
+		}
+		else if (stricmp(key, "jitter") == 0)
+		{
+			change.m_settings.m_jitter = atoi(value);
+			change.m_hasJitter = TRUE;
+		}
+		else if (stricmp(key, "loss") == 0)
+		{
+			change.m_settings.m_packetLoss = atoi(value);
+			change.m_hasLoss = TRUE;
+		}
+		else if (stricmp(key, "reorder") == 0)
+		{
+			change.m_settings.m_reorder = atoi(value);
+			change.m_hasReorder = TRUE;
+		}
+		else
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+// parseDrop ==================================================================
+/** <frame> <slot> */
+//=============================================================================
+static Bool parseDrop(BenchDrop &drop)
+{
+	const char *seps = " \t\r\n";
+	char *frame = strtok(NULL, seps);
+	if (frame == NULL || !parseSlot(strtok(NULL, seps), drop.m_slot) || (drop.m_slot == -1))
+		return FALSE;
+	drop.m_frame = atoi(frame);
+	return TRUE;
+}
+
+// readScript =================================================================
+/** Read the benchmark script.  Returns FALSE if the file is missing or a line
+  * doesn't parse.  The network settings go straight into TheWritableGlobalData. */
+//=============================================================================
+static Bool readScript(const char *filename)
+{
+	FILE *fp = fopen(filename, "r");
+	if (fp == NULL)
+	{
+		printf("Can't open %s\n", filename);
+		return FALSE;
+	}
+
+	char line[1024];
+	Int lineNum = 0;
+	Bool ok = TRUE;
+	while (ok && fgets(line, sizeof(line), fp) != NULL)
+	{
+		++lineNum;
+		const char *seps = " \t\r\n";
+		char *token = strtok(line, seps);
+		if (token == NULL || *token == ';')
+			continue;
+
+		UnsignedInt atFrame = 0;
+		if (stricmp(token, "at") == 0)
+		{
+			char *frame = strtok(NULL, seps);
+			token = strtok(NULL, seps);
+			if (frame == NULL || token == NULL || stricmp(token, "link") != 0)
+			{
+				printf("%s(%d): expected at <frame> link ...\n", filename, lineNum);
+				ok = FALSE;
+				break;
+			}
+			atFrame = atoi(frame);
+		}
+
+		if (stricmp(token, "link") == 0)
+		{
+			BenchLinkChange change;
+			change.m_frame = atFrame;
+			ok = parseLink(change);
+			if (ok)
+				s_linkChanges.push_back(change);
+		}
+		else if (stricmp(token, "cmd") == 0 || stricmp(token, "every") == 0)
+		{
+			BenchCommand cmd;
+			ok = parseCommand(cmd) && (cmd.m_frame > 0);
+			if (ok && stricmp(token, "cmd") == 0)
+				s_commands.push_back(cmd);
+			else if (ok)
+				s_repeatingCommands.push_back(cmd);
+		}
+		else if (stricmp(token, "drop") == 0)
+		{
+			BenchDrop drop;
+			ok = parseDrop(drop);
+			if (ok)
+				s_drops.push_back(drop);
+		}
+		else
+		{
+			char *value = strtok(NULL, seps);
+			if (value == NULL)
+				ok = FALSE;
+			else if (stricmp(token, "peers") == 0)
+				s_numPeers = atoi(value);
+			else if (stricmp(token, "frames") == 0)
+				s_numFrames = atoi(value);
+			else if (stricmp(token, "fps") == 0)
+				s_fps = atoi(value);
+			else if (stricmp(token, "seed") == 0)
+				s_seed = atoi(value);
+			else if (stricmp(token, "timeout") == 0)
+				s_timeout = atoi(value);
+			else if (stricmp(token, "compact") == 0)
+				s_compact = (atoi(value) != 0);
+			else if (stricmp(token, "disconnecttime") == 0)
+				TheWritableGlobalData->m_networkDisconnectTime = atoi(value);
+			else if (stricmp(token, "playertimeout") == 0)
+				TheWritableGlobalData->m_networkPlayerTimeoutTime = atoi(value);
+			else
+				ok = FALSE;
+		}
+
+		if (!ok)
+			printf("%s(%d): can't parse this line\n", filename, lineNum);
+	}
+	fclose(fp);
+
+	if (ok && ((s_numPeers < 2) || (s_numPeers > MAX_SLOTS) || (s_fps < 1)))
+	{
+		printf("%s: need 2 to %d peers and a positive fps\n", filename, MAX_SLOTS);
+		ok = FALSE;
+	}
+
+	for (UnsignedInt d = 0; ok && d < s_drops.size(); ++d)
+	{
+		if (s_drops[d].m_slot >= s_numPeers)
+		{
+			printf("%s: can't drop slot %d from a %d peer game\n", filename, s_drops[d].m_slot, s_numPeers);
+			ok = FALSE;
+		}
+	}
+
+	// a dropped peer holds everyone up until it's voted out
+	UnsignedInt voteOutTime = TheGlobalData->m_networkDisconnectTime + TheGlobalData->m_networkPlayerTimeoutTime;
+	if (ok && !s_drops.empty() && ((UnsignedInt)s_timeout * 1000 <= voteOutTime))
+	{
+		printf("%s: timeout has to be longer than disconnecttime + playertimeout (%dms) to see a dropped peer voted out\n",
+			filename, voteOutTime);
+		ok = FALSE;
+	}
+
+	// commands go out in frame order
+	for (UnsignedInt i = 1; ok && i < s_commands.size(); ++i)
+	{
+		BenchCommand cmd = s_commands[i];
+		UnsignedInt j = i;
+		for (; j > 0 && s_commands[j - 1].m_frame > cmd.m_frame; --j)
+			s_commands[j] = s_commands[j - 1];
+		s_commands[j] = cmd;
+	}
+	return ok;
+}
+
+// applyLinkChange ============================================================
+//=============================================================================
+static void applyLinkChange(LoopbackNetwork *network, const BenchLinkChange &change)
+{
+	for (Int from = 0; from < s_numPeers; ++from)
+	{
+		if ((change.m_from != -1) && (change.m_from != from))
+			continue;
+		for (Int to = 0; to < s_numPeers; ++to)
+		{
+			if ((to == from) || ((change.m_to != -1) && (change.m_to != to)))
+				continue;
+
+			LoopbackLinkSettings settings = network->getLinkSettings(peerAddress(from), peerAddress(to));
+			if (change.m_hasLatency)
+				settings.m_latency = change.m_settings.m_latency;
+			if (change.m_hasJitter)
+				settings.m_jitter = change.m_settings.m_jitter;
+			if (change.m_hasLoss)
+				settings.m_packetLoss = change.m_settings.m_packetLoss;
+			if (change.m_hasReorder)
+				settings.m_reorder = change.m_settings.m_reorder;
+			network->setLinkSettings(peerAddress(from), peerAddress(to), settings);
+		}
+	}
+}
+
+
+// leadFrame ==================================================================
+/** The frame the lowest slot that hasn't been dropped is on, which is what
+  * the scripted link changes and drops go by. */
+//=============================================================================
+static UnsignedInt leadFrame(std::vector<SimPeer *> &peers)
+{
+	for (std::vector<SimPeer *>::iterator it = peers.begin(); it != peers.end(); ++it)
+	{
+		if (!(*it)->isDropped())
+			return (*it)->getFrame();
+	}
+	return 0;
+}
+
+// runBench ===================================================================
+/** Run every peer on this thread until the ones still playing are all through
+  * the last frame or nobody has made progress for s_timeout seconds. */
+//=============================================================================
+static void runBench()
+{
+	LoopbackNetwork network(s_seed);
+	std::vector<Bool> applied(s_linkChanges.size(), FALSE);
+	std::vector<Bool> dropped(s_drops.size(), FALSE);
+	UnsignedInt c;
+	for (c = 0; c < s_linkChanges.size(); ++c)
+	{
+		if (s_linkChanges[c].m_frame == 0)
+		{
+			applyLinkChange(&network, s_linkChanges[c]);
+			applied[c] = TRUE;
+		}
+	}
+
+	std::vector<SimPeer *> peers;
+	std::vector<SimPeer *>::iterator it;
+	for (Int i = 0; i < s_numPeers; ++i)
+		peers.push_back(NEW SimPeer(&network, i));
+
+	UnsignedInt startTime = timeGetTime();
+	UnsignedInt lastProgress = startTime;
+	UnsignedInt lastFrames = 0;
+	Bool allDone = FALSE;
+	while (!allDone)
+	{
+		allDone = TRUE;
+		UnsignedInt frames = 0;
+		for (it = peers.begin(); it != peers.end(); ++it)
+		{
+			if ((*it)->isDropped())
+				continue;
+			(*it)->update();
+			frames += (*it)->getFrame();
+			if (!(*it)->isDone())
+				allDone = FALSE;
+		}
+
+		UnsignedInt frame = leadFrame(peers);
+		for (c = 0; c < s_linkChanges.size(); ++c)
+		{
+			if (!applied[c] && (frame >= s_linkChanges[c].m_frame))
+			{
+				applyLinkChange(&network, s_linkChanges[c]);
+				applied[c] = TRUE;
+			}
+		}
+		for (c = 0; c < s_drops.size(); ++c)
+		{
+			if (!dropped[c] && (frame >= s_drops[c].m_frame))
+			{
+				printf("frame %5d: dropping slot %d\n", frame, s_drops[c].m_slot);
+				peers[s_drops[c].m_slot]->drop();
+				dropped[c] = TRUE;
+			}
+		}
+
+		UnsignedInt now = timeGetTime();
+		if (frames != lastFrames)
+		{
+			lastFrames = frames;
+			lastProgress = now;
+		}
+		else if (now - lastProgress > (UnsignedInt)s_timeout * 1000)
+		{
+			printf("No progress for %d seconds, giving up\n", s_timeout);
+			break;
+		}
+
+		Sleep(1);
+	}
+
+	UnsignedInt elapsed = timeGetTime() - startTime;
+	printf("\n%d peers, %d frames in %d.%03ds, %s game commands\n", s_numPeers, s_numFrames, elapsed / 1000, elapsed % 1000,
+		s_compact ? "compact" : "full width");
+	for (it = peers.begin(); it != peers.end(); ++it)
+		(*it)->report();
+
+	LoopbackLinkStats stats = network.getTotalStats();
+	printf("wire: %d packets, %d bytes (%d bytes/packet, %d bytes/frame), %d lost, %d reordered\n",
+		stats.m_packets, stats.m_bytes, (stats.m_packets > 0) ? stats.m_bytes / stats.m_packets : 0,
+		(s_numFrames > 0) ? stats.m_bytes / s_numFrames : 0, stats.m_lost, stats.m_reordered);
+
+	for (it = peers.begin(); it != peers.end(); ++it)
+		delete (*it);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// main =======================================================================
+/** Application entry point
+  *   LockstepBench <script> */
+//=============================================================================
+int main(int argc, char *argv[])
+{
+	if (argc < 2)
+	{
+		printf("usage: LockstepBench <script>\n");
+		return 1;
+	}
+
+	// start the log
+	DEBUG_INIT(DEBUG_FLAGS_DEFAULT);
+	initMemoryManager();
+
+	// The network code reads its timing out of TheGlobalData.  No file systems
+	// are mounted, so these are the GlobalData defaults (which match
+	// GameData.ini) plus whatever the script sets.
+	TheFileSystem = NEW FileSystem;
+	TheWritableGlobalData = NEW GlobalData;
+
+	if (readScript(argv[1]))
+	{
+		TheWritableGlobalData->m_framesPerSecondLimit = s_fps;
+
+		timeBeginPeriod(1);
+		runBench();
+		timeEndPeriod(1);
+	}
+
+	delete TheWritableGlobalData;
+	TheWritableGlobalData = NULL;
+	delete TheFileSystem;
+	TheFileSystem = NULL;
+
+	// give the memory back before the memory manager goes away, not at static destruction time
+	std::vector<BenchLinkChange>().swap(s_linkChanges);
+	std::vector<BenchCommand>().swap(s_commands);
+	std::vector<BenchCommand>().swap(s_repeatingCommands);
+	std::vector<BenchDrop>().swap(s_drops);
+
+	// close the log
+	shutdownMemoryManager();
+	DEBUG_SHUTDOWN();
+
+	return 0;
+}
@@ -0,0 +1,332 @@
+/*
+** MinGenerals(tm)
+** Copyright 2025 CommunityRTS
+**
+** The above copyright notice applies to additions and/or other modifications
+** made to this file by CommunityRTS.
+**
+** This file incorporates original work covered by the following copyright and
+** permission notice:
+**
+**		Command & Conquer Generals(tm)
+**		Command & Conquer Generals Zero Hour(tm)
+**		Copyright 2025 Electronic Arts Inc.
+**
+**		This program is free software: you can redistribute it and/or modify
+**		it under the terms of the GNU General Public License as published by
+**		the Free Software Foundation, either version 3 of the License, or
+**		(at your option) any later version.
+**
+**		This program is distributed in the hope that it will be useful,
+**		but WITHOUT ANY WARRANTY; without even the implied warranty of
+**		MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**		GNU General Public License for more details.
+**
+**		You should have received a copy of the GNU General Public License
+**		along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// FILE: RelayServerMain.cpp ///////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+//
+// Project:    RelayServer
+//
+// File name:  RelayServerMain.cpp
+//
+// Desc:       Entry point for the standalone lockstep relay server.  Runs one
+//             RelayServer event loop per core, each on its own port, and
+//             relays for the games listed in a text file:
+//
+//               <gameID> <hostSlot> <slot> <ip> <port> [<slot> <ip> <port> ...]
+//
+//             Game N is served on port (base port + N % number of loops).
+//
+//-----------------------------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES ////////////////////////////////////////////////////////////
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// USER INCLUDES //////////////////////////////////////////////////////////////
+#include "Lib/BaseType.h"
+#include "Common/CriticalSection.h"
+#include "Common/Debug.h"
+#include "Common/GameMemory.h"
+#include "GameNetwork/RelayServer.h"
+
+// DEFINES ////////////////////////////////////////////////////////////////////
+#define DEFAULT_BASE_PORT 8088
+#define METRICS_REPORT_TIME 10000	// milliseconds between run ahead metrics reports
+
+// PRIVATE TYPES //////////////////////////////////////////////////////////////
+struct RelayPlayerEntry
+{
+	UnsignedInt m_slot;
+	UnsignedInt m_addr;
+	UnsignedShort m_port;
+};
+
+struct RelayGameEntry
+{
+	UnsignedInt m_gameID;
+	UnsignedInt m_hostSlot;
+	std::vector<RelayPlayerEntry> m_players;
+};
+
+struct RelayLoop
+{
+	Int m_index;
+	UnsignedShort m_port;
+	HANDLE m_thread;
+};
+
+// PRIVATE DATA ///////////////////////////////////////////////////////////////
+static std::vector<RelayGameEntry> s_games;	///< read once before the loops start, read-only after
+static Int s_numLoops = 0;
+static volatile Bool s_quit = FALSE;
+
+// The loops all allocate from the shared memory pools, so these have to be in place before they start.
+static CriticalSection critSec1, critSec2, critSec3, critSec4;
+
+///////////////////////////////////////////////////////////////////////////////
+// PUBLIC DATA ////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+HINSTANCE ApplicationHInstance = NULL;  ///< our application instance
+
+/// just to satisfy the game libraries we link to
+HWND ApplicationHWnd = NULL;
+
+char *gAppPrefix = "RS_";
+
+const Char *g_strFile = "data\\Generals.str";
+const Char *g_csfFile = "data\\%s\\Generals.csf";
+
+///////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS //////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// consoleHandler =============================================================
+/** Ctrl-C stops every loop at the end of its current pass. */
+//=============================================================================
+static BOOL WINAPI consoleHandler(DWORD ctrlType)
+{
+	s_quit = TRUE;
+	return TRUE;
+}
+
+// readGames ==================================================================
+/** Read the list of games to relay for.  Returns FALSE if the file is missing
+  * or a line doesn't parse. */
+//=============================================================================
+static Bool readGames(const char *filename)
+{
+	FILE *fp = fopen(filename, "r");
+	if (fp == NULL)
+	{
+		printf("Can't open %s\n", filename);
+		return FALSE;
+	}
+
+	char line[1024];
+	Int lineNum = 0;
+	while (fgets(line, sizeof(line), fp) != NULL)
+	{
+		++lineNum;
+		const char *seps = " \t\r\n";
+		char *token = strtok(line, seps);
+		if (token == NULL || *token == ';')
+			continue;
+
+		RelayGameEntry game;
+		game.m_gameID = atoi(token);
+		token = strtok(NULL, seps);
+		if (token == NULL)
+		{
+			printf("%s(%d): missing host slot\n", filename, lineNum);
+			fclose(fp);
+			return FALSE;
+		}
+		game.m_hostSlot = atoi(token);
+
+		while ((token = strtok(NULL, seps)) != NULL)
+		{
+			RelayPlayerEntry player;
+			player.m_slot = atoi(token);
+			char *ip = strtok(NULL, seps);
+			char *port = strtok(NULL, seps);
+			if (ip == NULL || port == NULL)
+			{
+				printf("%s(%d): players are <slot> <ip> <port>\n", filename, lineNum);
+				fclose(fp);
+				return FALSE;
+			}
+			player.m_addr = ntohl(inet_addr(ip));	// the transport keeps addresses in host order
+			player.m_port = (UnsignedShort)atoi(port);
+			game.m_players.push_back(player);
+		}
+		s_games.push_back(game);
+	}
+
+	fclose(fp);
+	return TRUE;
+}
+
+// reportMetrics ==============================================================
+/** Print each game's run ahead metrics. */
+//=============================================================================
+static void reportMetrics(RelayLoop *loop, RelayServer *server)
+{
+	for (std::vector<RelayGameEntry>::const_iterator it = s_games.begin(); it != s_games.end(); ++it)
+	{
+		RelayGame *game = server->findGame(it->m_gameID);
+		if (game == NULL)
+			continue;
+
+		Int minFps, minFpsPlayer;
+		game->getMinimumFps(minFps, minFpsPlayer);
+		printf("[loop %d] game %d: run ahead %d at %d fps, max latency %.3fs, min fps %d (player %d), frame spread %d\n",
+			loop->m_index, game->getGameID(), game->getRunAhead(), game->getFrameRate(),
+			game->getMaximumLatency(), minFps, minFpsPlayer, game->getFrameSpread());
+	}
+}
+
+// relayLoop ==================================================================
+/** One event loop: its own socket and the games that hash to it.  Runs until
+  * all of them are over or we're told to quit. */
+//=============================================================================
+static DWORD WINAPI relayLoop(LPVOID param)
+{
+	RelayLoop *loop = (RelayLoop *)param;
+
+	RelayServer server;
+	if (!server.init(INADDR_ANY, loop->m_port))
+	{
+		printf("[loop %d] can't open port %d\n", loop->m_index, loop->m_port);
+		return 1;
+	}
+
+	for (std::vector<RelayGameEntry>::const_iterator it = s_games.begin(); it != s_games.end(); ++it)
+	{
+		if ((Int)(it->m_gameID % s_numLoops) != loop->m_index)
+			continue;
+
+		RelayGame *game = server.addGame(it->m_gameID, it->m_hostSlot);
+		if (game == NULL)
+		{
+			printf("[loop %d] no room for game %d\n", loop->m_index, it->m_gameID);
+			continue;
+		}
+		for (std::vector<RelayPlayerEntry>::const_iterator p = it->m_players.begin(); p != it->m_players.end(); ++p)
+		{
+			game->addPlayer(p->m_slot, p->m_addr, p->m_port);
+		}
+	}
+
+	printf("[loop %d] relaying %d games on port %d\n", loop->m_index, server.getNumGames(), loop->m_port);
+
+	UnsignedInt lastReport = timeGetTime();
+	while (!s_quit && server.getNumGames() > 0)
+	{
+		server.update();
+
+		UnsignedInt now = timeGetTime();
+		if (now - lastReport > METRICS_REPORT_TIME)
+		{
+			reportMetrics(loop, &server);
+			lastReport = now;
+		}
+
+		Sleep(1);
+	}
+
+	server.reset();
+	return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// main =======================================================================
+/** Application entry point
+  *   RelayServer -games <file> [-port <base port>] [-loops <count>] */
+//=============================================================================
+int main(int argc, char *argv[])
+{
+	const char *gamesFile = NULL;
+	Int basePort = DEFAULT_BASE_PORT;
+
+	SYSTEM_INFO sysInfo;
+	GetSystemInfo(&sysInfo);
+	s_numLoops = sysInfo.dwNumberOfProcessors;
+
+	for (Int i = 1; i < argc; ++i)
+	{
+		if (stricmp(argv[i], "-games") == 0 && i + 1 < argc)
+			gamesFile = argv[++i];
+		else if (stricmp(argv[i], "-port") == 0 && i + 1 < argc)
+			basePort = atoi(argv[++i]);
+		else if (stricmp(argv[i], "-loops") == 0 && i + 1 < argc)
+			s_numLoops = atoi(argv[++i]);
+	}
+
+	if (gamesFile == NULL)
+	{
+		printf("usage: RelayServer -games <file> [-port <base port>] [-loops <count>]\n");
+		return 1;
+	}
+	if (s_numLoops < 1)
+		s_numLoops = 1;
+
+	TheUnicodeStringCriticalSection = &critSec1;
+	TheDmaCriticalSection = &critSec2;
+	TheMemoryPoolCriticalSection = &critSec3;
+	TheDebugLogCriticalSection = &critSec4;
+
+	// start the log
+	DEBUG_INIT(DEBUG_FLAGS_DEFAULT);
+	initMemoryManager();
+
+	if (readGames(gamesFile))
+	{
+		SetConsoleCtrlHandler(consoleHandler, TRUE);
+		timeBeginPeriod(1);
+
+		std::vector<RelayLoop> loops(s_numLoops);
+		std::vector<HANDLE> threads;
+		for (Int i = 0; i < s_numLoops; ++i)
+		{
+			loops[i].m_index = i;
+			loops[i].m_port = (UnsignedShort)(basePort + i);
+			loops[i].m_thread = CreateThread(NULL, 0, relayLoop, &loops[i], 0, NULL);
+			if (loops[i].m_thread != NULL)
+				threads.push_back(loops[i].m_thread);
+		}
+
+		if (!threads.empty())
+			WaitForMultipleObjects(threads.size(), &threads[0], TRUE, INFINITE);
+
+		for (std::vector<HANDLE>::iterator t = threads.begin(); t != threads.end(); ++t)
+			CloseHandle(*t);
+
+		timeEndPeriod(1);
+	}
+
+	// give the memory back before the memory manager goes away, not at static destruction time
+	std::vector<RelayGameEntry>().swap(s_games);
+
+	// close the log
+	shutdownMemoryManager();
+	DEBUG_SHUTDOWN();
+
+	TheUnicodeStringCriticalSection = NULL;
+	TheDmaCriticalSection = NULL;
+	TheMemoryPoolCriticalSection = NULL;
+	TheDebugLogCriticalSection = NULL;
+
+	return 0;
+}